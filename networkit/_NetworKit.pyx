@@ -239,6 +239,9 @@ cdef extern from "cpp/graph/Graph.h":
 		_Graph(const _Graph& other, bool weighted, bool directed) except +
 		void indexEdges(bool) except +
 		bool hasEdgeIds() except +
+		void buildAdjacencyIndex(count) except +
+		void removeAdjacencyIndex() except +
+		bool hasAdjacencyIndex() except +
 		edgeid edgeId(node, node) except +
 		count numberOfNodes() except +
 		count numberOfEdges() except +
@@ -442,6 +445,36 @@ cdef class Graph:
 		"""
 		return self._this.hasEdgeIds()
 
+	def buildAdjacencyIndex(self, threshold = 64):
+		"""
+		Build a hash index for the adjacency arrays of nodes with high degree, so that
+		hasEdge, weight, setWeight, removeEdge and edgeId take constant expected time
+		for them. The index is maintained by all edge modifications.
+
+		Parameters
+		----------
+		threshold : count
+			Minimum number of entries of an adjacency array to be indexed.
+		"""
+		self._this.buildAdjacencyIndex(threshold)
+
+	def removeAdjacencyIndex(self):
+		"""
+		Remove the adjacency index and free its memory.
+		"""
+		self._this.removeAdjacencyIndex()
+
+	def hasAdjacencyIndex(self):
+		"""
+		Returns true if the adjacency arrays are indexed
+
+		Returns
+		-------
+		bool
+			if buildAdjacencyIndex has been called
+		"""
+		return self._this.hasAdjacencyIndex()
+
 	def edgeId(self, node u, node v):
 		"""
 		Returns
@@ -1328,6 +1361,42 @@ cdef class BFS(SSSP):
 		self._G = G
 		self._this = new _BFS(G._this, source, storePaths, storeStack, target)
 
+cdef extern from "cpp/distance/ParallelBFS.h":
+	cdef cppclass _ParallelBFS "NetworKit::ParallelBFS"(_SSSP):
+		_ParallelBFS(_Graph G, node source, bool storePaths, bool storeStack, node target, double alpha, double beta) except +
+		count numberOfBottomUpSteps() except +
+
+cdef class ParallelBFS(SSSP):
+	""" Parallel direction-optimizing breadth-first search on a Graph from a given source.
+	Switches between top-down and bottom-up steps depending on the size of the frontier.
+
+	ParallelBFS(G, source, [storePaths], [storeStack], target, [alpha], [beta])
+
+	Create ParallelBFS for `G` and source node `source`.
+
+	Parameters
+	----------
+	G : Graph
+		The graph.
+	source : node
+		The source node of the breadth-first search.
+	storePaths : bool
+		store paths and number of paths?
+	target: node
+		terminate search after the level of the target
+	alpha : double
+		switch to bottom-up once the frontier has more than 1/alpha of the unexplored edges
+	beta : double
+		switch back to top-down once the shrinking frontier has less than n/beta nodes
+	"""
+
+	def __cinit__(self, Graph G, source, storePaths=True, storeStack=False, target=none, alpha=14.0, beta=24.0):
+		self._G = G
+		self._this = new _ParallelBFS(G._this, source, storePaths, storeStack, target, alpha, beta)
+
+	def numberOfBottomUpSteps(self):
+		return (<_ParallelBFS*>(self._this)).numberOfBottomUpSteps()
+
 cdef extern from "cpp/distance/DynBFS.h":
 	cdef cppclass _DynBFS "NetworKit::DynBFS"(_DynSSSP):
 		_DynBFS(_Graph G, node source) except +
@@ -1353,16 +1422,27 @@ cdef class DynBFS(DynSSSP):
 		self._this = new _DynBFS(G._this, source)
 
 
+cdef extern from "cpp/distance/Dijkstra.h" namespace "NetworKit":
+	cdef enum DijkstraQueue:
+		setQueue = 0
+		dAryHeap = 1
+		radixHeap = 2
+
+class _DijkstraQueue(object):
+	SetQueue = setQueue
+	DAryHeap = dAryHeap
+	RadixHeap = radixHeap
+
 cdef extern from "cpp/distance/Dijkstra.h":
 	cdef cppclass _Dijkstra "NetworKit::Dijkstra"(_SSSP):
-		_Dijkstra(_Graph G, node source, bool storePaths, bool storeStack, node target) except +
+		_Dijkstra(_Graph G, node source, bool storePaths, bool storeStack, node target, DijkstraQueue queue) except +
 
 cdef class Dijkstra(SSSP):
 	""" Dijkstra's SSSP algorithm.
 	Returns list of weighted distances from node source, i.e. the length of the shortest path from source to
 	any other node.
 
-    Dijkstra(G, source, [storePaths], [storeStack], target)
+    Dijkstra(G, source, [storePaths], [storeStack], target, [queue])
 
     Creates Dijkstra for `G` and source node `source`.
 
@@ -1378,10 +1458,12 @@ cdef class Dijkstra(SSSP):
 		maintain a stack of nodes in order of decreasing distance?
 	target : node
 		target node. Search ends when target node is reached. t is set to None by default.
+	queue : _DijkstraQueue
+		priority queue implementation: SetQueue, DAryHeap (default) or RadixHeap.
     """
-	def __cinit__(self, Graph G, source, storePaths=True, storeStack=False, node target=none):
+	def __cinit__(self, Graph G, source, storePaths=True, storeStack=False, node target=none, queue=_DijkstraQueue.DAryHeap):
 		self._G = G
-		self._this = new _Dijkstra(G._this, source, storePaths, storeStack, target)
+		self._this = new _Dijkstra(G._this, source, storePaths, storeStack, target, queue)
 
 cdef extern from "cpp/distance/DynDijkstra.h":
 	cdef cppclass _DynDijkstra "NetworKit::DynDijkstra"(_DynSSSP):
@@ -1461,6 +1543,39 @@ cdef class APSP(Algorithm):
 		"""
 		return (<_APSP*>(self._this)).getDistance(u, v)
 
+cdef extern from "cpp/distance/TiledAPSP.h":
+	cdef cppclass _TiledAPSP "NetworKit::TiledAPSP"(_Algorithm):
+		_TiledAPSP(_Graph G, string path, count bytesPerEntry, count tileSize) except +
+
+cdef class TiledAPSP(Algorithm):
+	""" All-Pairs Shortest-Paths for graphs whose distance matrix does not fit into memory.
+	The sources are processed in parallel in tiles of consecutive node ids and every tile is
+	written to a distance matrix file before the next one is computed. The file can be
+	queried lazily with DistanceMatrixReader.
+
+	TiledAPSP(G, path, bytesPerEntry=2, tileSize=0)
+
+	Parameters
+	----------
+	G : Graph
+		The graph.
+	path : str
+		Path of the distance matrix file.
+	bytesPerEntry : int
+		Size of an entry of the file: 1 or 2 for hop distances (at most 254 or 65534 hops),
+		4 (float) or 8 (double) for weighted graphs.
+	tileSize : int
+		Number of sources per tile; 0 chooses four sources per thread.
+	"""
+	cdef Graph _G
+
+	def __cinit__(self, Graph G, path, count bytesPerEntry=2, count tileSize=0):
+		self._G = G
+		self._this = new _TiledAPSP(G._this, stdstring(path), bytesPerEntry, tileSize)
+
+	def __dealloc__(self):
+		self._G = None
+
 cdef extern from "cpp/distance/DynAPSP.h":
 	cdef cppclass _DynAPSP "NetworKit::DynAPSP"(_APSP):
 		_DynAPSP(_Graph G) except +
@@ -1760,7 +1875,8 @@ cdef class BarabasiAlbertGenerator:
 	"""
 	This generator implements the preferential attachment model as introduced by Barabasi and Albert[1].
 	The original algorithm is very slow and thus, the much faster method from Batagelj and Brandes[2] is
-	implemented and the current default.
+	implemented and the current default. It runs in parallel and, for a given seed, its result does not
+	depend on the number of threads.
 	The original method can be chosen by setting \p batagelj to false.
 	[1] Barabasi, Albert: Emergence of Scaling in Random Networks http://arxiv.org/pdf/cond-mat/9910332.pdf
 	[2] ALG 5 of Batagelj, Brandes: Efficient Generation of Large Random Networks https://kops.uni-konstanz.de/bitstream/handle/123456789/5799/random.pdf?sequence=1
@@ -2311,8 +2427,9 @@ cdef class RmatGenerator:
 	More details at http://www.graph500.org or in the original paper:
 	Deepayan Chakrabarti, Yiping Zhan, Christos Faloutsos:
 	R-MAT: A Recursive Model for Graph Mining. SDM 2004: 442-446.
+	The edges are drawn in parallel; self-loops are discarded and multiple edges are merged.
 
-	RmatGenerator(scale, edgeFactor, a, b, c, d)
+	RmatGenerator(scale, edgeFactor, a, b, c, d, weighted=False, reduceNodes=0)
 
 	Parameters
 	----------
@@ -2329,7 +2446,9 @@ cdef class RmatGenerator:
 	d : double
 		Probability for quadrant lower right
 	weighted : bool
-		result graph weighted?
+		result graph weighted with the number of merged edges?
+	reduceNodes : count
+		Number of random nodes to delete to achieve a given node count
 	"""
 
 	cdef _RmatGenerator* _this
@@ -2908,6 +3027,55 @@ cdef class GraphToolBinaryReader(GraphReader):
 		self._this = new _GraphToolBinaryReader()
 
 
+cdef extern from "cpp/io/NetworkitBinaryReader.h":
+	cdef cppclass _NetworkitBinaryReader "NetworKit::NetworkitBinaryReader" (_GraphReader):
+		_NetworkitBinaryReader() except +
+
+cdef class NetworkitBinaryReader(GraphReader):
+	""" Reads the NetworKit binary graph format written by NetworkitBinaryWriter.
+		The file is memory-mapped, so no parsing is necessary.
+	"""
+	def __cinit__(self):
+		self._this = new _NetworkitBinaryReader()
+
+
+cdef extern from "cpp/io/DistanceMatrixReader.h":
+	cdef cppclass _DistanceMatrixReader "NetworKit::DistanceMatrixReader":
+		_DistanceMatrixReader(string path) except +
+		count numberOfRows() except +
+		count numberOfColumns() except +
+		edgeweight getDistance(index u, index v) except +
+		vector[edgeweight] getRow(index u) except +
+
+cdef class DistanceMatrixReader:
+	""" Reads a distance matrix written by TiledAPSP. The file is memory-mapped and only the
+		queried rows are read from disk. Unreachable pairs have the largest edgeweight as distance.
+
+		DistanceMatrixReader(path)
+	"""
+	cdef _DistanceMatrixReader* _this
+
+	def __cinit__(self, path):
+		self._this = new _DistanceMatrixReader(stdstring(path))
+
+	def __dealloc__(self):
+		del self._this
+
+	def numberOfRows(self):
+		return self._this.numberOfRows()
+
+	def numberOfColumns(self):
+		return self._this.numberOfColumns()
+
+	def getDistance(self, index u, index v):
+		""" Returns the distance from u to v. """
+		return self._this.getDistance(u, v)
+
+	def getRow(self, index u):
+		""" Returns the distances from u to all nodes. """
+		return self._this.getRow(u)
+
+
 cdef extern from "cpp/io/EdgeListReader.h":
 	cdef cppclass _EdgeListReader "NetworKit::EdgeListReader"(_GraphReader):
 		_EdgeListReader() except +
@@ -2990,6 +3158,25 @@ cdef class GraphToolBinaryWriter:
 			self._this.write(G._this, cpath)
 
 
+cdef extern from "cpp/io/NetworkitBinaryWriter.h":
+	cdef cppclass _NetworkitBinaryWriter "NetworKit::NetworkitBinaryWriter":
+		_NetworkitBinaryWriter() except +
+		void write(_Graph G, string path) nogil except +
+
+
+cdef class NetworkitBinaryWriter:
+	""" Writes graphs in the NetworKit binary graph format, which can be loaded
+		without parsing by NetworkitBinaryReader.
+	"""
+	cdef _NetworkitBinaryWriter _this
+
+	def write(self, Graph G not None, path):
+		 # string needs to be converted to bytes, which are coerced to std::string
+		cdef string cpath = stdstring(path)
+		with nogil:
+			self._this.write(G._this, cpath)
+
+
 cdef extern from "cpp/io/DotGraphWriter.h":
 	cdef cppclass _DotGraphWriter "NetworKit::DotGraphWriter":
 		_DotGraphWriter() except +
@@ -4958,6 +5145,104 @@ cdef class EdmondsKarp:
 		"""
 		return self._this.getFlowVector()
 
+cdef extern from "cpp/flow/PushRelabel.h":
+	cdef cppclass _PushRelabel "NetworKit::PushRelabel":
+		_PushRelabel(const _Graph &graph, node source, node sink) except +
+		void run() nogil except +
+		edgeweight getMaxFlow() const
+		vector[node] getSourceSet() except +
+		edgeweight getFlow(node u, node v) except +
+		edgeweight getFlow(edgeid eid) const
+		vector[edgeweight] getFlowVector() except +
+
+cdef class PushRelabel:
+	"""
+	The PushRelabel class implements a parallel push-relabel maximum flow algorithm with global
+	relabeling and gap heuristic. It has the same interface as EdmondsKarp and is faster on large graphs.
+	Undirected edges have their capacity in both directions; edges need to be indexed.
+
+	Parameters
+	----------
+	graph : Graph
+		The graph
+	source : node
+		The source node for the flow calculation
+	sink : node
+		The sink node for the flow calculation
+	"""
+	cdef _PushRelabel* _this
+	cdef Graph _graph
+
+	def __cinit__(self, Graph graph not None, node source, node sink):
+		self._graph = graph # store reference of graph for memory management, so the graph is not deallocated before this object
+		self._this = new _PushRelabel(graph._this, source, sink)
+
+	def __dealloc__(self):
+		del self._this
+
+	def run(self):
+		"""
+		Computes the maximum flow, executes the push-relabel algorithm
+		"""
+		with nogil:
+			self._this.run()
+		return self
+
+	def getMaxFlow(self):
+		"""
+		Returns the value of the maximum flow from source to sink.
+
+		Returns
+		-------
+		edgeweight
+			The maximum flow value
+		"""
+		return self._this.getMaxFlow()
+
+	def getSourceSet(self):
+		"""
+		Returns the set of the nodes on the source side of the flow/minimum cut.
+
+		Returns
+		-------
+		list
+			The set of nodes that form the (smallest) source side of the flow/minimum cut.
+		"""
+		return self._this.getSourceSet()
+
+	def getFlow(self, node u, node v = none):
+		"""
+		Get the flow value between two nodes u and v or an edge identified by the edge id u.
+		Warning: The variant with two edge ids is linear in the degree of u.
+
+		Parameters
+		----------
+		u : node or edgeid
+			The first node incident to the edge or the edge id
+		v : node
+			The second node incident to the edge (optional if edge id is specified)
+
+		Returns
+		-------
+		edgeweight
+			The flow on the specified edge
+		"""
+		if v == none: # Assume that node and edge ids are the same type
+			return self._this.getFlow(u)
+		else:
+			return self._this.getFlow(u, v)
+
+	def getFlowVector(self):
+		"""
+		Return a copy of the flow values of all edges.
+
+		Returns
+		-------
+		list
+			The flow values of all edges indexed by edge id
+		"""
+		return self._this.getFlowVector()
+
 # Module: properties
 
 cdef extern from "cpp/components/ConnectedComponents.h":
@@ -5068,12 +5353,66 @@ cdef class ParallelConnectedComponents:
 		return self._this.componentOfNode(v)
 
 
+cdef extern from "cpp/components/UnionFindConnectedComponents.h":
+	cdef cppclass _UnionFindConnectedComponents "NetworKit::UnionFindConnectedComponents":
+		_UnionFindConnectedComponents(_Graph G, count neighborRounds) except +
+		void run() nogil except +
+		count numberOfComponents() except +
+		count componentOfNode(node query) except +
+		_Partition getPartition() except +
+		map[index, count] getComponentSizes() except +
+
+
+cdef class UnionFindConnectedComponents:
+	""" Determines the connected components of an undirected graph in parallel
+		with a lock-free union find data structure. Most edges of a giant
+		component are skipped after linking every node to a few of its neighbors.
+		The components are numbered exactly as by ConnectedComponents.
+
+		UnionFindConnectedComponents(G, neighborRounds=2)
+
+		Parameters
+		----------
+		G : Graph
+			The graph.
+		neighborRounds : count, optional
+			Number of neighbors per node that are linked before the giant component is sampled.
+	"""
+	cdef _UnionFindConnectedComponents* _this
+	cdef Graph _G
+
+	def __cinit__(self, Graph G, neighborRounds=2):
+		self._G = G
+		self._this = new _UnionFindConnectedComponents(G._this, neighborRounds)
+
+	def __dealloc__(self):
+		del self._this
+
+	def run(self):
+		with nogil:
+			self._this.run()
+		return self
+
+	def getPartition(self):
+		return Partition().setThis(self._this.getPartition())
+
+	def numberOfComponents(self):
+		return self._this.numberOfComponents()
+
+	def componentOfNode(self, v):
+		return self._this.componentOfNode(v)
+
+	def getComponentSizes(self):
+		return self._this.getComponentSizes()
+
+
 cdef extern from "cpp/components/StronglyConnectedComponents.h":
 	cdef cppclass _StronglyConnectedComponents "NetworKit::StronglyConnectedComponents":
 		_StronglyConnectedComponents(_Graph G, bool iterativeAlgo) except +
 		void run() nogil except +
 		void runIteratively() nogil except +
 		void runRecursively() nogil except +
+		void runParallel() nogil except +
 		count numberOfComponents() except +
 		count componentOfNode(node query) except +
 		_Partition getPartition() except +
@@ -5084,7 +5423,7 @@ cdef class StronglyConnectedComponents:
 		a directed graph.
 
 		By default, the iterative implementation is used. If edges on the graph have been removed,
-		you should switch to the recursive implementation.
+		you should switch to the recursive implementation or use runParallel().
 
 		Parameters
 		----------
@@ -5118,6 +5457,14 @@ cdef class StronglyConnectedComponents:
 			self._this.runRecursively()
 		return self
 
+	def runParallel(self):
+		""" Determines the components in parallel by trimming, a forward-backward
+		search for the giant component and color propagation. The components are
+		numbered in the order of their smallest node. """
+		with nogil:
+			self._this.runParallel()
+		return self
+
 	def getPartition(self):
 		return Partition().setThis(self._this.getPartition())
 
@@ -5196,7 +5543,7 @@ cdef class ClusteringCoefficient:
 
 	@staticmethod
 	def exactGlobal(Graph G):
-		""" This calculates the global clustering coefficient. """
+		""" This calculates the global clustering coefficient. The graph must be undirected. """
 		cdef double ret
 		with nogil:
 			ret = exactGlobal(G._this)
@@ -5300,7 +5647,9 @@ cdef class EffectiveDiameterApproximation(Algorithm):
 	Calculates the effective diameter of a graph.
 	The effective diameter is defined as the number of edges on average to reach a given ratio of all other nodes.
 
-	Implementation after the ANF algorithm presented in the paper "A Fast and Scalable Tool for Data Mining in Massive Graphs"[1]
+	The sizes of the neighborhoods are estimated with HyperLogLog counters by HyperBall, an improvement of
+	the ANF algorithm presented in the paper "A Fast and Scalable Tool for Data Mining in Massive Graphs"[1].
+	The graph does not need to be connected.
 
 	[1] by Palmer, Gibbons and Faloutsos which can be found here: http://www.cs.cmu.edu/~christos/PUBLICATIONS/kdd02-anf.pdf
 
@@ -5311,9 +5660,9 @@ cdef class EffectiveDiameterApproximation(Algorithm):
 	ratio : double
 		The percentage of nodes that shall be within stepwidth, default = 0.9
 	k : count
-		number of parallel approximations, bigger k -> longer runtime, more precise result; default = 64
+		number of registers of every counter, bigger k -> longer runtime, more precise result; default = 64
 	r : count
-		number of additional bits, important in tiny graphs; default = 7
+		unused, kept for compatibility; default = 7
 	"""
 	cdef Graph _G
 
@@ -5343,7 +5692,9 @@ cdef class HopPlotApproximation(Algorithm):
 	The hop-plot is the set of pairs (d, g(g)) for each natural number d
 	and where g(d) is the fraction of connected node pairs whose shortest connecting path has length at most d.
 
-	Implementation after the ANF algorithm presented in the paper "A Fast and Scalable Tool for Data Mining in Massive Graphs"[1]
+	The sizes of the neighborhoods are estimated with HyperLogLog counters by HyperBall, an improvement of
+	the ANF algorithm presented in the paper "A Fast and Scalable Tool for Data Mining in Massive Graphs"[1].
+	The graph does not need to be connected.
 
 	[1] by Palmer, Gibbons and Faloutsos which can be found here: http://www.cs.cmu.edu/~christos/PUBLICATIONS/kdd02-anf.pdf
 
@@ -5355,9 +5706,9 @@ cdef class HopPlotApproximation(Algorithm):
 		maximum distance between considered nodes
 		set to 0 or negative to get the hop-plot for the entire graph so that each node can reach each other node
 	k : count
-		number of parallel approximations, bigger k -> longer runtime, more precise result; default = 64
+		number of registers of every counter, bigger k -> longer runtime, more precise result; default = 64
 	r : count
-		number of additional bits, important in tiny graphs; default = 7
+		unused, kept for compatibility; default = 7
 	"""
 	cdef Graph _G
 
@@ -5424,7 +5775,9 @@ cdef class NeighborhoodFunctionApproximation(Algorithm):
 	The neighborhood function N of a graph G for a given distance t is defined
 	as the number of node pairs (u,v) that can be reached within distance t.
 
-	Implementation after the ANF algorithm presented in the paper "A Fast and Scalable Tool for Data Mining in Massive Graphs"[1]
+	The sizes of the neighborhoods are estimated with HyperLogLog counters by HyperBall, an improvement of
+	the ANF algorithm presented in the paper "A Fast and Scalable Tool for Data Mining in Massive Graphs"[1].
+	The graph does not need to be connected.
 
 	[1] by Palmer, Gibbons and Faloutsos which can be found here: http://www.cs.cmu.edu/~christos/PUBLICATIONS/kdd02-anf.pdf
 
@@ -5433,9 +5786,9 @@ cdef class NeighborhoodFunctionApproximation(Algorithm):
 	G : Graph
 		The graph.
 	k : count
-		number of approximations, bigger k -> longer runtime, more precise result; default = 64
+		number of registers of every counter, bigger k -> longer runtime, more precise result; default = 64
 	r : count
-		number of additional bits, important in tiny graphs; default = 7
+		unused, kept for compatibility; default = 7
 	"""
 	cdef Graph _G
 
@@ -5452,6 +5805,69 @@ cdef class NeighborhoodFunctionApproximation(Algorithm):
 		"""
 		return (<_NeighborhoodFunctionApproximation*>(self._this)).getNeighborhoodFunction()
 
+cdef extern from "cpp/distance/HyperBall.h":
+	cdef cppclass _HyperBall "NetworKit::HyperBall"(_Algorithm):
+		_HyperBall(_Graph& G, count registers, count maxDistance) except +
+		count numberOfRounds() except +
+		vector[double] getNeighborhoodFunction() except +
+		vector[double] getReachableNodes() except +
+		vector[double] getSumOfDistances() except +
+		vector[double] getCloseness() except +
+		vector[double] getHarmonicCentrality() except +
+
+cdef class HyperBall(Algorithm):
+	"""
+	Approximates the neighborhood function and, for every node, the number of reachable
+	nodes, the sum of distances and the harmonic centrality with one HyperLogLog counter
+	per node. The graph does not need to be connected; for directed graphs the distances
+	follow the out-edges.
+
+	[1] Boldi, Vigna: In-Core Computation of Geometric Centralities with HyperBall: A Hundred Billion Nodes and Beyond. ICDMW 2013.
+
+	Parameters
+	----------
+	G : Graph
+		The graph.
+	registers : count
+		number of registers of every counter, rounded up to a power of two; the relative error is about 1.04/sqrt(registers); default = 64
+	maxDistance : count
+		stop after this many rounds, 0 for no limit; default = 0
+	"""
+	cdef Graph _G
+
+	def __cinit__(self, Graph G not None, count registers=64, count maxDistance=0):
+		self._G = G
+		self._this = new _HyperBall(G._this, registers, maxDistance)
+
+	def numberOfRounds(self):
+		""" Number of rounds in which some counter changed, an estimate of the diameter. """
+		return (<_HyperBall*>(self._this)).numberOfRounds()
+
+	def getNeighborhoodFunction(self):
+		"""
+		Returns
+		-------
+		list
+			the i-th element is the estimated number of node pairs that have a distance at most (i+1)
+		"""
+		return (<_HyperBall*>(self._this)).getNeighborhoodFunction()
+
+	def getReachableNodes(self):
+		""" Estimated number of nodes reachable from every node, excluding the node itself. """
+		return (<_HyperBall*>(self._this)).getReachableNodes()
+
+	def getSumOfDistances(self):
+		""" Estimated sum of distances from every node to the nodes reachable from it. """
+		return (<_HyperBall*>(self._this)).getSumOfDistances()
+
+	def getCloseness(self):
+		""" Estimated closeness of every node, the number of reachable nodes divided by the sum of distances to them. """
+		return (<_HyperBall*>(self._this)).getCloseness()
+
+	def getHarmonicCentrality(self):
+		""" Estimated harmonic centrality of every node, the sum of the inverse distances to all other nodes. """
+		return (<_HyperBall*>(self._this)).getHarmonicCentrality()
+
 cdef extern from "cpp/distance/NeighborhoodFunctionHeuristic.h" namespace "NetworKit::NeighborhoodFunctionHeuristic::SelectionStrategy":
 	enum _SelectionStrategy "NetworKit::NeighborhoodFunctionHeuristic::SelectionStrategy":
 		RANDOM
@@ -5735,11 +6151,11 @@ cdef class Betweenness(Centrality):
 
 cdef extern from "cpp/centrality/Closeness.h":
 	cdef cppclass _Closeness "NetworKit::Closeness" (_Centrality):
-		_Closeness(_Graph, bool, bool) except +
+		_Closeness(_Graph, bool, bool, DijkstraQueue) except +
 
 cdef class Closeness(Centrality):
 	"""
-		Closeness(G, normalized=False, checkConnectedness=True)
+		Closeness(G, normalized=False, checkConnectedness=True, queue=_DijkstraQueue.DAryHeap)
 
 		Constructs the Closeness class for the given Graph `G`. If the Closeness scores should be normalized,
   		then set `normalized` to True. The run() method takes O(nm) time, where n is the number
@@ -5753,11 +6169,13 @@ cdef class Closeness(Centrality):
 	 		Set this parameter to True if scores should be normalized in the interval [0,1]. Normalization only for unweighted networks.
 	 	checkConnectedness : bool, optional
 			turn this off if you know the graph is connected
+		queue : _DijkstraQueue, optional
+			priority queue of the Dijkstra runs on weighted graphs
 	"""
 
-	def __cinit__(self, Graph G, normalized=False, checkConnectedness=True):
+	def __cinit__(self, Graph G, normalized=False, checkConnectedness=True, queue=_DijkstraQueue.DAryHeap):
 		self._G = G
-		self._this = new _Closeness(G._this, normalized, checkConnectedness)
+		self._this = new _Closeness(G._this, normalized, checkConnectedness, queue)
 
 
 cdef extern from "cpp/centrality/KPathCentrality.h":
@@ -6123,11 +6541,9 @@ cdef class LocalClusteringCoefficient(Centrality):
 		Constructs the LocalClusteringCoefficient class for the given Graph `G`. If the local clustering coefficient values should be normalized,
 		then set `normalized` to True. The graph may not contain self-loops.
 
-		There are two algorithms available. The trivial (parallel) algorithm needs only a small amount of additional memory.
-		The turbo mode adds a (sequential, but fast) pre-processing step using ideas from [0]. This reduces the running time
-		significantly for most graphs. However, the turbo mode needs O(m) additional memory. In practice this should be a bit
-		less than half of the memory that is needed for the graph itself. The turbo mode is particularly effective for graphs
-		with nodes of very high degree and a very skewed degree distribution.
+		The triangles are listed using ideas from [0]: edges are oriented from lower to higher degree and the sorted
+		out-neighbor lists are intersected in parallel. This needs O(m) additional memory and is particularly effective for
+		graphs with nodes of very high degree and a very skewed degree distribution. It replaces the former turbo mode.
 
 		[0] Triangle Listing Algorithms: Back from the Diversion
 		Mark Ortmann and Ulrik Brandes
@@ -6138,7 +6554,7 @@ cdef class LocalClusteringCoefficient(Centrality):
 	 	G : Graph
 	 		The graph.
 		turbo : bool
-			If the turbo mode shall be activated.
+			Ignored, kept for compatibility.
 	"""
 
 	def __cinit__(self, Graph G, bool turbo = False):
@@ -6775,6 +7191,7 @@ cdef extern from "cpp/dynamics/GraphUpdater.h":
 	cdef cppclass _GraphUpdater "NetworKit::GraphUpdater":
 		_GraphUpdater(_Graph G) except +
 		void update(vector[_GraphEvent] stream) nogil except +
+		void updateBatch(vector[_GraphEvent] stream) nogil except +
 		vector[pair[count, count]] getSizeTimeline() except +
 
 cdef class GraphUpdater:
@@ -6802,6 +7219,17 @@ cdef class GraphUpdater:
 		with nogil:
 			self._this.update(_stream)
 
+	def updateBatch(self, stream):
+		""" Applies the stream with the same result as update(), but groups
+		consecutive edge events by the adjacency rows they modify and updates
+		the rows in parallel.
+		"""
+		cdef vector[_GraphEvent] _stream
+		for ev in stream:
+			_stream.push_back(_GraphEvent(ev.type, ev.u, ev.v, ev.w))
+		with nogil:
+			self._this.updateBatch(_stream)
+
 
 # Module: coarsening
 
@@ -6875,6 +7303,61 @@ cdef class MatchingCoarsening(GraphCoarsening):
 		self._this = new _MatchingCoarsening(G._this, M._this, noSelfLoops)
 
 
+cdef extern from "cpp/coarsening/CoarseningHierarchy.h":
+	cdef cppclass _CoarseningHierarchy "NetworKit::CoarseningHierarchy"(_Algorithm):
+		_CoarseningHierarchy(_Graph, count, double, count, bool) except +
+		count numberOfLevels() except +
+		_Graph getCoarseGraph(index) except +
+		vector[node] getFineToCoarseNodeMapping(index) except +
+		vector[vector[node]] getMapHierarchy() except +
+		vector[node] getFinestToCoarsestNodeMapping() except +
+
+
+cdef class CoarseningHierarchy(Algorithm):
+	"""Builds a multilevel hierarchy by repeatedly computing a heavy edge matching with
+	the parallel SuitorMatcher and contracting it.
+
+	Parameters
+	----------
+	G : Graph
+		undirected graph
+	minNodes : count, optional
+		graphs with at most this many nodes are not coarsened
+	minReduction : double, optional
+		minimum fraction of nodes a level has to remove
+	maxLevels : count, optional
+		maximum number of coarse levels, unlimited by default
+	noSelfLoops : bool, optional
+		if true, self-loops are not produced
+	"""
+	cdef Graph _G
+
+	def __cinit__(self, Graph G not None, count minNodes=1, double minReduction=0.05, maxLevels=None, bool noSelfLoops=False):
+		self._G = G
+		cdef count levels = none if maxLevels is None else maxLevels
+		self._this = new _CoarseningHierarchy(G._this, minNodes, minReduction, levels, noSelfLoops)
+
+	def numberOfLevels(self):
+		""" Number of coarse graphs, the input graph is not counted. """
+		return (<_CoarseningHierarchy*>(self._this)).numberOfLevels()
+
+	def getCoarseGraph(self, index level):
+		""" The coarse graph of the given level, 0 is the first coarsening of the input graph. """
+		return Graph(0).setThis((<_CoarseningHierarchy*>(self._this)).getCoarseGraph(level))
+
+	def getFineToCoarseNodeMapping(self, index level):
+		""" Mapping from the nodes of the previous level to the nodes of the given level. """
+		return (<_CoarseningHierarchy*>(self._this)).getFineToCoarseNodeMapping(level)
+
+	def getMapHierarchy(self):
+		""" Mappings of all levels. """
+		return (<_CoarseningHierarchy*>(self._this)).getMapHierarchy()
+
+	def getFinestToCoarsestNodeMapping(self):
+		""" Mapping from the nodes of the input graph to the nodes of the coarsest graph. """
+		return (<_CoarseningHierarchy*>(self._this)).getFinestToCoarsestNodeMapping()
+
+
 # Module: scd
 
 cdef extern from "cpp/scd/PageRankNibble.h":
@@ -6949,10 +7432,10 @@ cdef extern from "cpp/clique/MaxClique.h":
 
 cdef class MaxClique:
 	"""
-	DEPRECATED: Use clique.MaximumCliques instead.
-	
 	Exact algorithm for computing the size of the largest clique in a graph.
 	Worst-case running time is exponential, but in practice the algorithm is fairly fast.
+	Parallel branch and bound over the core-number ordering with greedy coloring bounds
+	on bitset candidate sets; all threads prune against the best clique found so far.
 	Reference: Pattabiraman et al., http://arxiv.org/pdf/1411.7460.pdf
 
 	Parameters:
@@ -7040,7 +7523,9 @@ cdef class MaximalCliques(Algorithm):
 	callback : callable
 		If a callable Python object is given, it will be called once for each
 		maximal clique. Then no cliques will be stored. The callback must accept
-		one parameter which is a list of nodes.
+		one parameter which is a list of nodes. The search is parallel, so the
+		callback may be called from several threads (one at a time, as it holds
+		the GIL) and the cliques arrive in no particular order.
 	"""
 	cdef NodeVectorCallbackWrapper* _callback;
 	cdef Graph _G
@@ -8335,7 +8820,7 @@ cdef extern from "cpp/edgescores/TriangleEdgeScore.h":
 
 cdef class TriangleEdgeScore(EdgeScore):
 	"""
-	Triangle counting.
+	Triangle counting. The graph must be undirected.
 
 	Parameters
 	----------
@@ -9112,6 +9597,25 @@ cdef class PathGrowingMatcher(Matcher):
 		else:
 			self._this = new _PathGrowingMatcher(G._this)
 
+
+cdef extern from "cpp/matching/SuitorMatcher.h":
+	cdef cppclass _SuitorMatcher "NetworKit::SuitorMatcher"(_Matcher):
+		_SuitorMatcher(_Graph) except +
+		_SuitorMatcher(_Graph, vector[double]) except +
+
+cdef class SuitorMatcher(Matcher):
+	"""
+	Parallel suitor algorithm as described by Manne and Halappanavar.
+	Computes the matching of the greedy algorithm, an approximate maximum weight
+	matching with guarantee 1/2.
+	"""
+	def __cinit__(self, Graph G not None, edgeScores=None):
+		self.G = G
+		if edgeScores:
+			self._this = new _SuitorMatcher(G._this, edgeScores)
+		else:
+			self._this = new _SuitorMatcher(G._this)
+
 # profiling
 
 def ranked(sample):
@@ -3,4 +3,4 @@
 
 __author__ = "Christian Staudt"
 
-from _NetworKit import GraphCoarsening, ParallelPartitionCoarsening, MatchingCoarsening
+from _NetworKit import GraphCoarsening, ParallelPartitionCoarsening, MatchingCoarsening, CoarseningHierarchy
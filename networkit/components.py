@@ -1 +1 @@
-from _NetworKit import ConnectedComponents, ParallelConnectedComponents, StronglyConnectedComponents
\ No newline at end of file
+from _NetworKit import ConnectedComponents, ParallelConnectedComponents, UnionFindConnectedComponents, StronglyConnectedComponents
\ No newline at end of file
@@ -347,6 +347,26 @@ Vector CSRMatrix::operator*(const Vector &vector) const {
 	return result;
 }
 
+DenseMatrix CSRMatrix::operator*(const DenseMatrix &block) const {
+	assert(nCols == block.numberOfRows());
+
+	const count k = block.numberOfColumns();
+	DenseMatrix result(nRows, k, zero);
+#pragma omp parallel for schedule(guided)
+	for (index i = 0; i < numberOfRows(); ++i) {
+		double* resultRow = result.rowData(i);
+		for (index cIdx = rowIdx[i]; cIdx < rowIdx[i+1]; ++cIdx) {
+			const double value = nonZeros[cIdx];
+			const double* blockRow = block.rowData(columnIdx[cIdx]);
+			for (index c = 0; c < k; ++c) {
+				resultRow[c] += value * blockRow[c];
+			}
+		}
+	}
+
+	return result;
+}
+
 CSRMatrix CSRMatrix::operator*(const CSRMatrix &other) const {
 	assert(nCols == other.nRows);
 
@@ -12,6 +12,7 @@
 #include "../Globals.h"
 #include "AlgebraicGlobals.h"
 #include "Vector.h"
+#include "DenseMatrix.h"
 #include "../graph/Graph.h"
 #include "../algebraic/SparseAccumulator.h"
 #include "../auxiliary/Timer.h"
@@ -276,6 +277,14 @@ public:
 	 */
 	Vector operator*(const Vector &vector) const;
 
+	/**
+	 * Multiplies this matrix with the dense @a block of column vectors and returns the result. Every row of this
+	 * matrix is traversed once for all columns of @a block, so multiplying k vectors at once reads the matrix only
+	 * once instead of k times.
+	 * @return The result of multiplying this matrix with @a block.
+	 */
+	DenseMatrix operator*(const DenseMatrix &block) const;
+
 	/**
 	 * Multiplies this matrix with @a other and returns the result in a new matrix.
 	 * @return The result of multiplying this matrix with @a other.
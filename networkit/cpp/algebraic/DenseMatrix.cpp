@@ -105,7 +105,7 @@ DenseMatrix DenseMatrix::operator-(const DenseMatrix &other) const {
 
 DenseMatrix& DenseMatrix::operator-=(const DenseMatrix &other) {
 	assert(numberOfRows() == other.numberOfRows() && numberOfColumns() == other.numberOfColumns());
-	*this = DenseMatrix::binaryOperator(*this, other, [](double val1, double val2){return val1 + val2;});
+	*this = DenseMatrix::binaryOperator(*this, other, [](double val1, double val2){return val1 - val2;});
 	return *this;
 }
 
@@ -198,13 +198,44 @@ void DenseMatrix::assign(const std::vector<index>& rowIndices, const std::vector
 	}
 }
 
+std::vector<double> DenseMatrix::columnInnerProducts(const DenseMatrix &A, const DenseMatrix &B) {
+	assert(A.nRows == B.nRows && A.nCols == B.nCols);
+	const count k = A.numberOfColumns();
+	std::vector<double> products(k, 0.0);
+#pragma omp parallel
+	{
+		std::vector<double> local(k, 0.0);
+#pragma omp for
+		for (index i = 0; i < A.numberOfRows(); ++i) {
+			const double* a = A.rowData(i);
+			const double* b = B.rowData(i);
+			for (index j = 0; j < k; ++j) {
+				local[j] += a[j] * b[j];
+			}
+		}
+#pragma omp critical
+		for (index j = 0; j < k; ++j) {
+			products[j] += local[j];
+		}
+	}
+
+	return products;
+}
+
 void DenseMatrix::LUDecomposition(DenseMatrix &matrix) {
 	assert(matrix.numberOfRows() == matrix.numberOfColumns());
-	for (index k = 0; k < matrix.numberOfRows()-1; ++k) {
-		for (index i = k+1; i < matrix.numberOfRows(); ++i) {
-			matrix.setValue(i, k, matrix(i,k) / matrix(k,k));
-			for (index j = k+1; j < matrix.numberOfRows(); ++j) {
-				matrix.setValue(i, j, matrix(i,j) - (matrix(i,k) * matrix(k,j)));
+	const count n = matrix.numberOfRows();
+	double* entries = matrix.entries.data();
+	for (index k = 0; k + 1 < n; ++k) {
+		const double* rowK = entries + k * n;
+		// the rows below k are independent of each other
+#pragma omp parallel for schedule(static) if((n - k) * (n - k) > 65536)
+		for (index i = k+1; i < n; ++i) {
+			double* rowI = entries + i * n;
+			const double factor = rowI[k] / rowK[k];
+			rowI[k] = factor;
+			for (index j = k+1; j < n; ++j) {
+				rowI[j] -= factor * rowK[j];
 			}
 		}
 	}
@@ -212,23 +243,67 @@ void DenseMatrix::LUDecomposition(DenseMatrix &matrix) {
 
 Vector DenseMatrix::LUSolve(const DenseMatrix &LU, const Vector &b) {
 	Vector x = b;
+	const count n = LU.numberOfRows();
+	const double* entries = LU.entries.data();
 
-	for (index i = 0; i < LU.numberOfRows()-1; ++i) { // forward substitution
-		for (index j = i+1; j < LU.numberOfRows(); ++j) {
-			x[j] -= x[i] * LU(j,i);
+	for (index i = 1; i < n; ++i) { // forward substitution
+		const double* rowI = entries + i * n;
+		double sum = 0.0;
+		for (index j = 0; j < i; ++j) {
+			sum += rowI[j] * x[j];
 		}
+		x[i] -= sum;
 	}
 
-	for (index i = LU.numberOfRows(); i-- > 0;) { // backward substitution
-		x[i] /= LU(i,i);
-		for (index j = 0; j < i; ++j) {
-			x[j] -= x[i] * LU(j,i);
+	for (index i = n; i-- > 0;) { // backward substitution
+		const double* rowI = entries + i * n;
+		double sum = 0.0;
+		for (index j = i+1; j < n; ++j) {
+			sum += rowI[j] * x[j];
 		}
+		x[i] = (x[i] - sum) / rowI[i];
 	}
 
 	return x;
 }
 
+DenseMatrix DenseMatrix::LUSolve(const DenseMatrix &LU, const DenseMatrix &B) {
+	assert(LU.numberOfRows() == B.numberOfRows());
+	DenseMatrix X = B;
+	const count n = LU.numberOfRows();
+	const count k = B.numberOfColumns();
+	const double* entries = LU.entries.data();
+
+	for (index i = 1; i < n; ++i) { // forward substitution
+		const double* rowI = entries + i * n;
+		double* xI = X.rowData(i);
+		for (index j = 0; j < i; ++j) {
+			const double lij = rowI[j];
+			const double* xJ = X.rowData(j);
+			for (index c = 0; c < k; ++c) {
+				xI[c] -= lij * xJ[c];
+			}
+		}
+	}
+
+	for (index i = n; i-- > 0;) { // backward substitution
+		const double* rowI = entries + i * n;
+		double* xI = X.rowData(i);
+		for (index j = i+1; j < n; ++j) {
+			const double uij = rowI[j];
+			const double* xJ = X.rowData(j);
+			for (index c = 0; c < k; ++c) {
+				xI[c] -= uij * xJ[c];
+			}
+		}
+		for (index c = 0; c < k; ++c) {
+			xI[c] /= rowI[i];
+		}
+	}
+
+	return X;
+}
+
 
 
 } /* namespace NetworKit */
@@ -134,6 +134,19 @@ public:
 	 */
 	void setValue(const index i, const index j, const double value);
 
+	/**
+	 * @return Pointer to the entries of row @a i, which are stored contiguously.
+	 */
+	inline double* rowData(const index i) {
+		return entries.data() + i * nCols;
+	}
+
+	/**
+	 * @return Pointer to the entries of row @a i, which are stored contiguously.
+	 */
+	inline const double* rowData(const index i) const {
+		return entries.data() + i * nCols;
+	}
 
 	/**
 	 * @return Row @a i of this matrix as vector.
@@ -244,6 +257,13 @@ public:
 	template<typename F>
 	void apply(const F unaryElementFunction);
 
+	/**
+	 * Computes the inner products of the corresponding columns of @a A and @a B.
+	 * @return Vector of length numberOfColumns() with the inner product of column j of @a A and column j of @a B at j.
+	 * @note @a A and @a B must have the same dimensions.
+	 */
+	static std::vector<double> columnInnerProducts(const DenseMatrix &A, const DenseMatrix &B);
+
 	/**
 	 * Decomposes the given @a matrix into lower L and upper U matrix (in-place).
 	 * @param matrix The matrix to decompose into LU.
@@ -258,6 +278,15 @@ public:
 	 */
 	static Vector LUSolve(const DenseMatrix &LU, const Vector &b);
 
+	/**
+	 * Computes the solution X to the systems @a LU * X = @a B for all columns of @a B at once, where @a LU is a matrix
+	 * decomposed into L and U. The decomposed matrix is traversed only once for all columns.
+	 * @param LU Matrix decomposed into lower L and upper U matrix.
+	 * @param B Right-hand sides, one per column.
+	 * @return Solution X to the linear equation systems LU * X = B.
+	 */
+	static DenseMatrix LUSolve(const DenseMatrix &LU, const DenseMatrix &B);
+
 	/**
 	 * Computes @a A @a binaryOp @a B on the elements of matrix @a A and matrix @a B.
 	 * @param A
@@ -9,6 +9,7 @@
 #define NETWORKIT_CPP_ALGEBRAIC_GRAPHBLAS_H_
 
 #include <limits>
+#include <omp.h>
 #include "Semirings.h"
 #include "SparseAccumulator.h"
 #include "AlgebraicGlobals.h"
@@ -188,6 +189,60 @@ void MxM(const Matrix& A, const Matrix& B, Matrix& C, F accum) {
 	C = eWiseBinOp<SemiRing, Matrix>(C, temp, accum);
 }
 
+/**
+ * Computes the matrix-matrix multiplication of @a A and @a B restricted to the sparsity pattern of @a mask. That is,
+ * C(i,j) = (A*B)(i,j) if @a mask has a nonZero at (i,j) and C(i,j) = zero otherwise. Only the masked entries are
+ * computed and stored, so the full product A*B is never materialized. The rows are computed in parallel. Note that
+ * A.numberOfColumns() must be equal to B.numberOfRows(), @a mask must have the dimensions of A*B and the zero elements
+ * must be the same. The default Semiring is the ArithmeticSemiring.
+ * @param A
+ * @param B
+ * @param mask Only the positions of the nonZeros of @a mask are used.
+ * @return The result of the multiplication A * B restricted to the nonZeros of @a mask.
+ */
+template<class SemiRing = ArithmeticSemiring, class Matrix>
+Matrix maskedMxM(const Matrix& A, const Matrix& B, const Matrix& mask) {
+	assert(A.numberOfColumns() == B.numberOfRows());
+	assert(mask.numberOfRows() == A.numberOfRows() && mask.numberOfColumns() == B.numberOfColumns());
+	assert(A.getZero() == SemiRing::zero() && B.getZero() == SemiRing::zero());
+
+	std::vector<std::vector<NetworKit::Triplet>> threadTriplets(omp_get_max_threads());
+#pragma omp parallel
+	{
+		std::vector<NetworKit::Triplet>& triplets = threadTriplets[omp_get_thread_num()];
+		std::vector<NetworKit::index> maskRow(B.numberOfColumns(), NetworKit::none); // columns j with mask(i,j) != zero
+		NetworKit::SparseAccumulator spa(B.numberOfColumns());
+
+#pragma omp for schedule(guided)
+		for (NetworKit::index i = 0; i < A.numberOfRows(); ++i) {
+			mask.forNonZeroElementsInRow(i, [&](NetworKit::index j, double) {
+				maskRow[j] = i;
+			});
+
+			A.forNonZeroElementsInRow(i, [&](NetworKit::index k, double w1) {
+				B.forNonZeroElementsInRow(k, [&](NetworKit::index j, double w2) {
+					if (maskRow[j] == i) {
+						spa.scatter(SemiRing::mult(w1,w2), j, *SemiRing::add);
+					}
+				});
+			});
+
+			spa.gather([&](NetworKit::index, NetworKit::index j, double value){
+				triplets.push_back({i,j,value});
+			});
+
+			spa.increaseRow();
+		}
+	}
+
+	std::vector<NetworKit::Triplet> triplets;
+	for (auto& t : threadTriplets) {
+		triplets.insert(triplets.end(), t.begin(), t.end());
+	}
+
+	return Matrix(A.numberOfRows(), B.numberOfColumns(), triplets, A.getZero());
+}
+
 /**
  * Computes the matrix-vector product of matrix @a A and Vector @a v. The default Semiring is the ArithmeticSemiring.
  * @param A
@@ -37,9 +37,10 @@ double Vector::length() const {
 
 double Vector::mean() const {
 	double sum = 0.0;
-	this->forElements([&](double value){
-		sum += value;
-	});
+#pragma omp parallel for reduction(+:sum) if(getDimension() > (1 << 16))
+	for (index i = 0; i < getDimension(); ++i) {
+		sum += values[i];
+	}
 
 	return sum / (double) this->getDimension();
 }
@@ -61,6 +62,7 @@ bool Vector::operator!=(const Vector &other) const {
 double Vector::innerProduct(const Vector &v1, const Vector &v2) {
 	assert(v1.getDimension() == v2.getDimension());
 	double scalar = 0.0;
+#pragma omp parallel for reduction(+:scalar) if(v1.getDimension() > (1 << 16))
 	for (index i = 0; i < v1.getDimension(); ++i) {
 		scalar += v1[i] * v2[i];
 	}
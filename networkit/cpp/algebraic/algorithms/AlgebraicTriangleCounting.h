@@ -9,6 +9,7 @@
 #define NETWORKIT_CPP_ALGEBRAIC_ALGORITHMS_ALGEBRAICTRIANGLECOUNTING_H_
 
 #include "../../base/Algorithm.h"
+#include "../GraphBLAS.h"
 
 namespace NetworKit {
 
@@ -60,14 +61,17 @@ private:
 
 template<class Matrix>
 void AlgebraicTriangleCounting<Matrix>::run() {
-	Matrix powA = A * A * A;
+	// (A^3)(i,i) = sum_j (A*A)(i,j) * A(j,i), so only the entries of A*A at the nonZeros of A^T are needed
+	Matrix transposedA = directed? A.transpose() : A;
+	Matrix closedPaths = GraphBLAS::eWiseMult(GraphBLAS::maskedMxM(A, A, transposedA), transposedA);
+	Vector diagonal = GraphBLAS::rowReduce(closedPaths);
 
 	nodeScores.clear();
 	nodeScores.resize(A.numberOfRows(), 0);
 
 #pragma omp parallel for
-	for (index i = 0; i < powA.numberOfRows(); ++i) {
-		nodeScores[i] = directed? powA(i,i) : powA(i,i) / 2.0;
+	for (index i = 0; i < diagonal.getDimension(); ++i) {
+		nodeScores[i] = directed? diagonal[i] : diagonal[i] / 2.0;
 	}
 
 	hasRun = true;
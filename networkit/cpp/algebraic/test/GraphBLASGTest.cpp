@@ -169,6 +169,65 @@ TEST_F(GraphBLASGTest, testMxMAccum) {
 	EXPECT_EQ(17, C(3,3));
 }
 
+TEST_F(GraphBLASGTest, testMaskedMxM) {
+	std::vector<Triplet> triplets = {{0,0,1}, {0,1,2}, {0,2,3}, {1,0,2}, {1,1,2}, {2,0,3}, {2,2,3}, {2,3,-1}, {3,2,-1}, {3,3,4}};
+
+	//
+	//				 1  2  3  0
+	// 				 2  2  0  0
+	// mat1 = mat2 = 3  0  3 -1
+	//				 0  0 -1  4
+	//
+	CSRMatrix mat1(4, triplets);
+	CSRMatrix mat2(4, triplets);
+
+	//
+	//			14  6  12   0
+	//			 6  8   0   0
+	// result = 12  0  19  -7
+	//			 0  0  -7  17
+	//
+	CSRMatrix result = GraphBLAS::maskedMxM(mat1, mat2, mat1);
+	ASSERT_EQ(mat1.numberOfRows(), result.numberOfRows());
+	ASSERT_EQ(mat1.numberOfColumns(), result.numberOfColumns());
+	EXPECT_EQ(mat1.nnz(), result.nnz());
+
+	EXPECT_EQ(14, result(0,0));
+	EXPECT_EQ(6, result(0,1));
+	EXPECT_EQ(12, result(0,2));
+	EXPECT_EQ(0, result(0,3));
+	EXPECT_EQ(6, result(1,0));
+	EXPECT_EQ(8, result(1,1));
+	EXPECT_EQ(0, result(1,2));
+	EXPECT_EQ(0, result(1,3));
+	EXPECT_EQ(12, result(2,0));
+	EXPECT_EQ(0, result(2,1));
+	EXPECT_EQ(19, result(2,2));
+	EXPECT_EQ(-7, result(2,3));
+	EXPECT_EQ(0, result(3,0));
+	EXPECT_EQ(0, result(3,1));
+	EXPECT_EQ(-7, result(3,2));
+	EXPECT_EQ(17, result(3,3));
+
+	// the masked product agrees with the full product on the mask for other semirings
+	std::vector<Triplet> maskTriplets = {{0,3,1}, {1,2,1}, {2,2,1}, {3,0,1}, {3,3,1}};
+	CSRMatrix mask(4, maskTriplets);
+	triplets = {{0,0,0}, {0,1,1}, {1,0,1}, {1,2,1}, {2,1,1}, {2,3,1}, {3,2,1}};
+	CSRMatrix adjacency(4, triplets, MinPlusSemiring::zero());
+
+	CSRMatrix full = GraphBLAS::MxM<MinPlusSemiring>(adjacency, adjacency);
+	CSRMatrix masked = GraphBLAS::maskedMxM<MinPlusSemiring>(adjacency, adjacency, mask);
+	for (index i = 0; i < 4; ++i) {
+		for (index j = 0; j < 4; ++j) {
+			if (mask(i,j) != mask.getZero()) {
+				EXPECT_EQ(full(i,j), masked(i,j));
+			} else {
+				EXPECT_EQ(MinPlusSemiring::zero(), masked(i,j));
+			}
+		}
+	}
+}
+
 TEST_F(GraphBLASGTest, testMxV) {
 	std::vector<Triplet> triplets;
 
@@ -120,4 +120,47 @@ TEST_F(MatricesGTest, testLaplacianMatrixOfGraph) {
 	testLaplacianOfGraph<CSRMatrix>();
 }
 
+TEST_F(MatricesGTest, testMatrixBlockProduct) {
+	CSRMatrix L = CSRMatrix::laplacianMatrix(graph);
+	const count n = L.numberOfRows();
+	DenseMatrix X(n, 5, 0.0);
+	for (index i = 0; i < n; ++i) {
+		for (index c = 0; c < 5; ++c) {
+			X.setValue(i, c, Aux::Random::real(-1.0, 1.0));
+		}
+	}
+
+	DenseMatrix Y = L * X;
+	ASSERT_EQ(n, Y.numberOfRows());
+	ASSERT_EQ(5u, Y.numberOfColumns());
+	for (index c = 0; c < 5; ++c) {
+		Vector y = L * X.column(c);
+		for (index i = 0; i < n; ++i) {
+			EXPECT_NEAR(y[i], Y(i, c), 1e-12);
+		}
+	}
+}
+
+TEST_F(MatricesGTest, testBlockLUSolve) {
+	std::vector<double> entries = {4, -1, 0, 2, -1, 5, 1, 0, 0, 1, 3, -1, 2, 0, -1, 6};
+	DenseMatrix LU(4, 4, entries);
+	DenseMatrix::LUDecomposition(LU);
+
+	DenseMatrix B(4, 3, std::vector<double>{1, 0, 2, 0, 1, -1, 3, 2, 0, -1, 0, 4});
+	DenseMatrix X = DenseMatrix::LUSolve(LU, B);
+	for (index c = 0; c < 3; ++c) {
+		Vector x = DenseMatrix::LUSolve(LU, B.column(c));
+		for (index i = 0; i < 4; ++i) {
+			EXPECT_NEAR(x[i], X(i, c), 1e-12);
+		}
+	}
+
+	DenseMatrix A(4, 4, entries);
+	DenseMatrix residual = A * X;
+	residual -= B;
+	residual.forElementsInRowOrder([&](index, index, double value) {
+		EXPECT_NEAR(0.0, value, 1e-12);
+	});
+}
+
 } /* namespace NetworKit */
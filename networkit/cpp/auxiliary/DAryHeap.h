@@ -0,0 +1,186 @@
+/*
+ * DAryHeap.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef DARYHEAP_H_
+#define DARYHEAP_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "HeapIndex.h"
+
+namespace Aux {
+
+/**
+ * Addressable d-ary min-heap with extract-min and change-key.
+ * The heap is stored in a single array and the position of every value
+ * is kept in @a Index, so changeKey does not allocate and touches
+ * O(log_d n) consecutive cache lines.
+ * Value has to be an unsigned integer type.
+ */
+template<class Key, class Value, unsigned arity = 4, class Index = DenseHeapIndex>
+class DAryHeap {
+	static_assert(arity >= 2, "arity of a heap must be at least 2");
+
+public:
+	typedef std::pair<Key, Value> ElemType;
+
+	/**
+	 * Builds an empty heap for values in [0, @a capacity).
+	 */
+	explicit DAryHeap(uint64_t capacity = 0) : index(capacity) {}
+
+	/**
+	 * Inserts @a value with priority @a key. @a value must not be in the heap yet.
+	 */
+	void insert(Key key, Value value) {
+		assert(!contains(value));
+		heap.emplace_back(key, value);
+		siftUp(heap.size() - 1);
+	}
+
+	/**
+	 * @return element with minimum key without removing it.
+	 */
+	const ElemType& top() const {
+		assert(!heap.empty());
+		return heap.front();
+	}
+
+	/**
+	 * Removes the element with minimum key and returns it.
+	 */
+	ElemType extractMin() {
+		assert(!heap.empty());
+		ElemType elem = heap.front();
+		removeAt(0);
+		return elem;
+	}
+
+	/**
+	 * Sets the key of @a value to @a newKey. If @a value is not present,
+	 * it will be inserted.
+	 */
+	void changeKey(Key newKey, Value value) {
+		uint64_t i = index.get(value);
+		if (i == Index::absent) {
+			insert(newKey, value);
+			return;
+		}
+		Key oldKey = heap[i].first;
+		heap[i].first = newKey;
+		if (newKey < oldKey) {
+			siftUp(i);
+		} else {
+			siftDown(i);
+		}
+	}
+
+	/**
+	 * Removes @a value from the heap if present.
+	 */
+	void remove(Value value) {
+		uint64_t i = index.get(value);
+		if (i != Index::absent) {
+			removeAt(i);
+		}
+	}
+
+	bool contains(Value value) const {
+		return index.get(value) != Index::absent;
+	}
+
+	/**
+	 * @return key of @a value, which has to be in the heap.
+	 */
+	Key key(Value value) const {
+		assert(contains(value));
+		return heap[index.get(value)].first;
+	}
+
+	/**
+	 * @return Number of elements in the heap.
+	 */
+	uint64_t size() const {
+		return heap.size();
+	}
+
+	bool empty() const {
+		return heap.empty();
+	}
+
+	/**
+	 * Removes all elements. Runs in time proportional to the current size,
+	 * so a heap can be reused cheaply for many searches.
+	 */
+	void clear() {
+		for (const ElemType& elem : heap) {
+			index.reset(elem.second);
+		}
+		heap.clear();
+	}
+
+private:
+	std::vector<ElemType> heap;
+	Index index;
+
+	void removeAt(uint64_t i) {
+		index.reset(heap[i].second);
+		if (i + 1 == heap.size()) {
+			heap.pop_back();
+			return;
+		}
+		Key oldKey = heap[i].first;
+		heap[i] = heap.back();
+		heap.pop_back();
+		if (heap[i].first < oldKey) {
+			siftUp(i);
+		} else {
+			siftDown(i);
+		}
+	}
+
+	void siftUp(uint64_t i) {
+		ElemType elem = heap[i];
+		while (i > 0) {
+			uint64_t parent = (i - 1) / arity;
+			if (!(elem.first < heap[parent].first)) break;
+			heap[i] = heap[parent];
+			index.set(heap[i].second, i);
+			i = parent;
+		}
+		heap[i] = elem;
+		index.set(elem.second, i);
+	}
+
+	void siftDown(uint64_t i) {
+		ElemType elem = heap[i];
+		const uint64_t n = heap.size();
+		while (true) {
+			uint64_t first = arity * i + 1;
+			if (first >= n) break;
+			uint64_t last = std::min(first + arity, n);
+			uint64_t best = first;
+			for (uint64_t c = first + 1; c < last; ++c) {
+				if (heap[c].first < heap[best].first) {
+					best = c;
+				}
+			}
+			if (!(heap[best].first < elem.first)) break;
+			heap[i] = heap[best];
+			index.set(heap[i].second, i);
+			i = best;
+		}
+		heap[i] = elem;
+		index.set(elem.second, i);
+	}
+};
+
+} /* namespace Aux */
+#endif /* DARYHEAP_H_ */
@@ -0,0 +1,15 @@
+/*
+ * HeapIndex.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include "HeapIndex.h"
+
+namespace Aux {
+
+// out-of-class definitions, needed because absent is bound to const references
+constexpr uint64_t DenseHeapIndex::absent;
+constexpr uint64_t SparseHeapIndex::absent;
+
+} /* namespace Aux */
@@ -0,0 +1,76 @@
+/*
+ * HeapIndex.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef HEAPINDEX_H_
+#define HEAPINDEX_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace Aux {
+
+/**
+ * Position index of an addressable heap for values in [0, capacity).
+ * Grows on demand if a larger value is inserted.
+ */
+class DenseHeapIndex {
+public:
+	static constexpr uint64_t absent = std::numeric_limits<uint64_t>::max();
+
+	explicit DenseHeapIndex(uint64_t capacity = 0) : pos(capacity, absent) {}
+
+	uint64_t get(uint64_t value) const {
+		return value < pos.size() ? pos[value] : absent;
+	}
+
+	void set(uint64_t value, uint64_t position) {
+		if (value >= pos.size()) {
+			pos.resize(std::max(value + 1, 2 * pos.size()), absent);
+		}
+		pos[value] = position;
+	}
+
+	void reset(uint64_t value) {
+		pos[value] = absent;
+	}
+
+private:
+	std::vector<uint64_t> pos;
+};
+
+/**
+ * Position index of an addressable heap that only stores the values
+ * which are currently in the heap. Use it if the value range is much
+ * larger than the number of elements that will ever be inserted.
+ */
+class SparseHeapIndex {
+public:
+	static constexpr uint64_t absent = std::numeric_limits<uint64_t>::max();
+
+	explicit SparseHeapIndex(uint64_t = 0) {}
+
+	uint64_t get(uint64_t value) const {
+		auto it = pos.find(value);
+		return it == pos.end() ? absent : it->second;
+	}
+
+	void set(uint64_t value, uint64_t position) {
+		pos[value] = position;
+	}
+
+	void reset(uint64_t value) {
+		pos.erase(value);
+	}
+
+private:
+	std::unordered_map<uint64_t, uint64_t> pos;
+};
+
+} /* namespace Aux */
+#endif /* HEAPINDEX_H_ */
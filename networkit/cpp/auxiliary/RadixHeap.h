@@ -0,0 +1,218 @@
+/*
+ * RadixHeap.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef RADIXHEAP_H_
+#define RADIXHEAP_H_
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "HeapIndex.h"
+
+namespace Aux {
+
+namespace RadixHeapDetails {
+
+/**
+ * Maps a non-negative key to an unsigned integer with the same order.
+ * For non-negative IEEE 754 floating point numbers the bit pattern
+ * already has this property.
+ */
+template<class Key, bool floating = std::is_floating_point<Key>::value>
+struct Bits {
+	static uint64_t of(Key key) {
+		static_assert(std::is_integral<Key>::value, "radix heap keys must be integers or floating point numbers");
+		assert(key >= 0);
+		return static_cast<uint64_t>(key);
+	}
+};
+
+template<class Key>
+struct Bits<Key, true> {
+	static_assert(sizeof(Key) <= sizeof(uint64_t), "floating point type is too wide for a radix heap");
+	typedef typename std::conditional<sizeof(Key) == sizeof(uint32_t), uint32_t, uint64_t>::type Raw;
+
+	static uint64_t of(Key key) {
+		assert(key >= 0);
+		// -0.0 has the sign bit set
+		if (key == 0) return 0;
+		Raw raw;
+		std::memcpy(&raw, &key, sizeof(Key));
+		return raw;
+	}
+};
+
+} /* namespace RadixHeapDetails */
+
+/**
+ * Addressable monotone radix heap for non-negative integer or floating point
+ * keys. Elements are kept in 65 buckets according to the highest bit in
+ * which their key differs from the last extracted minimum; every element
+ * moves to a lower bucket at most 64 times, so extractMin is amortized
+ * O(log C) for key range C and insert/changeKey are O(1).
+ *
+ * Monotone means that no key smaller than the last extracted minimum may be
+ * inserted, which is the case for Dijkstra's algorithm with non-negative
+ * edge weights. Value has to be an unsigned integer type.
+ */
+template<class Key, class Value, class Index = DenseHeapIndex>
+class RadixHeap {
+public:
+	typedef std::pair<Key, Value> ElemType;
+
+	/**
+	 * Builds an empty heap for values in [0, @a capacity).
+	 */
+	explicit RadixHeap(uint64_t capacity = 0) : index(capacity), last(0), numElems(0) {}
+
+	/**
+	 * Inserts @a value with priority @a key. @a value must not be in the heap
+	 * yet and @a key must not be smaller than the last extracted minimum.
+	 */
+	void insert(Key key, Value value) {
+		assert(!contains(value));
+		uint64_t bits = Bits::of(key);
+		assert(bits >= last);
+		push(bucketOf(bits), key, value);
+		++numElems;
+	}
+
+	/**
+	 * Removes the element with minimum key and returns it.
+	 */
+	ElemType extractMin() {
+		assert(numElems > 0);
+		if (buckets[0].empty()) {
+			refill();
+		}
+		ElemType elem = buckets[0].back();
+		buckets[0].pop_back();
+		index.reset(elem.second);
+		--numElems;
+		return elem;
+	}
+
+	/**
+	 * Sets the key of @a value to @a newKey. If @a value is not present,
+	 * it will be inserted. @a newKey must not be smaller than the last
+	 * extracted minimum.
+	 */
+	void changeKey(Key newKey, Value value) {
+		uint64_t pos = index.get(value);
+		if (pos == Index::absent) {
+			insert(newKey, value);
+			return;
+		}
+		uint64_t bits = Bits::of(newKey);
+		assert(bits >= last);
+		unlink(pos);
+		push(bucketOf(bits), newKey, value);
+	}
+
+	/**
+	 * Removes @a value from the heap if present.
+	 */
+	void remove(Value value) {
+		uint64_t pos = index.get(value);
+		if (pos != Index::absent) {
+			unlink(pos);
+			index.reset(value);
+			--numElems;
+		}
+	}
+
+	bool contains(Value value) const {
+		return index.get(value) != Index::absent;
+	}
+
+	/**
+	 * @return Number of elements in the heap.
+	 */
+	uint64_t size() const {
+		return numElems;
+	}
+
+	bool empty() const {
+		return numElems == 0;
+	}
+
+	/**
+	 * Removes all elements and resets the minimum, so that the heap can be
+	 * reused for another search.
+	 */
+	void clear() {
+		for (auto& bucket : buckets) {
+			for (const ElemType& elem : bucket) {
+				index.reset(elem.second);
+			}
+			bucket.clear();
+		}
+		last = 0;
+		numElems = 0;
+	}
+
+private:
+	typedef RadixHeapDetails::Bits<Key> Bits;
+	static constexpr unsigned numBuckets = 65;
+	// a position is stored as (slot << bucketBits) | bucket
+	static constexpr unsigned bucketBits = 7;
+
+	std::array<std::vector<ElemType>, numBuckets> buckets;
+	Index index;
+	uint64_t last;
+	uint64_t numElems;
+
+	unsigned bucketOf(uint64_t bits) const {
+		return bits == last ? 0 : 64 - __builtin_clzll(bits ^ last);
+	}
+
+	void push(unsigned b, Key key, Value value) {
+		index.set(value, (buckets[b].size() << bucketBits) | b);
+		buckets[b].emplace_back(key, value);
+	}
+
+	// removes the element at @a pos from its bucket without touching its index entry
+	void unlink(uint64_t pos) {
+		std::vector<ElemType>& bucket = buckets[pos & ((1u << bucketBits) - 1)];
+		uint64_t slot = pos >> bucketBits;
+		if (slot + 1 != bucket.size()) {
+			bucket[slot] = bucket.back();
+			index.set(bucket[slot].second, pos);
+		}
+		bucket.pop_back();
+	}
+
+	// moves the smallest non-empty bucket into lower buckets such that bucket 0 is non-empty
+	void refill() {
+		unsigned b = 1;
+		while (buckets[b].empty()) {
+			++b;
+			assert(b < numBuckets);
+		}
+		uint64_t minBits = Bits::of(buckets[b].front().first);
+		for (const ElemType& elem : buckets[b]) {
+			minBits = std::min(minBits, Bits::of(elem.first));
+		}
+		last = minBits;
+		std::vector<ElemType> moved;
+		std::swap(moved, buckets[b]);
+		for (const ElemType& elem : moved) {
+			push(bucketOf(Bits::of(elem.first)), elem.first, elem.second);
+		}
+		// hand the storage back so that the bucket does not reallocate later
+		moved.clear();
+		std::swap(moved, buckets[b]);
+	}
+};
+
+} /* namespace Aux */
+#endif /* RADIXHEAP_H_ */
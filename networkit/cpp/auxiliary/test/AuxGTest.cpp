@@ -24,6 +24,8 @@
 #include "../PrioQueue.h"
 #include "../PrioQueueForInts.h"
 #include "../BucketPQ.h"
+#include "../DAryHeap.h"
+#include "../RadixHeap.h"
 #include "../StringTools.h"
 #include "../SetIntersector.h"
 #include "../Enforce.h"
@@ -207,6 +209,83 @@ TEST_F(AuxGTest, testPriorityQueue) {
 	EXPECT_EQ(pq.size(), vec.size() - 5);
 }
 
+template<class Heap>
+static void checkMonotoneHeap(Heap& heap) {
+	// reference: current key of every value, none if absent
+	const uint64_t n = 200;
+	std::vector<double> keys(n, -1.0);
+	std::set<std::pair<double, uint64_t>> ref;
+	double last = 0.0;
+
+	for (uint64_t round = 0; round < 5000; ++round) {
+		if (ref.empty() || Aux::Random::real() < 0.6) {
+			uint64_t value = Aux::Random::integer(n - 1);
+			// keys are never smaller than the last extracted minimum
+			double key = last + Aux::Random::integer(50) * 0.5;
+			if (keys[value] >= 0) {
+				ref.erase(std::make_pair(keys[value], value));
+			}
+			keys[value] = key;
+			ref.insert(std::make_pair(key, value));
+			heap.changeKey(key, value);
+		} else {
+			auto elem = heap.extractMin();
+			EXPECT_EQ(ref.begin()->first, elem.first);
+			EXPECT_EQ(keys[elem.second], elem.first);
+			ref.erase(std::make_pair(elem.first, elem.second));
+			keys[elem.second] = -1.0;
+			last = elem.first;
+		}
+		ASSERT_EQ(ref.size(), heap.size());
+	}
+
+	heap.clear();
+	EXPECT_TRUE(heap.empty());
+	for (uint64_t value = 0; value < n; ++value) {
+		EXPECT_FALSE(heap.contains(value));
+	}
+}
+
+TEST_F(AuxGTest, testDAryHeap) {
+	Aux::Random::setSeed(42, false);
+	Aux::DAryHeap<double, uint64_t> heap(10);
+	checkMonotoneHeap(heap);
+
+	Aux::DAryHeap<double, uint64_t, 2, Aux::SparseHeapIndex> binary;
+	checkMonotoneHeap(binary);
+
+	// d-ary heaps also support increasing keys and arbitrary removals
+	Aux::DAryHeap<int, uint64_t, 3> small;
+	for (uint64_t i = 0; i < 10; ++i) {
+		small.insert(10 - i, i);
+	}
+	small.changeKey(20, 9);
+	small.remove(8);
+	EXPECT_EQ(9u, small.size());
+	EXPECT_EQ(3, small.extractMin().first);
+	EXPECT_EQ(6u, small.extractMin().second);
+	EXPECT_EQ(20, small.key(9));
+}
+
+TEST_F(AuxGTest, testRadixHeap) {
+	Aux::Random::setSeed(42, false);
+	Aux::RadixHeap<double, uint64_t> heap(10);
+	checkMonotoneHeap(heap);
+
+	Aux::RadixHeap<double, uint64_t, Aux::SparseHeapIndex> sparse;
+	checkMonotoneHeap(sparse);
+
+	Aux::RadixHeap<uint64_t, uint64_t> integers;
+	integers.insert(7, 0);
+	integers.insert(1u << 20, 1);
+	integers.insert(3, 2);
+	integers.changeKey(5, 1);
+	integers.remove(0);
+	EXPECT_EQ(std::make_pair(uint64_t(3), uint64_t(2)), integers.extractMin());
+	EXPECT_EQ(std::make_pair(uint64_t(5), uint64_t(1)), integers.extractMin());
+	EXPECT_TRUE(integers.empty());
+}
+
 TEST_F(AuxGTest, testPrioQueueForIntsWithEmptiness) {
 	// fill vector with priorities
 	std::vector<int64_t> vec = {17, 4, 1, 5, 3, 11, 9, 19, -9, 1, 4, 20, 8, 8};
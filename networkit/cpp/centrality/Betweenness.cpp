@@ -5,19 +5,18 @@
  *      Author: cls, ebergamini
  */
 
-#include <stack>
-#include <queue>
+#include <atomic>
+#include <cmath>
+#include <limits>
 #include <memory>
+#include <stdexcept>
 #include <omp.h>
 
 
 #include "Betweenness.h"
-#include "../auxiliary/PrioQueue.h"
+#include "../auxiliary/DAryHeap.h"
 #include "../auxiliary/Log.h"
 #include "../auxiliary/SignalHandling.h"
-#include "../distance/SSSP.h"
-#include "../distance/Dijkstra.h"
-#include "../distance/BFS.h"
 
 namespace NetworKit {
 
@@ -25,6 +24,103 @@ Betweenness::Betweenness(const Graph& G, bool normalized, bool computeEdgeCentra
 
 }
 
+namespace {
+
+/**
+ * Per-thread state of Brandes' algorithm. All arrays have size z and are
+ * reset only at the nodes reached from the last source, so a workspace is
+ * allocated once per thread instead of once per source.
+ */
+struct BrandesWorkspace {
+	std::vector<edgeweight> distances;
+	std::vector<double> sigma;			// number of shortest paths from the source
+	std::vector<double> dependency;
+	std::vector<node> order;			// nodes in order of non-decreasing distance
+	Aux::DAryHeap<edgeweight, node> heap;
+	std::vector<double> score;
+
+	explicit BrandesWorkspace(count z) :
+		distances(z, std::numeric_limits<edgeweight>::max()), sigma(z, 0.0), dependency(z, 0.0), heap(z), score(z, 0.0) {
+		order.reserve(z);
+	}
+
+	void bfs(const Graph& G, node s) {
+		order.push_back(s);
+		distances[s] = 0;
+		sigma[s] = 1;
+		for (index i = 0; i < order.size(); ++i) {
+			node u = order[i];
+			G.forNeighborsOf(u, [&](node v) {
+				if (distances[v] == std::numeric_limits<edgeweight>::max()) {
+					distances[v] = distances[u] + 1;
+					order.push_back(v);
+				}
+				if (distances[v] == distances[u] + 1) {
+					sigma[v] += sigma[u];
+				}
+			});
+		}
+	}
+
+	void dijkstra(const Graph& G, node s) {
+		distances[s] = 0;
+		sigma[s] = 1;
+		heap.insert(0, s);
+		while (!heap.empty()) {
+			node u = heap.extractMin().second;
+			order.push_back(u);
+			G.forNeighborsOf(u, [&](node v, edgeweight w) {
+				edgeweight d = distances[u] + w;
+				if (d < distances[v]) {
+					distances[v] = d;
+					sigma[v] = sigma[u];
+					heap.changeKey(d, v);
+				} else if (d == distances[v]) {
+					sigma[v] += sigma[u];
+				}
+			});
+		}
+	}
+
+	/**
+	 * Accumulates dependencies in order of decreasing distance. Predecessors are
+	 * not stored but recognized as in-neighbors p with distances[p] + w == distances[t].
+	 */
+	template<bool weighted, typename F>
+	void accumulate(const Graph& G, node s, F edgeScore) {
+		for (auto it = order.rbegin(); it != order.rend(); ++it) {
+			node t = *it;
+			G.forInEdgesOf(t, [&](node, node p, edgeweight w, edgeid eid) {
+				if (distances[p] + (weighted ? w : 1) == distances[t]) {
+					double c = sigma[p] / sigma[t] * (1 + dependency[t]);
+					dependency[p] += c;
+					edgeScore(eid, c);
+				}
+			});
+			if (t != s) {
+				score[t] += dependency[t];
+			}
+		}
+	}
+
+	/**
+	 * @return false if a number of shortest paths did not fit into a double.
+	 */
+	bool reset() {
+		bool finite = true;
+		for (node u : order) {
+			finite = finite && std::isfinite(sigma[u]);
+			distances[u] = std::numeric_limits<edgeweight>::max();
+			sigma[u] = 0;
+			dependency[u] = 0;
+		}
+		order.clear();
+		return finite;
+	}
+};
+
+} /* anonymous namespace */
+
 void Betweenness::run() {
 	Aux::SignalHandler handler;
 	count z = G.upperNodeIdBound();
@@ -36,71 +132,58 @@ void Betweenness::run() {
 		edgeScoreData.resize(z2);
 	}
 
-	// thread-local scores for efficient parallelism
+	// workspaces and thread-local node scores, allocated by the thread that uses them
 	count maxThreads = omp_get_max_threads();
-	std::vector<std::vector<double> > scorePerThread(maxThreads, std::vector<double>(G.upperNodeIdBound()));
-	DEBUG("score per thread: ", scorePerThread.size());
-	DEBUG("G.upperEdgeIdBound(): ", G.upperEdgeIdBound());
-	std::vector<std::vector<double> > edgeScorePerThread;
-	if (computeEdgeCentrality) {
-		edgeScorePerThread.resize(maxThreads, std::vector<double>(G.upperEdgeIdBound()));
-	}
-	DEBUG("edge score per thread: ", edgeScorePerThread.size());
-
-	auto computeDependencies = [&](node s) {
+	std::vector<std::unique_ptr<BrandesWorkspace>> workspaces(maxThreads);
+	std::atomic<bool> overflow(false);
 
-		std::vector<double> dependency(z, 0.0);
+	// edge scores are added atomically instead of keeping a copy per thread
+	auto addEdgeScore = [&](edgeid eid, double c) {
+		#pragma omp atomic
+		edgeScoreData[eid] += c;
+	};
+	auto ignoreEdgeScore = [](edgeid, double) {};
 
-		// run SSSP algorithm and keep track of everything
-		std::unique_ptr<SSSP> sssp;
-		if (G.isWeighted()) {
-			sssp.reset(new Dijkstra(G, s, true, true));
-		} else {
-			sssp.reset(new BFS(G, s, true, true));
-		}
-		if (!handler.isRunning()) return;
-		sssp->run();
+	auto computeDependencies = [&](node s) {
 		if (!handler.isRunning()) return;
-		// compute dependencies for nodes in order of decreasing distance from s
-		std::vector<node> stack = sssp->getStack();
-		while (!stack.empty()) {
-			node t = stack.back();
-			stack.pop_back();
-			for (node p : sssp->getPredecessors(t)) {
-				// workaround for integer overflow in large graphs
-				bigfloat tmp = sssp->numberOfPaths(p) / sssp->numberOfPaths(t);
-				double weight;
-				tmp.ToDouble(weight);
-				double c= weight * (1 + dependency[t]);
-				dependency[p] += c;
-				if (computeEdgeCentrality) {
-					edgeScorePerThread[omp_get_thread_num()][G.edgeId(p,t)] += c;
-				}
-
+		std::unique_ptr<BrandesWorkspace>& ws = workspaces[omp_get_thread_num()];
+		if (!ws) {
+			ws.reset(new BrandesWorkspace(z));
+		}
 
+		if (G.isWeighted()) {
+			ws->dijkstra(G, s);
+			if (computeEdgeCentrality) {
+				ws->accumulate<true>(G, s, addEdgeScore);
+			} else {
+				ws->accumulate<true>(G, s, ignoreEdgeScore);
 			}
-			if (t != s) {
-				scorePerThread[omp_get_thread_num()][t] += dependency[t];
+		} else {
+			ws->bfs(G, s);
+			if (computeEdgeCentrality) {
+				ws->accumulate<false>(G, s, addEdgeScore);
+			} else {
+				ws->accumulate<false>(G, s, ignoreEdgeScore);
 			}
 		}
+		if (!ws->reset()) {
+			overflow.store(true, std::memory_order_relaxed);
+		}
 	};
 	handler.assureRunning();
 	G.balancedParallelForNodes(computeDependencies);
 	handler.assureRunning();
+	if (overflow) {
+		throw std::overflow_error("number of shortest paths does not fit into a double");
+	}
 	DEBUG("adding thread-local scores");
 	// add up all thread-local values
-	for (const auto &local : scorePerThread) {
+	for (const auto &ws : workspaces) {
+		if (!ws) continue;
 		G.parallelForNodes([&](node v){
-			scoreData[v] += local[v];
+			scoreData[v] += ws->score[v];
 		});
 	}
-	if (computeEdgeCentrality) {
-		for (const auto &local : edgeScorePerThread) {
-			for (count i = 0; i < local.size(); i++) {
-				edgeScoreData[i] += local[i];
-			}
-		}
-	}
 	if (normalized) {
 		// divide by the number of possible pairs
 		count n = G.numberOfNodes();
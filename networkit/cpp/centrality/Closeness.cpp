@@ -15,15 +15,15 @@
 #include "../distance/SSSP.h"
 #include "../distance/Dijkstra.h"
 #include "../distance/BFS.h"
-#include "../components/ConnectedComponents.h"
+#include "../components/UnionFindConnectedComponents.h"
 
 
 namespace NetworKit {
 
-Closeness::Closeness(const Graph& G, bool normalized, bool checkConnectedness) : Centrality(G, normalized) {
+Closeness::Closeness(const Graph& G, bool normalized, bool checkConnectedness, DijkstraQueue queue) : Centrality(G, normalized), queue(queue) {
 	// TODO: extend closeness definition to make check for connectedness unnecessary
 	if (checkConnectedness) {
-		ConnectedComponents compo(G);
+		UnionFindConnectedComponents compo(G);
 		compo.run();
 		if (compo.numberOfComponents() != 1) {
 			throw std::runtime_error("Closeness is undefined on disconnected graphs");
@@ -40,9 +40,9 @@ void Closeness::run() {
 	G.parallelForNodes([&](node s) {
 		std::unique_ptr<SSSP> sssp;
 		if (G.isWeighted()) {
-			sssp.reset(new Dijkstra(G, s, true, true));
+			sssp.reset(new Dijkstra(G, s, false, false, none, queue));
 		} else {
-			sssp.reset(new BFS(G, s, true, true));
+			sssp.reset(new BFS(G, s, false, false));
 		}
 		sssp->run();
 
@@ -19,20 +19,19 @@ class LocalClusteringCoefficient: public NetworKit::Centrality {
 public:
 	/**
 	 * Constructs the LocalClusteringCoefficient class for the given Graph @a G. If the local clustering coefficient scores should be normalized,
-	 * then set @a normalized to <code>true</code>. The graph may not contain self-loops.
+	 * then set @a normalized to <code>true</code>. The graph must be undirected and may not contain self-loops.
 	 *
-	 * There are two algorithms available. The trivial (parallel) algorithm needs only a small amount of additional memory.
-	 * The turbo mode adds a (sequential, but fast) pre-processing step using ideas from [0]. This reduces the running time
-	 * significantly for most graphs. However, the turbo mode needs O(m) additional memory. In practice this should be a bit
-	 * less than half of the memory that is needed for the graph itself. The turbo mode is particularly effective for graphs
-	 * with nodes of very high degree and a very skewed degree distribution.
+	 * The triangles are listed by TriangleEnumerator using ideas from [0]: edges are oriented from
+	 * lower to higher degree and the sorted out-neighbor lists are intersected in parallel. This needs
+	 * O(m) additional memory and is particularly effective for graphs with nodes of very high degree and
+	 * a very skewed degree distribution. It replaces the former turbo mode.
 	 *
 	 * [0] Triangle Listing Algorithms: Back from the Diversion
 	 * Mark Ortmann and Ulrik Brandes                                                                          *
 	 * 2014 Proceedings of the Sixteenth Workshop on Algorithm Engineering and Experiments (ALENEX). 2014, 1-8
 	 *
 	 * @param G The graph.
-	 * @param turbo If the turbo mode shall be activated.
+	 * @param turbo Ignored, kept for compatibility.
 	 * TODO running time
 	 */
 	LocalClusteringCoefficient(const NetworKit::Graph &G, bool turbo = false);
@@ -30,6 +30,8 @@
 #include "../../generators/ErdosRenyiGenerator.h"
 #include "../../generators/DorogovtsevMendesGenerator.h"
 #include "../TopCloseness.h"
+#include "../../distance/Dijkstra.h"
+#include "../../auxiliary/Random.h"
 #include <iostream>
 #include <iomanip>
 
@@ -421,6 +423,58 @@ TEST_F(CentralityGTest, testEdgeBetweennessCentrality) {
 }
 
 
+TEST_F(CentralityGTest, testBetweennessAgainstPredecessorLists) {
+	Aux::Random::setSeed(42, false);
+	for (bool directed : {false, true}) {
+		for (bool weighted : {false, true}) {
+			Graph G(ErdosRenyiGenerator(300, 0.03, directed).generate(), weighted, directed);
+			G.indexEdges();
+			// edges added after indexing must get consistent ids as well
+			if (!G.hasEdge(0, 1)) {
+				G.addEdge(0, 1);
+			}
+			if (weighted) {
+				G.forEdges([&](node u, node v) {
+					G.setWeight(u, v, Aux::Random::integer(1, 4));
+				});
+			}
+
+			// textbook Brandes on top of the stored predecessor lists
+			std::vector<double> nodeScores(G.upperNodeIdBound(), 0.0);
+			std::vector<double> edgeScores(G.upperEdgeIdBound(), 0.0);
+			G.forNodes([&](node s) {
+				Dijkstra sssp(G, s, true, true);
+				sssp.run();
+				std::vector<double> dependency(G.upperNodeIdBound(), 0.0);
+				std::vector<node> stack = sssp.getStack();
+				while (!stack.empty()) {
+					node t = stack.back();
+					stack.pop_back();
+					for (node p : sssp.getPredecessors(t)) {
+						double c = sssp._numberOfPaths(p) / sssp._numberOfPaths(t) * (1 + dependency[t]);
+						dependency[p] += c;
+						edgeScores[G.edgeId(p, t)] += c;
+					}
+					if (t != s) {
+						nodeScores[t] += dependency[t];
+					}
+				}
+			});
+
+			Betweenness centrality(G, false, true);
+			centrality.run();
+			std::vector<double> bc = centrality.scores();
+			std::vector<double> ebc = centrality.edgeScores();
+			G.forNodes([&](node u) {
+				EXPECT_NEAR(nodeScores[u], bc[u], 1e-9 * (1 + nodeScores[u]));
+			});
+			for (edgeid e = 0; e < G.upperEdgeIdBound(); ++e) {
+				EXPECT_NEAR(edgeScores[e], ebc[e], 1e-9 * (1 + edgeScores[e]));
+			}
+		}
+	}
+}
+
 TEST_F(CentralityGTest, tryEdgeBetweennessCentrality) {
     auto path = "input/PGPgiantcompo.graph";
     METISGraphReader reader;
@@ -6,84 +6,270 @@
  */
 
 #include "MaxClique.h"
+#include "../centrality/CoreDecomposition.h"
 #include "../auxiliary/SignalHandling.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <omp.h>
 
 namespace NetworKit {
 
-MaxClique::MaxClique(const Graph& G, count lb): G(G), maxi(lb) {
+namespace {
 
-}
+// candidate sets of at most this size are represented as bitsets
+constexpr count bitsetLimit = 4096;
 
-void MaxClique::clique(std::unordered_set<node>& U, std::unordered_set<node>& currClique, count size) {
-	Aux::SignalHandler handler;
+/**
+ * Branch and bound below one start node. The candidates are ranks in the
+ * core-number ordering; small candidate sets are solved on a bitset
+ * adjacency matrix with greedy coloring bounds (Tomita and Seki's MCQ).
+ */
+class CliqueSearch {
+private:
+	const std::vector<index>& outBegin;
+	const std::vector<index>& outHead;
+	std::atomic<count>& best;
+	std::function<void(const std::vector<index>&)> improve;
 
-	if (U.empty()) {
-		if (size > maxi) {
-			maxi = size;
-			bestClique = currClique;
-			INFO("new best clique, size: ", maxi);
-//			assert(size == bestClique.size());
+	std::vector<index> clique; // ranks of the current clique
+
+	// the subproblem solved with bitsets
+	std::vector<index> local; // ranks of the local nodes
+	count words = 0;
+	std::vector<uint64_t> adjacency;
+
+	static bool empty(const std::vector<uint64_t>& set) {
+		for (uint64_t word : set) {
+			if (word) return false;
 		}
-		return;
+		return true;
 	}
 
-	while (U.size() > 0) {
-		if (! handler.isRunning()) {
-			return;
+	void buildBitsets(const std::vector<index>& candidates) {
+		local = candidates;
+		words = (local.size() + 63) / 64;
+		adjacency.assign(local.size() * words, 0);
+		for (index i = 0; i < local.size(); ++i) {
+			// out-neighbors have higher ranks, so they come after i in the sorted candidates
+			index j = i + 1;
+			for (index e = outBegin[local[i]]; e < outBegin[local[i] + 1] && j < local.size(); ++e) {
+				while (j < local.size() && local[j] < outHead[e]) ++j;
+				if (j < local.size() && local[j] == outHead[e]) {
+					adjacency[i * words + j / 64] |= uint64_t(1) << (j % 64);
+					adjacency[j * words + i / 64] |= uint64_t(1) << (i % 64);
+				}
+			}
 		}
+	}
 
-		// pruning 4
-		if (size + U.size() <= maxi) {
-			return;
+	/**
+	 * Greedy coloring of @a P; the nodes are returned in order of non-decreasing color.
+	 */
+	void colorSort(const std::vector<uint64_t>& P, std::vector<index>& order, std::vector<count>& color) const {
+		std::vector<uint64_t> uncolored(P);
+		std::vector<uint64_t> Q(words);
+		count k = 0;
+		while (!empty(uncolored)) {
+			++k;
+			Q = uncolored;
+			for (index w = 0; w < words; ++w) {
+				while (Q[w]) {
+					index bit = __builtin_ctzll(Q[w]);
+					index v = w * 64 + bit;
+					uncolored[w] &= ~(uint64_t(1) << bit);
+					Q[w] &= ~(uint64_t(1) << bit);
+					// no neighbor of v gets the same color
+					for (index x = w; x < words; ++x) {
+						Q[x] &= ~adjacency[v * words + x];
+					}
+					order.push_back(v);
+					color.push_back(k);
+				}
+			}
 		}
+	}
 
-		// extract arbitrary element from U
-		node x = (* U.begin());
-		U.erase(x);
+	void expandBitset(std::vector<uint64_t>& P) {
+		std::vector<index> order;
+		std::vector<count> color;
+		colorSort(P, order, color);
 
-		// pruning 5: compute unordered_set of nodes in U that are neighbors of x and have at least degree maxi
-		std::unordered_set<node> X;
-		G.forNeighborsOf(x, [&](node v) {
-			if ((G.degree(v) >= maxi) && (U.count(v) > 0)) {
-				X.insert(v);
+		std::vector<uint64_t> newP(words);
+		for (index i = order.size(); i-- > 0; ) {
+			// the colors bound the size of a clique within the remaining candidates
+			if (clique.size() + color[i] <= best) return;
+			index v = order[i];
+			clique.push_back(local[v]);
+			bool extendable = false;
+			for (index w = 0; w < words; ++w) {
+				newP[w] = P[w] & adjacency[v * words + w];
+				extendable = extendable || newP[w];
 			}
-		});
+			if (extendable) {
+				expandBitset(newP);
+			} else if (clique.size() > best) {
+				improve(clique);
+			}
+			clique.pop_back();
+			P[v / 64] &= ~(uint64_t(1) << (v % 64));
+		}
+	}
+
+public:
+	CliqueSearch(const std::vector<index>& outBegin, const std::vector<index>& outHead, std::atomic<count>& best,
+			std::function<void(const std::vector<index>&)> improve) :
+		outBegin(outBegin), outHead(outHead), best(best), improve(improve) {}
+
+	/**
+	 * Extends the current clique by the sorted @a candidates, which are all adjacent to it.
+	 */
+	void expand(const std::vector<index>& candidates) {
+		if (candidates.empty()) {
+			if (clique.size() > best) improve(clique);
+			return;
+		}
+		if (candidates.size() <= bitsetLimit) {
+			buildBitsets(candidates);
+			std::vector<uint64_t> P(words, 0);
+			for (index i = 0; i < local.size(); ++i) {
+				P[i / 64] |= uint64_t(1) << (i % 64);
+			}
+			expandBitset(P);
+			return;
+		}
+		// large candidate sets: branch on each candidate with the later ones that are adjacent
+		std::vector<index> newCandidates;
+		for (index i = 0; i < candidates.size(); ++i) {
+			if (clique.size() + candidates.size() - i <= best) return;
+			index v = candidates[i];
+			newCandidates.clear();
+			std::set_intersection(candidates.begin() + i + 1, candidates.end(), outHead.begin() + outBegin[v], outHead.begin() + outBegin[v + 1], std::back_inserter(newCandidates));
+			clique.push_back(v);
+			expand(newCandidates);
+			clique.pop_back();
+		}
+	}
 
-		// recursive call
-		std::unordered_set<node> extendedClique = currClique;
-		extendedClique.insert(x);
-//		assert(extendedClique.size() == size + 1);
-		clique(X, extendedClique, size + 1);
+	void start(index r, const std::vector<index>& candidates) {
+		clique.assign(1, r);
+		expand(candidates);
 	}
+};
+
+} /* namespace */
+
+MaxClique::MaxClique(const Graph& G, count lb): G(G), maxi(lb) {
+
 }
 
 void MaxClique::run() {
 	Aux::SignalHandler handler;
-	std::unordered_set<node> currClique;
+	bestClique.clear();
 
-	G.forNodes([&](node u) {
-		if (! handler.isRunning()) {
-			return;
+	// the core decomposition rejects self-loops, which never belong to a clique anyway
+	Graph loopFree;
+	if (G.numberOfSelfLoops() > 0) {
+		loopFree = G;
+		loopFree.removeSelfLoops();
+	}
+	CoreDecomposition cores(G.numberOfSelfLoops() > 0 ? loopFree : G, false, false, true);
+	cores.run();
+	const std::vector<node>& nodeOfRank = cores.getNodeOrder();
+	const count n = nodeOfRank.size();
+	std::vector<index> rank(G.upperNodeIdBound(), none);
+	std::vector<count> coreOfRank(n);
+	for (index r = 0; r < n; ++r) {
+		rank[nodeOfRank[r]] = r;
+		coreOfRank[r] = static_cast<count>(cores.score(nodeOfRank[r]));
+	}
+
+	// neighbors of higher rank, sorted; their number is bounded by the core number
+	std::vector<index> outBegin(n + 1, 0);
+	#pragma omp parallel for schedule(guided)
+	for (index r = 0; r < n; ++r) {
+		count out = 0;
+		G.forNeighborsOf(nodeOfRank[r], [&](node v) {
+			if (rank[v] > r) ++out;
+		});
+		outBegin[r + 1] = out;
+	}
+	for (index r = 0; r < n; ++r) {
+		outBegin[r + 1] += outBegin[r];
+	}
+	std::vector<index> outHead(outBegin[n]);
+	#pragma omp parallel for schedule(guided)
+	for (index r = 0; r < n; ++r) {
+		index pos = outBegin[r];
+		G.forNeighborsOf(nodeOfRank[r], [&](node v) {
+			if (rank[v] > r) outHead[pos++] = rank[v];
+		});
+		std::sort(outHead.begin() + outBegin[r], outHead.begin() + outBegin[r + 1]);
+	}
+
+	std::atomic<count> best(maxi);
+	std::vector<index> bestRanks;
+	auto improve = [&](const std::vector<index>& clique) {
+		#pragma omp critical (MaxCliqueIncumbent)
+		{
+			if (clique.size() > best) {
+				bestRanks = clique;
+				best = clique.size();
+			}
 		}
+	};
+
+	std::exception_ptr error;
+	std::atomic<bool> aborted(false);
+
+	// start with the nodes of the highest cores, they are most likely to find a large clique early
+	#pragma omp parallel
+	{
+		CliqueSearch search(outBegin, outHead, best, improve);
+		std::vector<index> candidates;
 
-		if (G.degree(u) >= maxi) { // pruning 1
-			std::unordered_set<node> U;
-			G.forNeighborsOf(u, [&](node v) {
-				if (v > u) { // pruning 2
-					if (G.degree(v) >= maxi) { // pruning 3
-						U.insert(v);
+		#pragma omp for schedule(dynamic, 1)
+		for (index i = 0; i < n; ++i) {
+			if (aborted) continue;
+			try {
+				handler.assureRunning();
+				index r = n - 1 - i;
+				// a node of core number k is only in cliques of size at most k + 1
+				if (coreOfRank[r] + 1 <= best || outBegin[r + 1] - outBegin[r] + 1 <= best) continue;
+
+				candidates.clear();
+				for (index e = outBegin[r]; e < outBegin[r + 1]; ++e) {
+					if (coreOfRank[outHead[e]] >= best) {
+						candidates.push_back(outHead[e]);
 					}
 				}
-			});
-			currClique.clear();
-			currClique.insert(u);
-//			assert(currClique.size() == 1);
-//			if (u % 4 == 0)
-//				INFO("initial recursion for ", u);
-			clique(U, currClique, 1);
+				search.start(r, candidates);
+			} catch (...) {
+				#pragma omp critical (MaxCliqueError)
+				{
+					if (!error) error = std::current_exception();
+				}
+				aborted = true;
+			}
 		}
-	});
+	}
+
+	if (error) {
+		try {
+			std::rethrow_exception(error);
+		} catch (Aux::SignalHandling::InterruptException&) {
+			// like before, an interrupted run keeps the best clique found so far
+		}
+	}
+
+	maxi = best;
+	for (index r : bestRanks) {
+		bestClique.insert(nodeOfRank[r]);
+	}
 }
 
 count MaxClique::getMaxCliqueSize() {
@@ -18,22 +18,23 @@ namespace NetworKit {
 /**
  * Exact algorithm for computing the size of the largest clique in a graph.
  * Worst-case running time is exponential, but in practice the algorithm is fairly fast.
- * Reference: Pattabiraman et al., http://arxiv.org/pdf/1411.7460.pdf
- * DEPRECATED: Use MaximalCliques instead.
+ *
+ * The nodes are ordered by core number (CoreDecomposition) and every node starts a
+ * branch and bound over its neighbors of higher order, in parallel and beginning with
+ * the highest cores. Candidate sets of up to a few thousand nodes are kept as bitsets
+ * and bounded by a greedy coloring [1]; all threads prune against the size of the best
+ * clique found so far.
+ *
+ * References:
+ * [0] Pattabiraman et al., http://arxiv.org/pdf/1411.7460.pdf
+ * [1] Tomita, Seki: An Efficient Branch-and-Bound Algorithm for Finding a Maximum Clique. DMTCS 2003.
  */
-class [[deprecated("Use MaximalCliques instead.")]]
-MaxClique {
+class MaxClique {
 protected:
 	const Graph& G;
 	count maxi;
 	std::unordered_set<node> bestClique;
 
-	/**
-	 * Subroutine that goes through every relevant clique containing a certain node in
-	 * a recursive fashion and computes the size of the largest.
-	 */
-	void clique(std::unordered_set<node>& U, std::unordered_set<node>& currClique, count size);
-
 public:
 	/**
 	 * Constructor for maximum clique algorithm.
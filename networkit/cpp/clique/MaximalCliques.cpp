@@ -2,8 +2,13 @@
 #include "../centrality/CoreDecomposition.h"
 #include "../auxiliary/SignalHandling.h"
 
+#include <atomic>
 #include <cassert>
 #include <algorithm>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <omp.h>
 
 namespace {
 	// Private implementation namespace
@@ -11,69 +16,179 @@ namespace {
 	using NetworKit::count;
 	using NetworKit::index;
 
+	// branches below the start node with at least this many candidates become tasks of their own
+	constexpr count splitThreshold = 64;
+
+	/**
+	 * The neighborhood of a start node with local ids 0, ..., d-1. Like in the whole
+	 * graph, edges are only stored in the direction of higher core numbers.
+	 */
+	struct LocalGraph {
+		std::vector<node> nodes; // global ids, sorted
+		std::vector<index> firstOut;
+		std::vector<index> head;
+	};
+
+	class MaximalCliquesImpl;
+
+	/**
+	 * One branch of the search. X and P are consecutive ranges of pxvector, which
+	 * is local to the branch, so a copy can be explored by another thread.
+	 */
+	class CliqueSearch {
+	private:
+		MaximalCliquesImpl& impl;
+		std::shared_ptr<const LocalGraph> H;
+
+		std::vector<index> pxvector;
+		std::vector<index> pxlookup;
+		std::vector<node> r;
+
+		template <typename F>
+		void forOutEdgesOf(index u, F callback) const {
+			for (index i = H->firstOut[u]; i < H->firstOut[u + 1]; ++i) {
+				callback(H->head[i]);
+			}
+		}
+
+		bool hasNeighbor(index u, index v) const {
+			for (index i = H->firstOut[u]; i < H->firstOut[u + 1]; ++i) {
+				if (H->head[i] == v) return true;
+			}
+
+			return false;
+		}
+
+		void swapNodeToPos(index u, index pos) {
+			assert(pos < pxvector.size());
+			index pxvec2 = pxvector[pos];
+			std::swap(pxvector[pxlookup[u]], pxvector[pos]);
+			pxlookup[pxvec2] = pxlookup[u];
+			pxlookup[u] = pos;
+		}
+
+		index findPivot(index xbound, index xpbound, index pbound) const;
+
+	public:
+		CliqueSearch(MaximalCliquesImpl& impl, std::shared_ptr<const LocalGraph> H, node start, const std::vector<index>& initialPX) :
+			impl(impl), H(H), pxvector(initialPX), pxlookup(initialPX.size()), r({start}) {
+			for (index i = 0; i < pxvector.size(); ++i) {
+				pxlookup[pxvector[i]] = i;
+			}
+		}
+
+		void tomita(index xbound, index xpbound, index pbound);
+
+		/**
+		 * Explores the branch and records an exception instead of throwing it.
+		 */
+		void search(index xbound, index xpbound, index pbound);
+	};
+
 	class MaximalCliquesImpl {
 	private:
 		const NetworKit::Graph& G;
 		std::vector<std::vector<node>>& result;
 		std::function<void(const std::vector<node>&)>& callback;
-		bool maximumOnly;
-		count maxFound;
 
-		std::vector<node> pxvector;
-		std::vector<node> pxlookup;
+		std::vector<std::vector<std::vector<node>>> localResults;
+		std::vector<node> maximumClique;
+
+		std::vector<index> position;
 
 		std::vector<index> firstOut;
 		std::vector<node> head;
 
+		std::atomic<bool> aborted;
+		std::exception_ptr error;
+
 	public:
+		const bool maximumOnly;
+		std::atomic<count> maxFound;
+
 		MaximalCliquesImpl(const NetworKit::Graph& G, std::vector<std::vector<node>>& result,
 				std::function<void(const std::vector<node>&)>& callback, bool maximumOnly) :
-			G(G), result(result), callback(callback), maximumOnly(maximumOnly), maxFound(0),
-			pxvector(G.numberOfNodes()), pxlookup(G.upperNodeIdBound()),
-			firstOut(G.upperNodeIdBound() + 1), head(G.numberOfEdges()) {}
-	
+			G(G), result(result), callback(callback), localResults(omp_get_max_threads()),
+			position(G.upperNodeIdBound(), NetworKit::none), firstOut(G.upperNodeIdBound() + 1),
+			aborted(false), maximumOnly(maximumOnly), maxFound(0) {}
+
 	private:
 		void buildOutGraph() {
-			index currentOut = 0;
+			G.parallelForNodes([&](node u) {
+				count outDegree = 0;
+				G.forEdgesOf(u, [&](node v) {
+					if (position[u] < position[v]) {
+						++outDegree;
+					}
+				});
+				firstOut[u + 1] = outDegree;
+			});
 			for (node u = 0; u < G.upperNodeIdBound(); ++u) {
-				firstOut[u] = currentOut;
-				if (G.hasNode(u)) {
-					index xpboundU = pxlookup[u];
-					G.forEdgesOf(u, [&](node v) {
-						if (xpboundU < pxlookup[v]) {
-							head[currentOut++] = v;
-						}
-					});
-				}
+				firstOut[u + 1] += firstOut[u];
 			}
-			firstOut[G.upperNodeIdBound()] = currentOut;
+			head.resize(firstOut[G.upperNodeIdBound()]);
+			G.parallelForNodes([&](node u) {
+				index currentOut = firstOut[u];
+				G.forEdgesOf(u, [&](node v) {
+					if (position[u] < position[v]) {
+						head[currentOut++] = v;
+					}
+				});
+			});
 		}
 
-		template <typename F>
-		void forOutEdgesOf(node u, F callback) const {
-			for (index i = firstOut[u]; i < firstOut[u + 1]; ++i) {
-				callback(head[i]);
-			}
+		count outDegree(node u) const {
+			return firstOut[u + 1] - firstOut[u];
 		}
 
-		bool hasNeighbor(node u, node v) const {
-			for (index i = firstOut[u]; i < firstOut[u + 1]; ++i) {
-				if (head[i] == v) return true;
+		/**
+		 * Lists all maximal cliques whose node of lowest core number is @a u.
+		 */
+		void searchFrom(node u) {
+			// Check if u can be the starting point of a new clique
+			// of size greater than maxFound.
+			// Note that the clique starting at u could be of
+			// size outDegree(u) + 1, but then it is still only the
+			// same size as maxFound.
+			if (maximumOnly && maxFound > outDegree(u)) {
+				return;
 			}
 
-			return false;
-		}
+			Aux::SignalHandler handler;
+			handler.assureRunning();
 
-		count outDegree(node u) const {
-			return firstOut[u + 1] - firstOut[u];
-		}
+			std::shared_ptr<LocalGraph> H = std::make_shared<LocalGraph>();
+			G.forNeighborsOf(u, [&](node v) {
+				if (v != u) H->nodes.push_back(v);
+			});
+			std::sort(H->nodes.begin(), H->nodes.end());
+			H->nodes.erase(std::unique(H->nodes.begin(), H->nodes.end()), H->nodes.end());
+
+			const count d = H->nodes.size();
+			H->firstOut.resize(d + 1);
+			for (index i = 0; i < d; ++i) {
+				H->firstOut[i] = H->head.size();
+				for (index j = firstOut[H->nodes[i]]; j < firstOut[H->nodes[i] + 1]; ++j) {
+					auto it = std::lower_bound(H->nodes.begin(), H->nodes.end(), head[j]);
+					if (it != H->nodes.end() && *it == head[j]) {
+						H->head.push_back(it - H->nodes.begin());
+					}
+				}
+			}
+			H->firstOut[d] = H->head.size();
 
-		void swapNodeToPos(node u, index pos) {
-			assert(pos < pxvector.size());
-			node pxvec2 = pxvector[pos];
-			std::swap(pxvector[pxlookup[u]], pxvector[pos]);
-			pxlookup[pxvec2] = pxlookup[u];
-			pxlookup[u] = pos;
+			// neighbors before u in the order are in X, the others in P
+			std::vector<index> initialPX;
+			initialPX.reserve(d);
+			for (index i = 0; i < d; ++i) {
+				if (position[H->nodes[i]] < position[u]) initialPX.push_back(i);
+			}
+			const count xcount = initialPX.size();
+			for (index i = 0; i < d; ++i) {
+				if (position[H->nodes[i]] > position[u]) initialPX.push_back(i);
+			}
+
+			CliqueSearch(*this, H, u, initialPX).tomita(0, xcount, d);
 		}
 
 	public:
@@ -86,287 +201,270 @@ namespace {
 
 			const auto& orderedNodes = cores.getNodeOrder();
 
-			index ii = 0;
-			for (const node u : orderedNodes) {
-				pxvector[ii] = u;
-				pxlookup[u] = ii;
-				ii += 1;
+			for (index i = 0; i < orderedNodes.size(); ++i) {
+				position[orderedNodes[i]] = i;
 			}
 
-			handler.assureRunning();
-
-#ifndef NDEBUG
-			for (auto u : orderedNodes) {
-				assert(pxvector[pxlookup[u]] == u);
-			}
-#endif
-
 			// Store out-going neighbors in the direction of higher core numbers.
 			// This means that the out-degree is bounded by the maximum core number.
 			buildOutGraph();
 
 			handler.assureRunning();
 
-			for (index iu = orderedNodes.size(); iu-- > 0; ) {
-				node u = orderedNodes[iu];
-				index xpbound = iu + 1;
+			// Every start node is a task, large branches below it spawn further tasks.
+			#pragma omp parallel
+			{
+				#pragma omp single
+				{
+					for (index iu = orderedNodes.size(); iu-- > 0; ) {
+						if (aborted) break;
+						node u = orderedNodes[iu];
+						#pragma omp task firstprivate(u)
+						guarded([&]() {
+							searchFrom(u);
+						});
+					}
+				}
+			}
 
-#ifndef NDEBUG
-				for (auto v : orderedNodes) {
-					if (v == u)
-						break;
+			if (error) {
+				std::rethrow_exception(error);
+			}
 
-					assert(pxlookup[v] < xpbound);
+			if (maximumOnly) {
+				if (!maximumClique.empty()) {
+					result.push_back(std::move(maximumClique));
 				}
-#endif
-
-				// Check if u can be the starting point of a new clique
-				// of size greater than maxFound.
-				// Note that the clique starting at u could be of
-				// size outDegree(u) + 1, but then it is still only the
-				// same size as maxFound.
-				if (maximumOnly && maxFound > outDegree(u)) {
-					swapNodeToPos(u, iu);
-					continue;
+			} else if (!callback) {
+				for (auto& local : localResults) {
+					std::move(local.begin(), local.end(), std::back_inserter(result));
 				}
+			}
+		}
 
-				count xcount = 0;
-				count pcount = 0;
-				G.forNeighborsOf(u, [&] (node v) {
-
-#ifndef NDEBUG
-					assert(pxlookup[v] >= 0);
-					assert(pxlookup[v] < pxvector.size());
-
-					assert(xcount <= xpbound);
-					assert(pcount <= pxvector.size() - xpbound);
-#endif
-
-					if (pxlookup[v] < xpbound) { // v is in X
-						swapNodeToPos(v, xpbound - xcount - 1);
-						xcount += 1;
-					} else { // v is in P
-						swapNodeToPos(v, xpbound + pcount);
-						pcount += 1;
-					}
-				});
-
-#ifndef NDEBUG
-				{ // assert all neighbors of u were stored in one range around xpbound
-
-					assert(xcount + pcount == G.degree(u));
-
-					std::vector<index> neighborPositions;
-					G.forNeighborsOf(u, [&](node v) {
-						neighborPositions.push_back(pxlookup[v]);
-						assert(pxvector[pxlookup[v]] == v);
-					});
-
-					std::sort(neighborPositions.begin(), neighborPositions.end());
-					for (index i = 0; i < neighborPositions.size(); ++i) {
-						assert(neighborPositions[i] == xpbound - xcount + i);
+		void report(const std::vector<node>& r) {
+			if (callback) {
+				callback(r);
+			} else if (!maximumOnly) {
+				localResults[omp_get_thread_num()].push_back(r);
+			} else if (r.size() > maxFound) {
+				#pragma omp critical (MaximalCliquesMaximum)
+				{
+					if (r.size() > maxFound) {
+						maximumClique = r;
+						maxFound = r.size();
 					}
 				}
-#endif
-
-				std::vector<node> r = {u};
-				tomita(xpbound - xcount, xpbound, xpbound + pcount, r);
-
-				swapNodeToPos(u, iu);
-
-				handler.assureRunning();
 			}
 		}
 
-		void tomita(index xbound, index xpbound, index pbound, std::vector<node>& r) {
-			if (xbound == pbound) { //if (X, P are empty)
-				if (callback) {
-					callback(r);
-				} else if (!maximumOnly) {
-					result.push_back(r);
-				} else if (r.size() > maxFound) {
-					result.clear();
-					result.push_back(r);
-					maxFound = r.size();
+		bool isAborted() const {
+			return aborted;
+		}
+
+		/**
+		 * Calls @a f, an exception stops the whole search and is thrown at the end of run().
+		 */
+		template <typename F>
+		void guarded(F f) {
+			if (aborted) return;
+			try {
+				f();
+			} catch (...) {
+				#pragma omp critical (MaximalCliquesError)
+				{
+					if (!error) error = std::current_exception();
 				}
-				return;
+				aborted = true;
 			}
+		}
+	};
 
-			if (xpbound == pbound) return;
+	void CliqueSearch::search(index xbound, index xpbound, index pbound) {
+		impl.guarded([&]() {
+			tomita(xbound, xpbound, pbound);
+		});
+	}
+
+	void CliqueSearch::tomita(index xbound, index xpbound, index pbound) {
+		if (xbound == pbound) { //if (X, P are empty)
+			impl.report(r);
+			return;
+		}
+
+		if (xpbound == pbound || impl.isAborted()) return;
 
 #ifndef NDEBUG
-			assert(xbound >= 0);
-			assert(xbound <= xpbound);
-			assert(xpbound <= pbound);
-			assert(pbound <= pxvector.size());
+		assert(xbound <= xpbound);
+		assert(xpbound <= pbound);
+		assert(pbound <= pxvector.size());
 #endif
 
-			Aux::SignalHandler handler;
-			handler.assureRunning();
+		index u = findPivot(xbound, xpbound, pbound);
+		std::vector<index> movedNodes;
 
-			node u = findPivot(xbound, xpbound, pbound);
-			std::vector<node> movedNodes;
+		// Find all nodes in P that are not neighbors of the pivot
+		// this step is necessary as the next loop changes pxvector,
+		// which prohibits iterating over it in the same loop.
+		std::vector<index> toCheck;
 
-			// Find all nodes in P that are not neighbors of the pivot
-			// this step is necessary as the next loop changes pxvector,
-			// which prohibits iterating over it in the same loop.
-			std::vector<node> toCheck;
-
-			// Step 1: mark all outgoing neighbors of the pivot in P
-			std::vector<bool> pivotNeighbors(pbound - xpbound);
-			forOutEdgesOf(u, [&](node v) {
-				index vpos = pxlookup[v];
-				if (vpos >= xpbound && vpos < pbound) {
-					pivotNeighbors[vpos - xpbound] = true;
-				}
-			});
+		// Step 1: mark all outgoing neighbors of the pivot in P
+		std::vector<bool> pivotNeighbors(pbound - xpbound);
+		forOutEdgesOf(u, [&](index v) {
+			index vpos = pxlookup[v];
+			if (vpos >= xpbound && vpos < pbound) {
+				pivotNeighbors[vpos - xpbound] = true;
+			}
+		});
 
-			// Step 2: for all not-yet marked notes check if they have the pivot as neighbor.
-			// If not: they are definitely a non-neighbor.
-			for (index i = xpbound; i < pbound; i++) {
-				if (!pivotNeighbors[i - xpbound]) {
-					node p = pxvector[i];
+		// Step 2: for all not-yet marked notes check if they have the pivot as neighbor.
+		// If not: they are definitely a non-neighbor.
+		for (index i = xpbound; i < pbound; i++) {
+			if (!pivotNeighbors[i - xpbound]) {
+				index p = pxvector[i];
 
-					if (!hasNeighbor(p, u)) {
-						toCheck.push_back(p);
-					}
+				if (!hasNeighbor(p, u)) {
+					toCheck.push_back(p);
 				}
 			}
+		}
 
-			for (auto pxveci : toCheck) {
-				count xcount = 0, pcount = 0;
-
-				// Group all neighbors of pxveci in P \cup X around xpbound.
-				// Step 1: collect all outgoing neighbors of pxveci
-				forOutEdgesOf(pxveci, [&](node v) {
-					if (pxlookup[v] < xpbound && pxlookup[v] >= xbound) { // v is in X
-						swapNodeToPos(v, xpbound - xcount - 1);
-						xcount += 1;
-					} else if (pxlookup[v] >= xpbound && pxlookup[v] < pbound){ // v is in P
-						swapNodeToPos(v, xpbound + pcount);
-						pcount += 1;
-					}
-				});
+		for (auto pxveci : toCheck) {
+			count xcount = 0, pcount = 0;
+
+			// Group all neighbors of pxveci in P \cup X around xpbound.
+			// Step 1: collect all outgoing neighbors of pxveci
+			forOutEdgesOf(pxveci, [&](index v) {
+				if (pxlookup[v] < xpbound && pxlookup[v] >= xbound) { // v is in X
+					swapNodeToPos(v, xpbound - xcount - 1);
+					xcount += 1;
+				} else if (pxlookup[v] >= xpbound && pxlookup[v] < pbound){ // v is in P
+					swapNodeToPos(v, xpbound + pcount);
+					pcount += 1;
+				}
+			});
 
-				// Step 2: collect all nodes in X that have not yet been collected
-				// and that have pxveci as outgoing neighbor.
-				for (index i = xbound; i < xpbound;) {
-					// stop if we have reached the collected neighbors
-					if (i == xpbound - xcount) break;
-					node x = pxvector[i];
-
-					if (hasNeighbor(x, pxveci)) {
-						swapNodeToPos(x, xpbound - xcount - 1);
-						xcount += 1;
-					} else {
-						// Advance only if we did not swap otherwise we have already
-						// a next candidate at position i.
-						++i;
-					}
+			// Step 2: collect all nodes in X that have not yet been collected
+			// and that have pxveci as outgoing neighbor.
+			for (index i = xbound; i < xpbound;) {
+				// stop if we have reached the collected neighbors
+				if (i == xpbound - xcount) break;
+				index x = pxvector[i];
+
+				if (hasNeighbor(x, pxveci)) {
+					swapNodeToPos(x, xpbound - xcount - 1);
+					xcount += 1;
+				} else {
+					// Advance only if we did not swap otherwise we have already
+					// a next candidate at position i.
+					++i;
 				}
+			}
 
-				// Step 3: collect all nodes in P that have not yet been collected
-				// and that have pxveci as outgoing neighbor.
-				for (index i = xpbound + pcount; i < pbound; ++i) {
-					node p = pxvector[i];
+			// Step 3: collect all nodes in P that have not yet been collected
+			// and that have pxveci as outgoing neighbor.
+			for (index i = xpbound + pcount; i < pbound; ++i) {
+				index p = pxvector[i];
 
-					if (hasNeighbor(p, pxveci)) {
-						swapNodeToPos(p, xpbound + pcount);
-						pcount += 1;
-					}
+				if (hasNeighbor(p, pxveci)) {
+					swapNodeToPos(p, xpbound + pcount);
+					pcount += 1;
 				}
+			}
 
-				r.push_back(pxveci);
+			r.push_back(H->nodes[pxveci]);
 
 #ifndef NDEBUG
-				assert(xpbound + pcount <= pbound);
-				assert(xpbound - xcount >= xbound);
+			assert(xpbound + pcount <= pbound);
+			assert(xpbound - xcount >= xbound);
 #endif
 
-				// only the pcount nodes in P are candidates for the clique,
-				// therefore r.size() + pcount is an upper bound for the maximum
-				// size of the clique that can still be found in this branch
-				// of the recursion.
-				if (!maximumOnly || maxFound < (r.size() + pcount)) {
-					tomita(xpbound - xcount, xpbound, xpbound + pcount, r);
+			// only the pcount nodes in P are candidates for the clique,
+			// therefore r.size() + pcount is an upper bound for the maximum
+			// size of the clique that can still be found in this branch
+			// of the recursion.
+			if (!impl.maximumOnly || impl.maxFound < (r.size() + pcount)) {
+				if (r.size() == 2 && pcount >= splitThreshold) {
+					// explore a copy of this branch in a task
+					CliqueSearch branch(*this);
+					index xb = xpbound - xcount, xpb = xpbound, pb = xpbound + pcount;
+					#pragma omp task firstprivate(branch, xb, xpb, pb)
+					branch.search(xb, xpb, pb);
+				} else {
+					tomita(xpbound - xcount, xpbound, xpbound + pcount);
 				}
+			}
 
-				r.pop_back();
+			r.pop_back();
 
-				swapNodeToPos(pxveci, xpbound);
-				xpbound += 1;
-				assert(pxvector[xpbound - 1] == pxveci);
-				movedNodes.push_back(pxveci);
-			}
+			swapNodeToPos(pxveci, xpbound);
+			xpbound += 1;
+			assert(pxvector[xpbound - 1] == pxveci);
+			movedNodes.push_back(pxveci);
+		}
 
-			for (node v : movedNodes) {
-				//move from X -> P
-				swapNodeToPos(v, xpbound - 1);
-				xpbound -= 1;
-			}
+		for (index v : movedNodes) {
+			//move from X -> P
+			swapNodeToPos(v, xpbound - 1);
+			xpbound -= 1;
+		}
 
 #ifndef NDEBUG
-			for (node v : movedNodes) {
-				assert(pxlookup[v] >= xpbound);
-				assert(pxlookup[v] < pbound);
-			}
-#endif
+		for (index v : movedNodes) {
+			assert(pxlookup[v] >= xpbound);
+			assert(pxlookup[v] < pbound);
 		}
+#endif
+	}
+
+	index CliqueSearch::findPivot(index xbound, index xpbound, index pbound) const {
+		// Counts for every node in X \cup P how many outgoing neighbors it has in P
+		std::vector<count> pivotNeighbors(pbound - xbound);
+		const count psize = pbound-xpbound;
+
+		// Step 1: for all nodes in X count how many outgoing neighbors they have in P
+		for (index i = 0; i < xpbound - xbound; i++) {
+			index u = pxvector[i + xbound];
+			forOutEdgesOf(u, [&](index v) {
+				if (pxlookup[v] >= xpbound && pxlookup[v] < pbound) {
+					++pivotNeighbors[i];
+				}
+			});
 
-		node findPivot(index xbound, index xpbound, index pbound) const {
-			// Counts for every node in X \cup P how many outgoing neighbors it has in P
-			std::vector<count> pivotNeighbors(pbound - xbound);
-			const count psize = pbound-xpbound;
+			// If a node has |P| neighbors, we cannot find a better candidate
+			if (pivotNeighbors[i] == psize) return u;
+		}
 
-			// Step 1: for all nodes in X count how many outgoing neighbors they have in P
-			for (index i = 0; i < xpbound - xbound; i++) {
-				node u = pxvector[i + xbound];
-				forOutEdgesOf(u, [&](node v) {
-					if (pxlookup[v] >= xpbound && pxlookup[v] < pbound) {
+		// Step 2: for all nodes in P
+		// a) increase counts for every neighbor in P \cup X to account for incoming neighbors
+		// b) count all outgoing neighbors in P
+		for (index i = xpbound - xbound; i < pivotNeighbors.size(); ++i) {
+			index u = pxvector[i + xbound];
+			forOutEdgesOf(u, [&](index v) {
+				index neighborPos = pxlookup[v];
+				if (neighborPos >= xbound && neighborPos < pbound) {
+					++pivotNeighbors[neighborPos-xbound];
+
+					if (neighborPos >= xpbound) {
 						++pivotNeighbors[i];
 					}
-				});
-
-				// If a node has |P| neighbors, we cannot find a better candidate
-				if (pivotNeighbors[i] == psize) return u;
-			}
-
-			// Step 2: for all nodes in P
-			// a) increase counts for every neighbor in P \cup X to account for incoming neighbors
-			// b) count all outgoing neighbors in P
-			for (index i = xpbound - xbound; i < pivotNeighbors.size(); ++i) {
-				node u = pxvector[i + xbound];
-				forOutEdgesOf(u, [&](node v) {
-					index neighborPos = pxlookup[v];
-					if (neighborPos >= xbound && neighborPos < pbound) {
-						++pivotNeighbors[neighborPos-xbound];
-
-						if (neighborPos >= xpbound) {
-							++pivotNeighbors[i];
-						}
-					}
-				});
-			}
-
-			node maxnode = pxvector[xbound];
-			count maxval = pivotNeighbors[0];
-
-			// Step 3: find maximum
-			for (index i = 1; i < pivotNeighbors.size(); ++i) {
-				if (pivotNeighbors[i] > maxval) {
-					maxval = pivotNeighbors[i];
-					maxnode = pxvector[i + xbound];
 				}
-			}
+			});
+		}
 
-#ifndef NDEBUG
-			assert(maxnode < G.upperNodeIdBound() + 1);
-#endif
+		index maxnode = pxvector[xbound];
+		count maxval = pivotNeighbors[0];
 
-			return maxnode;
+		// Step 3: find maximum
+		for (index i = 1; i < pivotNeighbors.size(); ++i) {
+			if (pivotNeighbors[i] > maxval) {
+				maxval = pivotNeighbors[i];
+				maxnode = pxvector[i + xbound];
+			}
 		}
 
-	};
+		return maxnode;
+	}
 
 }
 
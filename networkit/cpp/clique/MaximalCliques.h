@@ -23,6 +23,11 @@ namespace NetworKit {
  * The running time in practive depends on the structure of the graph. In
  * particular for complex networks it is usually quite fast, even graphs with
  * millions of edges can usually be processed in less than a minute.
+ *
+ * The search is parallel: every node of the degeneracy order starts an OpenMP
+ * task on its neighborhood, and large branches below it are split into further
+ * tasks, so idle threads pick up the remaining work. Cliques are found in no
+ * particular order.
  */
 class MaximalCliques : public Algorithm {
 
@@ -45,7 +50,10 @@ public:
 	 *
 	 * The callback is called once for each found clique with a reference to the clique.
 	 * Note that the reference is to an internal object, the callback should not assume that
-	 * this reference is still valid after it returned.
+	 * this reference is still valid after it returned. The cliques are not stored.
+	 *
+	 * The callback is called concurrently from several threads and therefore has to be
+	 * thread-safe. If it throws, the search stops and run() throws the first exception.
 	 *
 	 * @param G The graph to list cliques for
 	 * @param callback The callback to call for each clique.
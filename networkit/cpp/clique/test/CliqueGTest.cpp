@@ -7,6 +7,7 @@
 
 #include "CliqueGTest.h"
 #include "../MaxClique.h"
+#include "../MaximalCliques.h"
 #include "../../io/METISGraphReader.h"
 #include "../../io/SNAPGraphReader.h"
 #include "../../auxiliary/Log.h"
@@ -38,5 +39,49 @@ TEST_F(CliqueGTest, testMaxCliqueOnSmallerGraphs) {
 	EXPECT_EQ(4u, cliqueHamming.size());
 }
 
+TEST_F(CliqueGTest, testMaxCliqueOnLargerGraphs) {
+	METISGraphReader reader;
+	for (std::string path : {"input/hep-th.graph", "input/PGPgiantcompo.graph", "input/astro-ph.graph"}) {
+		Graph G = reader.read(path);
+
+		MaxClique mc(G);
+		mc.run();
+		std::unordered_set<node> clique = mc.getMaxClique();
+		EXPECT_EQ(mc.getMaxCliqueSize(), clique.size());
+		for (node u : clique) {
+			for (node v : clique) {
+				EXPECT_TRUE(u == v || G.hasEdge(u, v)) << "not a clique in " << path;
+			}
+		}
+
+		MaximalCliques reference(G, true);
+		reference.run();
+		EXPECT_EQ(reference.getCliques().front().size(), mc.getMaxCliqueSize()) << "maximum clique size on graph " << path << " is not correct";
+	}
+}
+
+TEST_F(CliqueGTest, testMaxCliqueWithSelfLoops) {
+	METISGraphReader reader;
+	Graph G = reader.read("input/jazz.graph");
+	MaxClique loopFree(G);
+	loopFree.run();
+
+	// self-loops do not change the maximum clique
+	Graph H(G);
+	node u = *loopFree.getMaxClique().begin();
+	H.addEdge(u, u);
+	H.addEdge(u == 0 ? 1 : 0, u == 0 ? 1 : 0);
+	MaxClique withLoops(H);
+	withLoops.run();
+	EXPECT_EQ(loopFree.getMaxCliqueSize(), withLoops.getMaxCliqueSize());
+	std::unordered_set<node> clique = withLoops.getMaxClique();
+	EXPECT_EQ(withLoops.getMaxCliqueSize(), clique.size());
+	for (node v : clique) {
+		for (node w : clique) {
+			EXPECT_TRUE(v == w || H.hasEdge(v, w));
+		}
+	}
+	EXPECT_EQ(2u, H.numberOfSelfLoops());
+}
 
 } /* namespace NetworKit */
@@ -7,6 +7,8 @@
 #include "../../auxiliary/Log.h"
 #include "../../auxiliary/Timer.h"
 
+#include <algorithm>
+
 #ifndef NOGTEST
 
 namespace NetworKit {
@@ -88,25 +90,29 @@ TEST_F(MaximalCliquesGTest, testMaximalCliquesWithCallback) {
 
 	count numCliques = 0;
 	MaximalCliques clique(G, [&](const std::vector<node>& cliq) {
-		++numCliques;
+		// the callback is called concurrently
+		#pragma omp critical
+		{
+			++numCliques;
 
-		for (node u : cliq) {
-			inClique[u] = true;
-		}
+			for (node u : cliq) {
+				inClique[u] = true;
+			}
 
-		const count expected_degree = cliq.size() - 1;
+			const count expected_degree = cliq.size() - 1;
 
-		for (node u : cliq) {
-			count neighborsInClique = 0;
-			G.forNeighborsOf(u, [&](node v) {
-				neighborsInClique += inClique[v];
-			});
+			for (node u : cliq) {
+				count neighborsInClique = 0;
+				G.forNeighborsOf(u, [&](node v) {
+					neighborsInClique += inClique[v];
+				});
 
-			EXPECT_EQ(expected_degree, neighborsInClique);
-		}
+				EXPECT_EQ(expected_degree, neighborsInClique);
+			}
 
-		for (node u : cliq) {
-			inClique[u] = false;
+			for (node u : cliq) {
+				inClique[u] = false;
+			}
 		}
 	});
 
@@ -117,6 +123,51 @@ TEST_F(MaximalCliquesGTest, testMaximalCliquesWithCallback) {
 	EXPECT_GT(numCliques, 1u);
 }
 
+TEST_F(MaximalCliquesGTest, testMaximalCliquesCallbackMatchesStored) {
+
+	METISGraphReader reader;
+	Graph G = reader.read("input/hep-th.graph");
+
+	std::vector<std::vector<node>> streamed;
+	MaximalCliques streaming(G, [&](const std::vector<node>& cliq) {
+		std::vector<node> sorted(cliq);
+		std::sort(sorted.begin(), sorted.end());
+		#pragma omp critical
+		streamed.push_back(std::move(sorted));
+	});
+	streaming.run();
+
+	MaximalCliques storing(G);
+	storing.run();
+	std::vector<std::vector<node>> stored = storing.getCliques();
+	for (auto& cliq : stored) {
+		std::sort(cliq.begin(), cliq.end());
+	}
+
+	std::sort(streamed.begin(), streamed.end());
+	std::sort(stored.begin(), stored.end());
+	EXPECT_EQ(stored, streamed);
+	EXPECT_TRUE(std::adjacent_find(stored.begin(), stored.end()) == stored.end()) << "a clique was found twice";
+
+	// no clique can be extended by a common neighbor
+	count maxSize = 0;
+	for (const auto& cliq : stored) {
+		maxSize = std::max<count>(maxSize, cliq.size());
+		G.forNeighborsOf(cliq.front(), [&](node v) {
+			bool extends = !std::binary_search(cliq.begin(), cliq.end(), v);
+			for (node u : cliq) {
+				extends = extends && G.hasEdge(u, v);
+			}
+			EXPECT_FALSE(extends);
+		});
+	}
+
+	MaximalCliques maximum(G, true);
+	maximum.run();
+	ASSERT_EQ(1u, maximum.getCliques().size());
+	EXPECT_EQ(maxSize, maximum.getCliques().front().size());
+}
+
 TEST_F(MaximalCliquesGTest, benchMaximalCliques) {
 	std::string graphPath;
 
@@ -132,9 +183,12 @@ TEST_F(MaximalCliquesGTest, benchMaximalCliques) {
 	count numCliques = 0;
 	count maxSize = 0;
 	MaximalCliques clique(G, [&](const std::vector<node>& clique) {
-		++numCliques;
-		if (clique.size() > maxSize) {
-			maxSize = clique.size();
+		#pragma omp critical
+		{
+			++numCliques;
+			if (clique.size() > maxSize) {
+				maxSize = clique.size();
+			}
 		}
 	});
 	timer.start();
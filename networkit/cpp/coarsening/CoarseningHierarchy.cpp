@@ -0,0 +1,90 @@
+/*
+ * CoarseningHierarchy.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include "CoarseningHierarchy.h"
+#include "MatchingCoarsening.h"
+#include "../matching/SuitorMatcher.h"
+#include "../auxiliary/Log.h"
+
+namespace NetworKit {
+
+CoarseningHierarchy::CoarseningHierarchy(const Graph& G, count minNodes, double minReduction, count maxLevels, bool noSelfLoops) : G(G), minNodes(minNodes), minReduction(minReduction), maxLevels(maxLevels), noSelfLoops(noSelfLoops) {
+	if (G.isDirected()) throw std::runtime_error("Only defined for undirected graphs.");
+}
+
+void CoarseningHierarchy::run() {
+	levels.clear();
+	mapHierarchy.clear();
+
+	while (levels.size() < maxLevels) {
+		const Graph& fine = levels.empty() ? G : levels.back();
+		count n = fine.numberOfNodes();
+		if (n <= minNodes) {
+			break;
+		}
+
+		SuitorMatcher matcher(fine);
+		matcher.run();
+		Matching M = matcher.getMatching();
+
+		MatchingCoarsening coarsening(fine, M, noSelfLoops);
+		coarsening.run();
+		Graph coarse = coarsening.getCoarseGraph();
+
+		count cn = coarse.numberOfNodes();
+		DEBUG("coarsened level ", levels.size(), " from ", n, " to ", cn, " nodes");
+		if ((double) (n - cn) < minReduction * n || cn == n) {
+			break;
+		}
+		mapHierarchy.push_back(coarsening.getFineToCoarseNodeMapping());
+		levels.push_back(std::move(coarse));
+	}
+
+	hasRun = true;
+}
+
+count CoarseningHierarchy::numberOfLevels() const {
+	assureFinished();
+	return levels.size();
+}
+
+const Graph& CoarseningHierarchy::getCoarseGraph(index level) const {
+	assureFinished();
+	return levels.at(level);
+}
+
+const std::vector<node>& CoarseningHierarchy::getFineToCoarseNodeMapping(index level) const {
+	assureFinished();
+	return mapHierarchy.at(level);
+}
+
+const std::vector<std::vector<node> >& CoarseningHierarchy::getMapHierarchy() const {
+	assureFinished();
+	return mapHierarchy;
+}
+
+std::vector<node> CoarseningHierarchy::getFinestToCoarsestNodeMapping() const {
+	assureFinished();
+	std::vector<node> mapping(G.upperNodeIdBound(), none);
+	G.parallelForNodes([&](node u) {
+		node v = u;
+		for (const std::vector<node>& level : mapHierarchy) {
+			v = level[v];
+		}
+		mapping[u] = v;
+	});
+	return mapping;
+}
+
+std::string CoarseningHierarchy::toString() const {
+	return "CoarseningHierarchy";
+}
+
+bool CoarseningHierarchy::isParallel() const {
+	return true;
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,80 @@
+/*
+ * CoarseningHierarchy.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef COARSENINGHIERARCHY_H_
+#define COARSENINGHIERARCHY_H_
+
+#include "../graph/Graph.h"
+#include "../base/Algorithm.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup coarsening
+ * Builds a multilevel hierarchy of an undirected graph by repeatedly computing a heavy
+ * edge matching with the parallel SuitorMatcher and contracting it with MatchingCoarsening.
+ * Edge weights of the coarse graphs are the sums of the contracted edges, so later levels
+ * prefer to match strongly connected nodes.
+ *
+ * Coarsening stops when the graph has at most @a minNodes nodes, when a level removes
+ * less than a fraction @a minReduction of the nodes (that level is discarded) or after
+ * @a maxLevels levels.
+ */
+class CoarseningHierarchy : public Algorithm {
+public:
+	/**
+	 * @param G Undirected graph to be coarsened.
+	 * @param minNodes Do not coarsen graphs with at most this many nodes.
+	 * @param minReduction Minimum fraction of nodes a level has to remove.
+	 * @param maxLevels Maximum number of coarse levels.
+	 * @param noSelfLoops If true, the edges inside a matched pair are dropped instead of becoming self-loops.
+	 */
+	CoarseningHierarchy(const Graph& G, count minNodes = 1, double minReduction = 0.05, count maxLevels = none, bool noSelfLoops = false);
+
+	virtual void run();
+
+	/**
+	 * @return Number of coarse graphs, the input graph is not counted.
+	 */
+	count numberOfLevels() const;
+
+	/**
+	 * @return The coarse graph of level @a level, 0 is the first coarsening of the input graph.
+	 */
+	const Graph& getCoarseGraph(index level) const;
+
+	/**
+	 * @return Mapping from the nodes of the previous level (the input graph for level 0) to the nodes of level @a level.
+	 */
+	const std::vector<node>& getFineToCoarseNodeMapping(index level) const;
+
+	/**
+	 * @return Mappings of all levels in the format of ClusteringProjector::projectBackToFinest.
+	 */
+	const std::vector<std::vector<node> >& getMapHierarchy() const;
+
+	/**
+	 * @return Mapping from the nodes of the input graph to the nodes of the coarsest graph.
+	 */
+	std::vector<node> getFinestToCoarsestNodeMapping() const;
+
+	virtual std::string toString() const;
+
+	virtual bool isParallel() const;
+
+private:
+	const Graph& G;
+	count minNodes;
+	double minReduction;
+	count maxLevels;
+	bool noSelfLoops;
+
+	std::vector<Graph> levels;
+	std::vector<std::vector<node> > mapHierarchy;
+};
+
+} /* namespace NetworKit */
+#endif /* COARSENINGHIERARCHY_H_ */
@@ -6,6 +6,9 @@
  */
 
 #include "MatchingCoarsening.h"
+#include "../graph/GraphBuilder.h"
+
+#include <algorithm>
 
 namespace NetworKit {
 
@@ -14,42 +17,67 @@ MatchingCoarsening::MatchingCoarsening(const Graph& G, const Matching& M, bool n
 }
 
 void MatchingCoarsening::run() {
-	count n = G.numberOfNodes();
-	index z = G.upperNodeIdBound();
-	count cn = n - M.size(G);
-	Graph cG(cn, true);
+	const index z = G.upperNodeIdBound();
 
-	// compute map: old ID -> new coarse ID
-	index idx = 0;
+	// a node is carried over to the coarse graph if it is unmatched or the smaller one of its pair,
+	// coarse ids are assigned in the order of the fine ids
 	std::vector<node> mapFineToCoarse(z, none);
-	G.forNodes([&](node v) { // TODO: difficult in parallel
+	std::vector<node> coarseToFine;
+	coarseToFine.reserve(G.numberOfNodes() - M.size(G));
+	G.forNodes([&](node v) {
 		index mate = M.mate(v);
 		if (mate == v) DEBUG("Node ", v, " is its own matching!");
 		assert(mate != v);
 		if ((mate == none) || (v < mate)) {
-			// vertex v is carried over to the new level
-			mapFineToCoarse[v] = idx;
-			++idx;
+			mapFineToCoarse[v] = coarseToFine.size();
+			coarseToFine.push_back(v);
 		}
-		else {
+	});
+	const count cn = coarseToFine.size();
+	G.parallelForNodes([&](node v) {
+		index mate = M.mate(v);
+		if ((mate != none) && (mate < v)) {
 			// vertex v is not carried over, receives ID of mate
 			mapFineToCoarse[v] = mapFineToCoarse[mate];
 		}
-		assert(mapFineToCoarse[v] != none);
-		assert(mapFineToCoarse[v] < cn);
 	});
 
-	G.forNodes([&](node v) { // TODO: difficult in parallel
-		G.forNeighborsOf(v, [&](node u, edgeweight ew) {
-			node cv = mapFineToCoarse[v];
-			node cu = mapFineToCoarse[u];
-			if ((v <= u) && (! noSelfLoops || (cv != cu))) {
-				cG.increaseWeight(cv, cu, ew);
+	GraphBuilder b(cn, true, false);
+	#pragma omp parallel
+	{
+		std::vector<std::pair<node, edgeweight> > edges;
+		#pragma omp for schedule(guided)
+		for (index cv = 0; cv < cn; ++cv) {
+			edges.clear();
+			auto collect = [&](node v) {
+				G.forNeighborsOf(v, [&](node u, edgeweight ew) {
+					node cu = mapFineToCoarse[u];
+					// the edges inside a pair are seen from both of its nodes
+					if ((cu != cv || v <= u) && (! noSelfLoops || (cu != cv))) {
+						edges.emplace_back(cu, ew);
+					}
+				});
+			};
+			const node v = coarseToFine[cv];
+			collect(v);
+			const index mate = M.mate(v);
+			if (mate != none) {
+				collect(mate);
 			}
-		});
-	});
 
-	Gcoarsened = std::move(cG);
+			std::sort(edges.begin(), edges.end());
+			for (index i = 0; i < edges.size(); ) {
+				node cu = edges[i].first;
+				edgeweight ew = 0;
+				for (; i < edges.size() && edges[i].first == cu; ++i) {
+					ew += edges[i].second;
+				}
+				b.addHalfEdge(cv, cu, ew);
+			}
+		}
+	}
+
+	Gcoarsened = b.toGraph(false);
 	nodeMapping = std::move(mapFineToCoarse);
 
 	hasRun = true;
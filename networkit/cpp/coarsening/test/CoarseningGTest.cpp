@@ -18,6 +18,7 @@
 #include "../../io/METISGraphReader.h"
 #include "../../matching/LocalMaxMatcher.h"
 #include "../MatchingCoarsening.h"
+#include "../CoarseningHierarchy.h"
 
 namespace NetworKit {
 
@@ -270,6 +271,46 @@ TEST_F(CoarseningGTest, testMatchingContractorWithSelfLoop) {
     EXPECT_EQ(G.totalEdgeWeight(), coarseG.totalEdgeWeight());
 }
 
+TEST_F(CoarseningGTest, testCoarseningHierarchy) {
+	METISGraphReader reader;
+	Graph G = reader.read("input/PGPgiantcompo.graph");
+
+	CoarseningHierarchy hierarchy(G, 100);
+	hierarchy.run();
+	ASSERT_GT(hierarchy.numberOfLevels(), 1u);
+	EXPECT_EQ(hierarchy.getMapHierarchy().size(), hierarchy.numberOfLevels());
+
+	const Graph* fine = &G;
+	for (index level = 0; level < hierarchy.numberOfLevels(); ++level) {
+		const Graph& coarse = hierarchy.getCoarseGraph(level);
+		const std::vector<node>& mapping = hierarchy.getFineToCoarseNodeMapping(level);
+		EXPECT_LT(coarse.numberOfNodes(), fine->numberOfNodes());
+		EXPECT_GE(coarse.numberOfNodes(), (fine->numberOfNodes() + 1) / 2);
+		EXPECT_NEAR(G.totalEdgeWeight(), coarse.totalEdgeWeight(), 1e-6);
+		EXPECT_TRUE(coarse.checkConsistency());
+		fine->forNodes([&](node u) {
+			ASSERT_LT(mapping[u], coarse.numberOfNodes());
+		});
+		fine = &coarse;
+	}
+
+	std::vector<node> finestToCoarsest = hierarchy.getFinestToCoarsestNodeMapping();
+	G.forNodes([&](node u) {
+		node v = u;
+		for (index level = 0; level < hierarchy.numberOfLevels(); ++level) {
+			v = hierarchy.getFineToCoarseNodeMapping(level)[v];
+		}
+		EXPECT_EQ(v, finestToCoarsest[u]);
+	});
+
+	// an empty matching leaves the graph as it is
+	Matching empty(hierarchy.getCoarseGraph(0).upperNodeIdBound());
+	MatchingCoarsening coarsening(hierarchy.getCoarseGraph(0), empty);
+	coarsening.run();
+	EXPECT_EQ(hierarchy.getCoarseGraph(0).numberOfNodes(), coarsening.getCoarseGraph().numberOfNodes());
+	EXPECT_NEAR(G.totalEdgeWeight(), coarsening.getCoarseGraph().totalEdgeWeight(), 1e-6);
+}
+
 } /* namespace NetworKit */
 
 #endif /*NOGTEST */
@@ -3,7 +3,7 @@
  */
 
 #include "CutClustering.h"
-#include "../flow/EdmondsKarp.h"
+#include "../flow/PushRelabel.h"
 #include "../components/ConnectedComponents.h"
 #include "../auxiliary/Log.h"
 
@@ -30,7 +30,7 @@ void NetworKit::CutClustering::run() {
 		}
 	});
 
-	// Index edges (needed by Edmonds-Karp implementation)
+	// Index edges (needed by the max-flow implementation)
 	graph.indexEdges();
 
 	// sort nodes by degree, this (heuristically) reduces the number of needed cut calculations
@@ -65,7 +65,7 @@ void NetworKit::CutClustering::run() {
 		// is already in a cluster will always produce a source side that is completely
 		// contained in its cluster
 		if (!result.contains(u)) {
-			EdmondsKarp flowAlgo(graph, u, t);
+			PushRelabel flowAlgo(graph, u, t);
 			flowAlgo.run();
 			std::vector<node> sourceSet(flowAlgo.getSourceSet());
 
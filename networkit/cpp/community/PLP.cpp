@@ -7,6 +7,7 @@
 
 #include "PLP.h"
 
+#include <atomic>
 #include <omp.h>
 #include "../Globals.h"
 #include "../auxiliary/Log.h"
@@ -60,8 +61,24 @@ void PLP::run() {
 	 * In general this does not work. It was changed to: No label was changed in last iteration.
 	 */
 
-	std::vector<bool> activeNodes(z); // record if node must be processed
-	activeNodes.assign(z, true);
+	// nodes that must be processed in the current round; a node becomes active again if a neighbor changed its label
+	std::vector<node> activeNodes;
+	activeNodes.reserve(n);
+	G.forNodes([&](node v) {
+		if (G.degree(v) > 0) {
+			activeNodes.push_back(v);
+		}
+	});
+	std::vector<std::atomic<bool>> queued(z);
+	for (node v : activeNodes) {
+		queued[v] = true;
+	}
+
+	// thread-local dense label weights and the list of labels touched in the neighborhood (as in PLM's turbo mode)
+	const count maxThreads = omp_get_max_threads();
+	std::vector<std::vector<edgeweight>> labelWeights(maxThreads);
+	std::vector<std::vector<label>> neighborLabels(maxThreads);
+	std::vector<std::vector<node>> nextActive(maxThreads);
 
 	Aux::Timer runtime;
 
@@ -71,40 +88,75 @@ void PLP::run() {
 		nIterations += 1;
 		DEBUG("[BEGIN] LabelPropagation: iteration #" , nIterations);
 
+		// nodes of this round may be queued again for the next one
+		for (node v : activeNodes) {
+			queued[v] = false;
+		}
+
 		// reset updated
 		nUpdated = 0;
 
-		G.balancedParallelForNodes([&](node v){
-			if ((activeNodes[v]) && (G.degree(v) > 0)) {
+		#pragma omp parallel reduction(+:nUpdated)
+		{
+			const index tid = omp_get_thread_num();
+			std::vector<edgeweight>& weights = labelWeights[tid];
+			std::vector<label>& labels = neighborLabels[tid];
+			std::vector<node>& next = nextActive[tid];
+			if (weights.size() < result.upperBound()) {
+				weights.assign(result.upperBound(), 0.0);
+			}
+
+			auto activate = [&](node u) {
+				if (!queued[u].exchange(true, std::memory_order_relaxed)) {
+					next.push_back(u);
+				}
+			};
 
-				std::map<label, double> labelWeights; // neighborLabelCounts maps label -> frequency in the neighbors
+			#pragma omp for schedule(guided)
+			for (index i = 0; i < activeNodes.size(); ++i) {
+				node v = activeNodes[i];
 
 				// weigh the labels in the neighborhood of v
+				labels.clear();
 				G.forNeighborsOf(v, [&](node w, edgeweight weight) {
 					label lw = result.subsetOf(w);
-					labelWeights[lw] += weight; // add weight of edge {v, w}
+					if (weights[lw] == 0.0) {
+						labels.push_back(lw);
+					}
+					weights[lw] += weight; // add weight of edge {v, w}
 				});
 
-				// get heaviest label
-				label heaviest = std::max_element(labelWeights.begin(),
-								labelWeights.end(),
-								[](const std::pair<label, edgeweight>& p1, const std::pair<label, edgeweight>& p2) {
-									return p1.second < p2.second;})->first;
+				// get heaviest label, ties are broken towards the smallest label
+				label heaviest = none;
+				edgeweight heaviestWeight = 0.0;
+				for (label l : labels) {
+					if (heaviest == none || weights[l] > heaviestWeight || (weights[l] == heaviestWeight && l < heaviest)) {
+						heaviest = l;
+						heaviestWeight = weights[l];
+					}
+				}
+				for (label l : labels) {
+					weights[l] = 0.0;
+				}
 
-				if (result.subsetOf(v) != heaviest) { // UPDATE
+				if (heaviest != none && result.subsetOf(v) != heaviest) { // UPDATE
 					result.moveToSubset(heaviest,v); //result[v] = heaviest;
-					nUpdated += 1; // TODO: atomic update?
+					nUpdated += 1;
+					activate(v);
 					G.forNeighborsOf(v, [&](node u) {
-						activeNodes[u] = true;
+						if (G.degree(u) > 0) {
+							activate(u);
+						}
 					});
-				} else {
-					activeNodes[v] = false;
 				}
-
-			} else {
-				// node is isolated
 			}
-		});
+		}
+
+		activeNodes.clear();
+		for (std::vector<node>& next : nextActive) {
+			activeNodes.insert(activeNodes.end(), next.begin(), next.end());
+			next.clear();
+		}
 
 		// for each while loop iteration...
 
@@ -8,7 +8,7 @@
 
 #include "ParallelAgglomerativeClusterer.h"
 #include "../scoring/ModularityScoring.h"
-#include "../matching/PathGrowingMatcher.h"
+#include "../matching/SuitorMatcher.h"
 #include "../coarsening/MatchingCoarsening.h"
 #include "../coarsening/ClusteringProjector.h"
 
@@ -41,9 +41,8 @@ void ParallelAgglomerativeClusterer::run() {
 		ModularityScoring<double> modScoring(Gcopy);
 		modScoring.scoreEdges(attrId);
 
-		// FIXME: so far only sequential
-		// compute matching
-		PathGrowingMatcher parMatcher(Gcopy);
+		// compute matching, self-loops of merged nodes are ignored
+		SuitorMatcher parMatcher(Gcopy);
 		parMatcher.run();
 		Matching M = parMatcher.getMatching();
 
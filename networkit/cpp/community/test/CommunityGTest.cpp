@@ -554,8 +554,8 @@ TEST_F(CommunityGTest, tryParallelAgglomerativeAndPLM) {
 
 
 	// *** blog graph
-	ParallelAgglomerativeClusterer aggl2(jazz);
-	PLM louvain2(jazz);
+	ParallelAgglomerativeClusterer aggl2(blog);
+	PLM louvain2(blog);
 	// parallel agglomerative
 	aggl2.run();
 	clustering = aggl2.getPartition();
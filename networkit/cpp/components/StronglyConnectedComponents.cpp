@@ -8,9 +8,11 @@
  *  -- Obada Mahdi <omahdi@gmail.com>
  */
 
+#include <atomic>
 #include <stack>
 #include <functional>
 #include <tuple>
+#include <omp.h>
 
 #include "StronglyConnectedComponents.h"
 #include "../structures/Partition.h"
@@ -18,6 +20,45 @@
 
 namespace NetworKit {
 
+namespace {
+
+/**
+ * Level-synchronous parallel search from @a source along out-edges if @a forward
+ * is true, along in-edges otherwise. A node w is entered iff claim(w) returns true,
+ * which must happen at most once per node. @a source has to be claimed by the caller.
+ */
+template<typename Claim>
+void parallelSearch(const Graph& G, node source, bool forward, Claim claim) {
+	std::vector<node> frontier = {source};
+	std::vector<std::vector<node>> localNext(omp_get_max_threads());
+	while (!frontier.empty()) {
+		#pragma omp parallel if(frontier.size() > 256)
+		{
+			std::vector<node>& next = localNext[omp_get_thread_num()];
+			auto visit = [&](node w) {
+				if (claim(w)) {
+					next.push_back(w);
+				}
+			};
+			#pragma omp for schedule(guided)
+			for (index i = 0; i < frontier.size(); ++i) {
+				if (forward) {
+					G.forNeighborsOf(frontier[i], visit);
+				} else {
+					G.forInNeighborsOf(frontier[i], visit);
+				}
+			}
+		}
+		frontier.clear();
+		for (std::vector<node>& next : localNext) {
+			frontier.insert(frontier.end(), next.begin(), next.end());
+			next.clear();
+		}
+	}
+}
+
+} /* namespace */
+
 StronglyConnectedComponents::StronglyConnectedComponents(const Graph& G, bool iterativeAlgo) : G(G), iterativeAlgo(iterativeAlgo) {
 
 }
@@ -164,6 +205,202 @@ void StronglyConnectedComponents::runIteratively() {
 	//DEBUG("max_stack_size = ", max_stack_size, ", node count = ", z);
 }
 
+void StronglyConnectedComponents::runParallel() {
+	const count z = G.upperNodeIdBound();
+	component = Partition(z);
+	component.setUpperBound(z);
+
+	// a node is removed once its component is known; every component is
+	// first identified by one of its nodes and compacted in the end
+	std::vector<std::atomic<bool>> removed(z);
+	#pragma omp parallel for
+	for (node v = 0; v < z; ++v) {
+		removed[v] = !G.hasNode(v);
+	}
+
+	std::vector<node> remaining;
+	auto collectRemaining = [&](const std::vector<node>& candidates) {
+		std::vector<std::vector<node>> local(omp_get_max_threads());
+		#pragma omp parallel for
+		for (index i = 0; i < candidates.size(); ++i) {
+			if (!removed[candidates[i]]) {
+				local[omp_get_thread_num()].push_back(candidates[i]);
+			}
+		}
+		std::vector<node> result;
+		for (const std::vector<node>& part : local) {
+			result.insert(result.end(), part.begin(), part.end());
+		}
+		return result;
+	};
+
+	node pivot = none;
+	{
+		// trimming: a node without incoming or outgoing edges from other
+		// remaining nodes is a component of its own
+		std::vector<std::atomic<count>> inDeg(z), outDeg(z);
+		G.parallelForNodes([&](node v) {
+			count in = 0, out = 0;
+			G.forNeighborsOf(v, [&](node w) {
+				if (w != v) ++out;
+			});
+			G.forInNeighborsOf(v, [&](node w) {
+				if (w != v) ++in;
+			});
+			inDeg[v] = in;
+			outDeg[v] = out;
+		});
+
+		#pragma omp parallel
+		{
+			std::vector<node> trimmed;
+			auto tryTrim = [&](node w) {
+				if (!removed[w].exchange(true)) {
+					trimmed.push_back(w);
+				}
+			};
+			#pragma omp for schedule(dynamic, 1024)
+			for (node v = 0; v < z; ++v) {
+				if (!removed[v] && (inDeg[v] == 0 || outDeg[v] == 0)) {
+					tryTrim(v);
+				}
+				// chains of trimmed nodes are followed depth-first by the same thread
+				while (!trimmed.empty()) {
+					node u = trimmed.back();
+					trimmed.pop_back();
+					component[u] = u;
+					G.forNeighborsOf(u, [&](node w) {
+						if (w != u && inDeg[w].fetch_sub(1) == 1) {
+							tryTrim(w);
+						}
+					});
+					G.forInNeighborsOf(u, [&](node w) {
+						if (w != u && outDeg[w].fetch_sub(1) == 1) {
+							tryTrim(w);
+						}
+					});
+				}
+			}
+		}
+
+		std::vector<node> all(z);
+		#pragma omp parallel for
+		for (node v = 0; v < z; ++v) {
+			all[v] = v;
+		}
+		remaining = collectRemaining(all);
+
+		// the giant component most likely contains a node with high in- and out-degree
+		count best = 0;
+		for (node v : remaining) {
+			count score = (inDeg[v] + 1) * (outDeg[v] + 1);
+			if (pivot == none || score > best) {
+				best = score;
+				pivot = v;
+			}
+		}
+	}
+	DEBUG("SCC: ", remaining.size(), " nodes remain after trimming");
+
+	// forward-backward search from the pivot: its component consists of
+	// the nodes that are reached in both directions
+	std::vector<std::atomic<bool>> flag(z);
+	if (pivot != none) {
+		#pragma omp parallel for
+		for (node v = 0; v < z; ++v) {
+			flag[v] = false;
+		}
+		flag[pivot] = true;
+		parallelSearch(G, pivot, true, [&](node w) {
+			return !removed[w] && !flag[w] && !flag[w].exchange(true);
+		});
+		removed[pivot] = true;
+		component[pivot] = pivot;
+		parallelSearch(G, pivot, false, [&](node w) {
+			if (flag[w] && !removed[w] && !removed[w].exchange(true)) {
+				component[w] = pivot;
+				return true;
+			}
+			return false;
+		});
+		remaining = collectRemaining(remaining);
+		DEBUG("SCC: ", remaining.size(), " nodes remain after forward-backward search");
+	}
+
+	// coloring: propagate the largest node id along the out-edges, then every node
+	// that kept its own color is the root of a component which consists of the
+	// nodes of its color that reach it
+	std::vector<std::atomic<node>> color(z);
+	std::vector<std::atomic<bool>>& queued = flag;
+	while (!remaining.empty()) {
+		#pragma omp parallel for
+		for (index i = 0; i < remaining.size(); ++i) {
+			color[remaining[i]] = remaining[i];
+			queued[remaining[i]] = true;
+		}
+
+		std::vector<node> active = remaining;
+		std::vector<std::vector<node>> localNext(omp_get_max_threads());
+		while (!active.empty()) {
+			#pragma omp parallel
+			{
+				std::vector<node>& next = localNext[omp_get_thread_num()];
+				#pragma omp for schedule(guided)
+				for (index i = 0; i < active.size(); ++i) {
+					node v = active[i];
+					queued[v] = false;
+					node c = color[v];
+					G.forNeighborsOf(v, [&](node w) {
+						if (removed[w]) return;
+						node cw = color[w];
+						while (cw < c) {
+							if (color[w].compare_exchange_weak(cw, c)) {
+								if (!queued[w].exchange(true)) {
+									next.push_back(w);
+								}
+								break;
+							}
+						}
+					});
+				}
+			}
+			active.clear();
+			for (std::vector<node>& next : localNext) {
+				active.insert(active.end(), next.begin(), next.end());
+				next.clear();
+			}
+		}
+
+		// the color classes are disjoint, so the roots can be processed independently
+		#pragma omp parallel
+		{
+			std::vector<node> stack;
+			#pragma omp for schedule(dynamic, 64)
+			for (index i = 0; i < remaining.size(); ++i) {
+				node r = remaining[i];
+				if (color[r] != r) continue;
+				removed[r] = true;
+				component[r] = r;
+				stack.push_back(r);
+				while (!stack.empty()) {
+					node u = stack.back();
+					stack.pop_back();
+					G.forInNeighborsOf(u, [&](node w) {
+						if (!removed[w] && color[w] == r) {
+							removed[w] = true;
+							component[w] = r;
+							stack.push_back(w);
+						}
+					});
+				}
+			}
+		}
+		remaining = collectRemaining(remaining);
+	}
+
+	component.compact(true);
+}
+
 Partition StronglyConnectedComponents::getPartition() {
 	return this->component;
 }
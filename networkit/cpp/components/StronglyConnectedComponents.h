@@ -39,6 +39,21 @@ public:
 	 */
 	void runRecursively();
 
+	/**
+	 * This method determines the connected components for the graph g
+	 * in parallel. Nodes without incoming or outgoing edges are trimmed first,
+	 * then the component of a node with high in- and out-degree, usually the
+	 * giant component, is found by a forward and a backward search. The
+	 * remaining components are found by repeated color propagation.
+	 * Afterwards the components are numbered in the order of their smallest node.
+	 *
+	 * Unlike runIteratively() this also works after edges have been removed.
+	 *
+	 * @see Slota, Rajamanickam, Madduri: BFS and Coloring-based Parallel Algorithms
+	 * for Strongly Connected Components and Related Problems. IPDPS 2014.
+	 */
+	void runParallel();
+
 	/**
 	 * This method returns the number of connected components.
 	 */
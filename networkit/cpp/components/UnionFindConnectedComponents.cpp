@@ -0,0 +1,112 @@
+/*
+ * UnionFindConnectedComponents.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include <unordered_map>
+
+#include "UnionFindConnectedComponents.h"
+#include "../structures/ConcurrentUnionFind.h"
+#include "../auxiliary/Log.h"
+
+namespace NetworKit {
+
+UnionFindConnectedComponents::UnionFindConnectedComponents(const Graph& G, count neighborRounds) : G(G), neighborRounds(neighborRounds), numComponents(0) {
+	if (G.isDirected()) {
+		throw std::runtime_error("Error, connected components of directed graphs cannot be computed, use StronglyConnectedComponents for them.");
+	}
+}
+
+void UnionFindConnectedComponents::run() {
+	const count z = G.upperNodeIdBound();
+	ConcurrentUnionFind uf(z);
+
+	// link every node to its first neighbors; this already connects most of a giant component
+	for (index r = 0; r < neighborRounds; ++r) {
+		G.parallelForNodes([&](node u) {
+			if (r < G.degree(u)) {
+				node v = G.getIthNeighbor<false>(u, r);
+				if (v != none) {
+					uf.merge(u, v);
+				}
+			}
+		});
+	}
+	uf.compress();
+
+	// estimate the largest intermediate component
+	node giant = none;
+	if (G.numberOfNodes() > 0) {
+		const count samples = 1024;
+		std::unordered_map<index, count> frequency;
+		count best = 0;
+		for (index i = 0; i < samples; ++i) {
+			index c = uf.find(G.randomNode());
+			count f = ++frequency[c];
+			if (f > best) {
+				best = f;
+				giant = c;
+			}
+		}
+		DEBUG("largest sampled component: ", giant, " with ", best, " of ", samples, " samples");
+	}
+
+	// process all edges of nodes outside the giant component; edges between the
+	// giant component and other nodes are seen from the other endpoint
+	G.balancedParallelForNodes([&](node u) {
+		if (uf.find(u) == giant) return;
+		G.forNeighborsOf(u, [&](node v) {
+			uf.merge(u, v);
+		});
+	});
+	uf.compress();
+
+	// the representative of a set is its smallest node, so numbering the roots
+	// in increasing order numbers the components as ConnectedComponents does
+	component = Partition(z, none);
+	std::vector<index> componentOfRoot(z, none);
+	numComponents = 0;
+	G.forNodes([&](node u) {
+		if (uf.find(u) == u) {
+			componentOfRoot[u] = numComponents++;
+		}
+	});
+	component.setUpperBound(numComponents);
+	G.parallelForNodes([&](node u) {
+		component[u] = componentOfRoot[uf.find(u)];
+	});
+
+	hasRun = true;
+}
+
+Partition UnionFindConnectedComponents::getPartition() {
+	if (!hasRun) throw std::runtime_error("run method has not been called");
+	return this->component;
+}
+
+std::vector<std::vector<node> > UnionFindConnectedComponents::getComponents() {
+	if (!hasRun) throw std::runtime_error("run method has not been called");
+
+	std::vector<std::vector<node> > result(numComponents);
+	G.forNodes([&](node u) {
+		result[component[u]].push_back(u);
+	});
+
+	return result;
+}
+
+std::map<index, count> UnionFindConnectedComponents::getComponentSizes() {
+	if (!hasRun) throw std::runtime_error("run method has not been called");
+	return this->component.subsetSizeMap();
+}
+
+std::string UnionFindConnectedComponents::toString() const {
+	return "UnionFindConnectedComponents";
+}
+
+bool UnionFindConnectedComponents::isParallel() const {
+	return true;
+}
+
+} /* namespace NetworKit */
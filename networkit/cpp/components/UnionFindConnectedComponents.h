@@ -0,0 +1,100 @@
+/*
+ * UnionFindConnectedComponents.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef UNIONFINDCONNECTEDCOMPONENTS_H_
+#define UNIONFINDCONNECTEDCOMPONENTS_H_
+
+#include "../graph/Graph.h"
+#include "../structures/Partition.h"
+#include "../base/Algorithm.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup components
+ * Determines the connected components of an undirected graph in parallel
+ * with a lock-free union find data structure.
+ *
+ * First, every node is linked to a few of its neighbors (neighbor sampling).
+ * Then the largest intermediate component is estimated by sampling and the
+ * remaining edges are only processed for nodes outside of it, so most edges
+ * of a giant component are never touched (Afforest).
+ *
+ * Components are numbered 0, 1, ... in the order of their smallest node,
+ * i.e. the result is identical to the one of ConnectedComponents.
+ *
+ * @see Sutton, Ben-Nun, Barak: Optimizing Parallel Graph Connectivity Computation via Subgraph Sampling. IPDPS 2018.
+ */
+class UnionFindConnectedComponents : public Algorithm {
+public:
+	/**
+	 * Create UnionFindConnectedComponents class for Graph @a G.
+	 *
+	 * @param G The graph.
+	 * @param neighborRounds Number of neighbors per node that are linked before the giant component is sampled.
+	 */
+	UnionFindConnectedComponents(const Graph& G, count neighborRounds = 2);
+
+	/**
+	 * This method determines the connected components for the graph given in the constructor.
+	 */
+	void run() override;
+
+	/**
+	 * Get the number of connected components.
+	 *
+	 * @return The number of connected components.
+	 */
+	count numberOfComponents();
+
+	/**
+	 * Get the the component in which node @a u is situated.
+	 *
+	 * @param[in]	u	The node whose component is asked for.
+	 */
+	count componentOfNode(node u);
+
+	/**
+	 * Get a Partition that represents the components.
+	 *
+	 * @return A partition representing the found components.
+	 */
+	Partition getPartition();
+
+	/**
+	 * Return the map from component to size
+	 */
+	std::map<index, count> getComponentSizes();
+
+	/**
+	 * @return Vector of components, each stored as (unordered) set of nodes.
+	 */
+	std::vector<std::vector<node> > getComponents();
+
+	std::string toString() const override;
+
+	bool isParallel() const override;
+
+private:
+	const Graph& G;
+	count neighborRounds;
+	Partition component;
+	count numComponents;
+};
+
+inline count UnionFindConnectedComponents::componentOfNode(node u) {
+	assert (component[u] != none);
+	if (!hasRun) throw std::runtime_error("run method has not been called");
+	return component[u];
+}
+
+inline count UnionFindConnectedComponents::numberOfComponents() {
+	if (!hasRun) throw std::runtime_error("run method has not been called");
+	return numComponents;
+}
+
+} /* namespace NetworKit */
+#endif /* UNIONFINDCONNECTEDCOMPONENTS_H_ */
@@ -11,12 +11,15 @@
 #include "../ConnectedComponents.h"
 #include "../ParallelConnectedComponents.h"
 #include "../StronglyConnectedComponents.h"
+#include "../UnionFindConnectedComponents.h"
 
 #include "../../distance/Diameter.h"
 #include "../../io/METISGraphReader.h"
 #include "../../generators/HavelHakimiGenerator.h"
 #include "../../auxiliary/Log.h"
 #include "../../generators/DorogovtsevMendesGenerator.h"
+#include "../../generators/ErdosRenyiGenerator.h"
+#include "../../auxiliary/Random.h"
 
 namespace NetworKit {
 
@@ -114,6 +117,34 @@ TEST_F(ConnectedComponentsGTest, testParallelConnectedComponentsWithDeletedNodes
 
 }
 
+TEST_F(ConnectedComponentsGTest, testUnionFindConnectedComponents) {
+	METISGraphReader reader;
+	std::vector<std::string> graphs = {"astro-ph", "PGPgiantcompo",
+			"celegans_metabolic", "hep-th", "jazz"};
+
+	for (auto graphName: graphs) {
+		Graph G = reader.read("input/" + graphName + ".graph");
+		// split off a few nodes so that there are several components
+		for (node u = 0; u < 20; ++u) {
+			G.forNeighborsOf(u, [&](node v) {
+				G.removeEdge(u, v);
+			});
+		}
+		G.removeNode(5);
+
+		ConnectedComponents reference(G);
+		reference.run();
+		UnionFindConnectedComponents cc(G);
+		cc.run();
+
+		EXPECT_EQ(reference.numberOfComponents(), cc.numberOfComponents()) << graphName;
+		G.forNodes([&](node u) {
+			EXPECT_EQ(reference.componentOfNode(u), cc.componentOfNode(u)) << graphName;
+		});
+		EXPECT_EQ(reference.getComponentSizes(), cc.getComponentSizes()) << graphName;
+	}
+}
+
 TEST_F(ConnectedComponentsGTest, benchConnectedComponents) {
 	// construct graph
 	METISGraphReader reader;
@@ -186,6 +217,60 @@ TEST_F(ConnectedComponentsGTest, testStronglyConnectedComponents) {
 }
 
 
+TEST_F(ConnectedComponentsGTest, testStronglyConnectedComponentsParallel) {
+	Aux::Random::setSeed(42, false);
+	// sparse graphs have many small components, denser ones a giant component
+	for (double p : {0.0005, 0.001, 0.002, 0.01}) {
+		Graph G = ErdosRenyiGenerator(2000, p, true).generate();
+		// a long cycle and a long path, which need many rounds of trimming and coloring
+		node first = G.addNode();
+		node prev = first;
+		for (count i = 1; i < 1000; ++i) {
+			node u = G.addNode();
+			G.addEdge(prev, u);
+			prev = u;
+		}
+		G.addEdge(prev, first);
+		for (count i = 0; i < 1000; ++i) {
+			node u = G.addNode();
+			G.addEdge(prev, u);
+			prev = u;
+		}
+		G.addEdge(first, 0);
+		G.addEdge(3, 3);
+
+		StronglyConnectedComponents reference(G);
+		reference.runIteratively();
+		Partition expected = reference.getPartition();
+		expected.compact();
+
+		StronglyConnectedComponents scc(G);
+		scc.runParallel();
+		EXPECT_EQ(expected.numberOfSubsets(), scc.numberOfComponents());
+		EXPECT_EQ(expected.getVector(), scc.getPartition().getVector());
+
+		// runIteratively() cannot handle removed edges
+		std::vector<std::pair<node, node>> toRemove;
+		G.forEdges([&](node u, node v) {
+			if (Aux::Random::probability() < 0.05) {
+				toRemove.emplace_back(u, v);
+			}
+		});
+		for (auto e : toRemove) {
+			G.removeEdge(e.first, e.second);
+		}
+		if (G.hasEdge(first, 0)) {
+			G.removeEdge(first, 0);
+		}
+		StronglyConnectedComponents reference2(G, false);
+		reference2.run();
+		expected = reference2.getPartition();
+		expected.compact();
+		scc.runParallel();
+		EXPECT_EQ(expected.getVector(), scc.getPartition().getVector());
+	}
+}
+
 } /* namespace NetworKit */
 
 #endif /*NOGTEST */
@@ -39,11 +39,12 @@ public:
 	virtual std::string toString() const override;
 
 	/**
-	 * Returns a vector of weighted distances between node pairs.
+	 * Returns a vector of weighted distances between node pairs. The matrix has
+	 * G.upperNodeIdBound()^2 entries; for large graphs see TiledAPSP.
  	 *
  	 * @return The shortest-path distances from each node to any other node in the graph.
 	 */
-	std::vector<std::vector<edgeweight> > getDistances() const {if (!hasRun) throw std::runtime_error("Call run method first"); return distances;}
+	const std::vector<std::vector<edgeweight> >& getDistances() const {if (!hasRun) throw std::runtime_error("Call run method first"); return distances;}
 
 
 	/**
@@ -11,7 +11,7 @@
 #include "Eccentricity.h"
 #include "../distance/BFS.h"
 #include "../distance/Dijkstra.h"
-#include "../components/ConnectedComponents.h"
+#include "../components/UnionFindConnectedComponents.h"
 #include "../structures/Partition.h"
 
 namespace NetworKit {
@@ -100,7 +100,7 @@ std::pair<edgeweight, edgeweight> Diameter::estimatedDiameterRange(const NetworK
 		}
 	}
 
-	ConnectedComponents comp(G);
+	UnionFindConnectedComponents comp(G);
 	comp.run();
 	count numberOfComponents = comp.numberOfComponents();
 
@@ -298,7 +298,7 @@ edgeweight Diameter::estimatedVertexDiameterPedantic(const Graph& G) {
 		vd ++; //we need the number of nodes, not the number of edges
 	}
 	else {
-		ConnectedComponents cc(G);
+		UnionFindConnectedComponents cc(G);
 		DEBUG("finding connected components");
 		cc.run();
 		INFO("Number of components ", cc.numberOfComponents());
@@ -8,14 +8,42 @@
 #include "Dijkstra.h"
 
 #include <algorithm>
+#include <stdexcept>
+
+#include "../auxiliary/DAryHeap.h"
+#include "../auxiliary/RadixHeap.h"
 
 namespace NetworKit {
 
-Dijkstra::Dijkstra(const Graph& G, node source, bool storePaths, bool storeStack, node target) : SSSP(G, source, storePaths, storeStack, target) {
+Dijkstra::Dijkstra(const Graph& G, node source, bool storePaths, bool storeStack, node target, DijkstraQueue queue) : SSSP(G, source, storePaths, storeStack, target), queue(queue) {
 
 }
 
 void Dijkstra::run() {
+	const count z = G.upperNodeIdBound();
+	switch (queue) {
+	case setQueue: {
+		Aux::PrioQueue<edgeweight, node> pq(z);
+		runWith(pq);
+		break;
+	}
+	case dAryHeap: {
+		Aux::DAryHeap<edgeweight, node> pq(z);
+		runWith(pq);
+		break;
+	}
+	case radixHeap: {
+		Aux::RadixHeap<edgeweight, node> pq(z);
+		runWith(pq);
+		break;
+	}
+	default:
+		throw std::invalid_argument("unknown priority queue type");
+	}
+}
+
+template<class Queue>
+void Dijkstra::runWith(Queue& pq) {
 
 	TRACE("initializing Dijkstra data structures");
 	// init distances
@@ -34,11 +62,9 @@ void Dijkstra::run() {
 		std::vector<node> empty;
 		std::swap(stack, empty);
 	}
+	// priority queue with distance-node pairs; nodes are inserted when they are reached first
 	distances[source] = 0;
-	// priority queue with distance-node pairs
-	distances[source] = 0;
-	Aux::PrioQueue<edgeweight, node> pq(distances);
-
+	pq.insert(0, source);
 
 	auto relax([&](node u, node v, edgeweight w) {
 		if (distances[v] > distances[u] + w) {
@@ -48,9 +74,7 @@ void Dijkstra::run() {
 				npaths[v] = npaths[u];
 			}
 			TRACE("Decreasing key of ", v);
-			TRACE("pq size: ", pq.size());
 			pq.changeKey(distances[v], v);
-			TRACE("pq size: ", pq.size());
 		} else if (storePaths && (distances[v] == distances[u] + w)) {
 			previous[v].push_back(u); 	// additional predecessor
 			npaths[v] += npaths[u]; 	// all the shortest paths to u are also shortest paths to v now
@@ -63,7 +87,6 @@ void Dijkstra::run() {
 		TRACE("pq size: ", pq.size());
 		node current = pq.extractMin().second;
 		TRACE("current node in Dijkstra: " , current);
-		TRACE("pq size: ", pq.size());
 		if (breakWhenFound && target == current) {
 			break;
 		}
@@ -14,6 +14,13 @@
 
 namespace NetworKit {
 
+/**
+ * Priority queue used by Dijkstra's algorithm.
+ * setQueue is the std::set based Aux::PrioQueue, dAryHeap an addressable 4-ary heap
+ * and radixHeap a monotone radix heap (requires non-negative edge weights).
+ */
+enum DijkstraQueue {setQueue = 0, dAryHeap = 1, radixHeap = 2};
+
 /**
  * @ingroup graph
  * Dijkstra's SSSP algorithm.
@@ -31,13 +38,22 @@ public:
 	 * @param G The graph.
 	 * @param source The source node.
 	 * @param storePaths	store paths and number of paths?
+	 * @param storeStack	maintain a stack of nodes in order of decreasing distance?
+	 * @param target	the search stops when @a target has been reached.
+	 * @param queue	priority queue implementation, see DijkstraQueue.
 	 */
-	Dijkstra(const Graph& G, node source, bool storePaths=true, bool storeStack=false, node target = none);
+	Dijkstra(const Graph& G, node source, bool storePaths=true, bool storeStack=false, node target = none, DijkstraQueue queue = dAryHeap);
 
 	/**
 	 * Performs the Dijkstra SSSP algorithm on the graph given in the constructor.
 	 */
 	virtual void run();
+
+private:
+	DijkstraQueue queue;
+
+	template<class Queue>
+	void runWith(Queue& pq);
 };
 
 } /* namespace NetworKit */
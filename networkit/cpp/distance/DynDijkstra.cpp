@@ -8,7 +8,7 @@
 #include "Dijkstra.h"
 #include "DynDijkstra.h"
 #include "../auxiliary/Log.h"
-#include "../auxiliary/PrioQueue.h"
+#include "../auxiliary/DAryHeap.h"
 #include "../auxiliary/NumericTools.h"
 #include <queue>
 
@@ -39,7 +39,7 @@ void DynDijkstra::update(GraphEvent e) {
 void DynDijkstra::updateBatch(const std::vector<GraphEvent>& batch) {
 	mod = false;
 	// priority queue with distance-node pairs
-	Aux::PrioQueue<edgeweight, node> Q(G.upperNodeIdBound());
+	Aux::DAryHeap<edgeweight, node> Q(G.upperNodeIdBound());
 	// queue with all visited nodes
 	std::queue<node> visited;
 	// if u has a new shortest path going through v, it updates the distance of u
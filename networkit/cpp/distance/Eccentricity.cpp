@@ -6,17 +6,16 @@
  */
 
 #include "Eccentricity.h"
-#include "BFS.h"
+#include "ParallelBFS.h"
 
 namespace NetworKit {
 
 std::pair<node, count> Eccentricity::getValue(const Graph& G, node u) {
-	count ecc = 0;
-	node res;
-	G.BFSfrom(u, [&](node v, count dist) {
-		ecc = dist;
-		res = v;
-	});
+	ParallelBFS bfs(G, u, false, true);
+	bfs.run();
+	// the last node on the stack is one of the farthest nodes
+	node res = bfs.getStack().back();
+	count ecc = bfs.distance(res);
 	return {res, ecc}; // pair.first is argmax node
 }
 
@@ -6,7 +6,7 @@
 */
 
 #include "EffectiveDiameter.h"
-#include "../components/ConnectedComponents.h"
+#include "../components/UnionFindConnectedComponents.h"
 #include "../auxiliary/Random.h"
 
 #include <math.h>
@@ -19,7 +19,7 @@ namespace NetworKit {
 
 EffectiveDiameter::EffectiveDiameter(const Graph& G, const double ratio) : Algorithm(), G(G), ratio(ratio) {
 	if (G.isDirected()) throw std::runtime_error("current implementation can only deal with undirected graphs");
-	ConnectedComponents cc(G);
+	UnionFindConnectedComponents cc(G);
 	cc.run();
 	if (cc.getPartition().numberOfSubsets() > 1) throw std::runtime_error("current implementation only runs on graphs with 1 connected component");
 }
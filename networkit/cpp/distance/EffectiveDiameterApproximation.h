@@ -21,15 +21,18 @@ class EffectiveDiameterApproximation : public Algorithm {
 public:
 	/**
 	* Approximates the effective diameter of a given graph.
-	* The effective diameter is defined as the number of edges on average to reach \p ratio of all other nodes.
-	* Implementation after the ANF algorithm presented in the paper "A Fast and Scalable Tool for Data Mining in Massive Graphs"[1]
+	* The effective diameter is defined as the number of edges on average to reach \p ratio of all other nodes
+	* (of the connected component of the node, if the graph is disconnected).
+	* The sizes of the neighborhoods are estimated with HyperLogLog counters by HyperBall, an improvement of
+	* the ANF algorithm presented in the paper "A Fast and Scalable Tool for Data Mining in Massive Graphs"[1].
+	* The graph does not need to be connected.
 	*
 	* [1] by Palmer, Gibbons and Faloutsos which can be found here: http://www.cs.cmu.edu/~christos/PUBLICATIONS/kdd02-anf.pdf
 	*
 	* @param G the given graph
 	* @param ratio the ratio of nodes that should be connected (0,1]; default = 0.9
-	* @param k the number of parallel approximations to get a more robust result; default = 64
-	* @param r the amount of bits that are added to the length of the bitmask to improve the accuracy; default = 7
+	* @param k the number of registers of every counter, larger values give a more robust result; default = 64
+	* @param r unused, the registers of HyperLogLog counters need no additional bits; default = 7
 	*/
 	EffectiveDiameterApproximation(const Graph& G, const double ratio=0.9, const count k=64, const count r=7);
 
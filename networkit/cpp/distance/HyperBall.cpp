@@ -0,0 +1,199 @@
+/*
+ * HyperBall.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include "HyperBall.h"
+#include "../auxiliary/Random.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace NetworKit {
+
+namespace {
+
+// 2^-i for all possible register values
+struct InversePowers {
+	double value[65];
+	InversePowers() {
+		for (int i = 0; i <= 64; ++i) {
+			value[i] = std::ldexp(1.0, -i);
+		}
+	}
+};
+const InversePowers inversePowers;
+
+uint64_t mix(uint64_t x) {
+	x += 0x9e3779b97f4a7c15ULL;
+	x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+	return x ^ (x >> 31);
+}
+
+} /* namespace */
+
+HyperBall::HyperBall(const Graph& G, count registers, count maxDistance) : Algorithm(), G(G), log2Registers(4), maxDistance(maxDistance), seed(mix(Aux::Random::integer())), rounds(0) {
+	while ((count{1} << log2Registers) < registers && log2Registers < 16) {
+		++log2Registers;
+	}
+}
+
+double HyperBall::estimate(const uint8_t* reg) const {
+	const count m = count{1} << log2Registers;
+	double sum = 0;
+	count zeros = 0;
+	for (index j = 0; j < m; ++j) {
+		sum += inversePowers.value[reg[j]];
+		zeros += (reg[j] == 0);
+	}
+	double alpha;
+	switch (m) {
+		case 16: alpha = 0.673; break;
+		case 32: alpha = 0.697; break;
+		case 64: alpha = 0.709; break;
+		default: alpha = 0.7213 / (1.0 + 1.079 / m);
+	}
+	double e = alpha * m * m / sum;
+	// small cardinalities are estimated by linear counting
+	if (e <= 2.5 * m && zeros > 0) {
+		e = m * std::log((double) m / zeros);
+	}
+	return e;
+}
+
+void HyperBall::run() {
+	run([](count, node, double) {});
+}
+
+void HyperBall::run(const std::function<void(count, node, double)>& handle) {
+	const count z = G.upperNodeIdBound();
+	const count m = count{1} << log2Registers;
+
+	// registers of all counters in the previous and the current round
+	std::vector<uint8_t> previous(z * m, 0);
+	std::vector<uint8_t> current(z * m, 0);
+	// nodes whose counter changed in the previous and the current round
+	std::vector<char> changed(z, 0);
+	std::vector<char> changedNow(z, 0);
+	// last estimate of every ball
+	std::vector<double> ball(z, 0);
+
+	neighborhoodFunction.clear();
+	reachable.assign(z, 0);
+	sumOfDistances.assign(z, 0);
+	harmonic.assign(z, 0);
+	rounds = 0;
+
+	// every counter starts with its own node, the first bits of the hash select the register
+	G.parallelForNodes([&](node v) {
+		uint64_t h = mix(v ^ seed);
+		uint64_t rest = h << log2Registers;
+		uint8_t rank = rest == 0 ? 64 - log2Registers + 1 : __builtin_clzll(rest) + 1;
+		previous[v * m + (h >> (64 - log2Registers))] = rank;
+		changed[v] = 1;
+		ball[v] = estimate(&previous[v * m]);
+	});
+
+	double pairs = 0;
+	for (count t = 1; maxDistance == 0 || t <= maxDistance; ++t) {
+		double added = 0;
+		count changes = 0;
+
+		#pragma omp parallel for schedule(guided) reduction(+:added,changes)
+		for (index v = 0; v < z; ++v) {
+			if (!G.hasNode(v)) continue;
+			const uint8_t* in = &previous[v * m];
+			uint8_t* out = &current[v * m];
+			// out still holds the counter of two rounds ago, which is up to date unless it changed since
+			bool touched = changed[v];
+			if (touched) {
+				std::copy(in, in + m, out);
+			}
+			G.forNeighborsOf(v, [&](node u) {
+				// the counters of the other neighbors have been merged before
+				if (!changed[u]) return;
+				if (!touched) {
+					std::copy(in, in + m, out);
+					touched = true;
+				}
+				const uint8_t* other = &previous[u * m];
+				for (index j = 0; j < m; ++j) {
+					out[j] = std::max(out[j], other[j]);
+				}
+			});
+			changedNow[v] = touched && std::memcmp(in, out, m) != 0;
+			if (!changedNow[v]) continue;
+
+			double e = std::max(estimate(out), ball[v]);
+			double delta = e - ball[v];
+			ball[v] = e;
+			reachable[v] += delta;
+			sumOfDistances[v] += t * delta;
+			harmonic[v] += delta / t;
+			added += delta;
+			++changes;
+			handle(t, v, e);
+		}
+
+		if (changes == 0) {
+			break;
+		}
+		pairs += added;
+		neighborhoodFunction.push_back(pairs);
+		rounds = t;
+		previous.swap(current);
+		changed.swap(changedNow);
+	}
+
+	hasRun = true;
+}
+
+count HyperBall::numberOfRounds() const {
+	assureFinished();
+	return rounds;
+}
+
+std::vector<double> HyperBall::getNeighborhoodFunction() const {
+	assureFinished();
+	return neighborhoodFunction;
+}
+
+std::vector<double> HyperBall::getReachableNodes() const {
+	assureFinished();
+	return reachable;
+}
+
+std::vector<double> HyperBall::getSumOfDistances() const {
+	assureFinished();
+	return sumOfDistances;
+}
+
+std::vector<double> HyperBall::getCloseness() const {
+	assureFinished();
+	std::vector<double> closeness(reachable.size(), 0);
+	#pragma omp parallel for
+	for (index v = 0; v < reachable.size(); ++v) {
+		if (sumOfDistances[v] > 0) {
+			closeness[v] = reachable[v] / sumOfDistances[v];
+		}
+	}
+	return closeness;
+}
+
+std::vector<double> HyperBall::getHarmonicCentrality() const {
+	assureFinished();
+	return harmonic;
+}
+
+std::string HyperBall::toString() const {
+	return "HyperBall";
+}
+
+bool HyperBall::isParallel() const {
+	return true;
+}
+
+} /* namespace NetworKit */
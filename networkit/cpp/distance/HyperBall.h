@@ -0,0 +1,113 @@
+/*
+ * HyperBall.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef HYPERBALL_H_
+#define HYPERBALL_H_
+
+#include <cstdint>
+#include <functional>
+
+#include "../graph/Graph.h"
+#include "../base/Algorithm.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup distance
+ * Approximates the sizes of the balls B_t(v) = { u : dist(v, u) <= t } of all nodes for
+ * t = 0, 1, ... with one HyperLogLog counter per node.
+ *
+ * The counter of v in round t is the union of its counter in round t-1 with the counters
+ * of its (out-)neighbors. Only neighbors whose counter changed in round t-1 can add
+ * anything, so every round merges only those and stops when no counter changes. The
+ * registers of all counters are stored in one contiguous array of bytes; the arrays of
+ * two consecutive rounds are swapped instead of copied. This needs 2 * n * registers
+ * bytes of memory.
+ *
+ * From the estimates the algorithm computes the neighborhood function and, for every node,
+ * the number of reachable nodes, the sum of distances to them and the harmonic centrality.
+ * Graphs do not need to be connected; for directed graphs the balls follow the out-edges.
+ *
+ * [1] Boldi, Vigna: In-Core Computation of Geometric Centralities with HyperBall: A Hundred Billion Nodes and Beyond. ICDMW 2013.
+ */
+class HyperBall : public Algorithm {
+
+public:
+	/**
+	 * @param G the given graph
+	 * @param registers the number of registers of every counter, rounded up to a power of two in [16, 65536];
+	 * the relative standard error of the estimates is about 1.04 / sqrt(registers)
+	 * @param maxDistance stop after this many rounds; 0 for no limit
+	 */
+	HyperBall(const Graph& G, count registers = 64, count maxDistance = 0);
+
+	void run() override;
+
+	/**
+	 * Runs the algorithm and calls @a handle(t, v, ball) for every node v whose counter changed
+	 * in round t >= 1 with the new estimate of |B_t(v)|. The handle is called in parallel and has
+	 * to be thread-safe. Repeated runs of the same instance use the same hash function and give
+	 * the same estimates.
+	 */
+	void run(const std::function<void(count, node, double)>& handle);
+
+	/**
+	 * @return the number of rounds in which some counter changed, i.e. an estimate of the diameter
+	 */
+	count numberOfRounds() const;
+
+	/**
+	 * @return the neighborhood function, the entry t-1 is the estimated number of ordered pairs (u, v)
+	 * with u != v and dist(u, v) <= t
+	 */
+	std::vector<double> getNeighborhoodFunction() const;
+
+	/**
+	 * @return the estimated number of nodes reachable from every node, excluding the node itself
+	 */
+	std::vector<double> getReachableNodes() const;
+
+	/**
+	 * @return the estimated sum of distances from every node to the nodes reachable from it
+	 */
+	std::vector<double> getSumOfDistances() const;
+
+	/**
+	 * @return the estimated closeness of every node, the number of reachable nodes divided by
+	 * the sum of distances to them, or 0 if no other node is reachable
+	 */
+	std::vector<double> getCloseness() const;
+
+	/**
+	 * @return the estimated harmonic centrality of every node, the sum of 1/dist(v, u) over all u != v
+	 */
+	std::vector<double> getHarmonicCentrality() const;
+
+	virtual std::string toString() const override;
+
+	virtual bool isParallel() const override;
+
+private:
+	const Graph& G;
+	count log2Registers;
+	const count maxDistance;
+	const uint64_t seed;
+
+	count rounds;
+	std::vector<double> neighborhoodFunction;
+	std::vector<double> reachable;
+	std::vector<double> sumOfDistances;
+	std::vector<double> harmonic;
+
+	/**
+	 * Estimates the cardinality of the counter with registers @a reg.
+	 */
+	double estimate(const uint8_t* reg) const;
+};
+
+} /* namespace NetworKit */
+
+#endif /* HYPERBALL_H_ */
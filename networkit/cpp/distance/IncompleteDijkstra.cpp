@@ -21,8 +21,9 @@ void IncompleteDijkstra::discardDuplicates() {
 }
 
 IncompleteDijkstra::IncompleteDijkstra(const Graph* G, const std::vector<node>& sources,
-                                       const std::unordered_set<node>* explored)
-      : G(G), explored(explored) {
+                                       const std::unordered_set<node>* explored,
+                                       DijkstraQueue queue)
+      : G(G), explored(explored), queue(queue) {
   if (!G) {
     throw invalid_argument("G is null");
   }
@@ -30,20 +31,63 @@ IncompleteDijkstra::IncompleteDijkstra(const Graph* G, const std::vector<node>&
   for (node source : sources) {
     if (!explored || explored->find(source) == explored->end()) {
       dists[source] = 0.0;
-      pq.emplace(0.0, source);
+      switch (queue) {
+      case dAryHeap:
+        dary.changeKey(0.0, source);
+        break;
+      case radixHeap:
+        radix.changeKey(0.0, source);
+        break;
+      default:
+        pq.emplace(0.0, source);
+      }
     }
   }
 }
 
 bool IncompleteDijkstra::hasNext() {
-  discardDuplicates();
-  return pq.size() > 0;
+  switch (queue) {
+  case dAryHeap:
+    return !dary.empty();
+  case radixHeap:
+    return !radix.empty();
+  default:
+    discardDuplicates();
+    return pq.size() > 0;
+  }
+}
+
+template<class Queue>
+std::pair<node, edgeweight> IncompleteDijkstra::nextFrom(Queue& heap) {
+  node u;
+  edgeweight dist_u;
+  tie(dist_u, u) = heap.extractMin();
+
+  G->forNeighborsOf(u, [&] (node v, edgeweight dist_uv) {
+    if (explored && explored->find(v) != explored->end()) {
+      return;
+    }
+
+    edgeweight new_dist_v = dist_u + dist_uv;
+    auto it_dist_v = dists.find(v);
+    if (it_dist_v == dists.end() || new_dist_v < it_dist_v->second) {
+      dists[v] = new_dist_v;
+      heap.changeKey(new_dist_v, v);
+    }
+  });
+
+  return {u, dist_u};
 }
 
 std::pair<node, edgeweight> IncompleteDijkstra::next() {
   if (!hasNext()) {
     throw std::invalid_argument("No next element");
   }
+  if (queue == dAryHeap) {
+    return nextFrom(dary);
+  } else if (queue == radixHeap) {
+    return nextFrom(radix);
+  }
 
   // Extract nearest node
   discardDuplicates();
@@ -15,14 +15,16 @@
 
 #include "../graph/Graph.h"
 #include "IncompleteSSSP.h"
-#include "../auxiliary/PrioQueue.h"
+#include "Dijkstra.h"
+#include "../auxiliary/DAryHeap.h"
+#include "../auxiliary/RadixHeap.h"
 
 namespace NetworKit {
 
 /**
  * @ingroup graph
  * Implementation of @a IncompleteSSSP using a normal
- * Dijkstra with binary heaps.
+ * Dijkstra with a selectable priority queue.
  */
 class IncompleteDijkstra : public IncompleteSSSP {
 public:
@@ -43,9 +45,14 @@ public:
    * @todo This is somewhat ugly, but we do not want introduce a
    * std::shared_ptr<> since @a G and @a explored could well
    * be stack allocated.
+   *
+   * @a queue selects the priority queue: dAryHeap and radixHeap are the
+   * addressable heaps with a sparse position index, setQueue keeps
+   * the binary heap with lazily discarded duplicates.
    */
   IncompleteDijkstra(const Graph* G, const std::vector<node>& sources,
-                     const std::unordered_set<node>* explored = nullptr);
+                     const std::unordered_set<node>* explored = nullptr,
+                     DijkstraQueue queue = dAryHeap);
 
   virtual bool hasNext() override;
   virtual std::pair<node, edgeweight> next() override;
@@ -54,14 +61,19 @@ private:
   // discard duplicate elements in pq
   void discardDuplicates();
 
+  template<class Queue>
+  std::pair<node, edgeweight> nextFrom(Queue& heap);
+
   // Stored reference to outside data structures
   const Graph* G;
   const std::unordered_set<node>* explored;
 
   // distances aren't stored in a vector because initialising it may be too expensive
   std::unordered_map<node, edgeweight> dists;
-  // TODO: Fix Aux::PrioQueue to work with arbitrary values.
-  // and use it instead.
+  DijkstraQueue queue;
+  // the addressable heaps must not allocate O(n) memory either, so they use a sparse index
+  Aux::DAryHeap<edgeweight, node, 4, Aux::SparseHeapIndex> dary;
+  Aux::RadixHeap<edgeweight, node, Aux::SparseHeapIndex> radix;
   using PrioValue = std::pair<edgeweight, node>;
   using Prio = std::priority_queue<PrioValue, std::vector<PrioValue>, std::greater<PrioValue>>;
   Prio pq;
@@ -23,13 +23,15 @@ public:
 	* Computes an approximation of the neighborhood function.
 	* The neighborhood function N of a graph G for a given distance t is defined
 	* as the number of node pairs (u,v) that can be reached within distance t.
-	* Implementation after the ANF algorithm presented in the paper "A Fast and Scalable Tool for Data Mining in Massive Graphs"[1]
+	* The sizes of the neighborhoods are estimated with HyperLogLog counters by HyperBall, an improvement of
+	* the ANF algorithm presented in the paper "A Fast and Scalable Tool for Data Mining in Massive Graphs"[1].
+	* The graph does not need to be connected.
 	*
 	* [1] by Palmer, Gibbons and Faloutsos which can be found here: http://www.cs.cmu.edu/~christos/PUBLICATIONS/kdd02-anf.pdf
 	*
 	* @param G the given graph
-	* @param k the number of parallel approximations to get a more robust result; default = 64
-	* @param r the amount of bits that are added to the length of the bitmask to improve the accuracy; default = 7
+	* @param k the number of registers of every counter, larger values give a more robust result; default = 64
+	* @param r unused, the registers of HyperLogLog counters need no additional bits; default = 7
 	*/
 	NeighborhoodFunctionApproximation(const Graph& G, const count k=64, const count r=7);
 
@@ -0,0 +1,165 @@
+/*
+ * ParallelBFS.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <omp.h>
+
+#include "ParallelBFS.h"
+
+namespace NetworKit {
+
+ParallelBFS::ParallelBFS(const Graph& G, node source, bool storePaths, bool storeStack, node target, double alpha, double beta) :
+	SSSP(G, source, storePaths, storeStack, target), alpha(alpha), beta(beta), bottomUpSteps(0) {
+}
+
+void ParallelBFS::run() {
+	edgeweight infDist = std::numeric_limits<edgeweight>::max();
+	const count z = G.upperNodeIdBound();
+	distances.clear();
+	distances.resize(z, infDist);
+	bottomUpSteps = 0;
+
+	const count words = (z + 63) / 64;
+	std::vector<std::atomic<uint64_t>> visited(words);
+	std::vector<uint64_t> inFrontier;
+
+	auto isVisited = [&](node v) {
+		return (visited[v / 64].load(std::memory_order_relaxed) >> (v % 64)) & 1;
+	};
+	// returns true iff the calling thread is the first one to visit v
+	auto claim = [&](node v) {
+		uint64_t mask = uint64_t(1) << (v % 64);
+		return !(visited[v / 64].fetch_or(mask, std::memory_order_relaxed) & mask);
+	};
+
+	// every level is stored, the concatenation is the BFS order
+	std::vector<std::vector<node>> levels;
+	levels.push_back({source});
+	distances[source] = 0;
+	claim(source);
+
+	// edge counts for the direction heuristic
+	count unexploredEdges = G.isDirected() ? G.numberOfEdges() : 2 * G.numberOfEdges();
+	count frontierEdges = G.degreeOut(source);
+	unexploredEdges -= std::min(unexploredEdges, frontierEdges);
+	bool bottomUp = false;
+
+	const count threads = omp_get_max_threads();
+	std::vector<std::vector<node>> localNext(threads);
+
+	while (!levels.back().empty()) {
+		const std::vector<node>& frontier = levels.back();
+		if (target != none && isVisited(target)) {
+			break;
+		}
+
+		const count previousSize = levels.size() > 1 ? levels[levels.size() - 2].size() : 0;
+		if (!bottomUp && frontierEdges > unexploredEdges / alpha) {
+			bottomUp = true;
+		} else if (bottomUp && frontier.size() < previousSize && frontier.size() < z / beta) {
+			bottomUp = false;
+		}
+
+		const edgeweight dist = distances[frontier.front()] + 1;
+		count nextEdges = 0;
+
+		if (bottomUp) {
+			++bottomUpSteps;
+			inFrontier.assign(words, 0);
+			for (node u : frontier) {
+				inFrontier[u / 64] |= uint64_t(1) << (u % 64);
+			}
+
+			#pragma omp parallel reduction(+:nextEdges)
+			{
+				std::vector<node>& next = localNext[omp_get_thread_num()];
+				#pragma omp for schedule(guided)
+				for (node v = 0; v < z; ++v) {
+					if (!G.hasNode(v) || distances[v] != infDist) continue;
+					bool found = false;
+					G.forInNeighborsOfWhile(v, [&]() {
+						return !found;
+					}, [&](node u) {
+						found = (inFrontier[u / 64] >> (u % 64)) & 1;
+					});
+					if (found) {
+						distances[v] = dist;
+						next.push_back(v);
+						nextEdges += G.degreeOut(v);
+					}
+				}
+				// mark the new nodes only after the step (implicit barrier of omp for)
+				for (node v : next) {
+					claim(v);
+				}
+			}
+		} else {
+			#pragma omp parallel reduction(+:nextEdges)
+			{
+				std::vector<node>& next = localNext[omp_get_thread_num()];
+				#pragma omp for schedule(guided)
+				for (index i = 0; i < frontier.size(); ++i) {
+					G.forNeighborsOf(frontier[i], [&](node v) {
+						if (!isVisited(v) && claim(v)) {
+							distances[v] = dist;
+							next.push_back(v);
+							nextEdges += G.degreeOut(v);
+						}
+					});
+				}
+			}
+		}
+
+		std::vector<node> nextLevel;
+		for (std::vector<node>& next : localNext) {
+			nextLevel.insert(nextLevel.end(), next.begin(), next.end());
+			next.clear();
+		}
+		levels.push_back(std::move(nextLevel));
+
+		frontierEdges = nextEdges;
+		unexploredEdges -= std::min(unexploredEdges, frontierEdges);
+	}
+
+	if (storePaths) {
+		previous.clear();
+		previous.resize(z);
+		npaths.clear();
+		npaths.resize(z, 0);
+		npaths[source] = 1;
+
+		// predecessors are exactly the in-neighbors one level closer to the source
+		for (index l = 1; l < levels.size(); ++l) {
+			const std::vector<node>& level = levels[l];
+			#pragma omp parallel for schedule(guided)
+			for (index i = 0; i < level.size(); ++i) {
+				node v = level[i];
+				G.forInNeighborsOf(v, [&](node u) {
+					if (distances[u] + 1 == distances[v]) {
+						previous[v].push_back(u);
+						npaths[v] += npaths[u];
+					}
+				});
+			}
+		}
+	}
+
+	if (storeStack) {
+		std::vector<node> empty;
+		std::swap(stack, empty);
+		for (const std::vector<node>& level : levels) {
+			stack.insert(stack.end(), level.begin(), level.end());
+		}
+	}
+}
+
+count ParallelBFS::numberOfBottomUpSteps() const {
+	return bottomUpSteps;
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,63 @@
+/*
+ * ParallelBFS.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef PARALLELBFS_H_
+#define PARALLELBFS_H_
+
+#include "../graph/Graph.h"
+#include "SSSP.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup distance
+ * Level-synchronous parallel breadth-first search that switches between
+ * top-down and bottom-up steps (direction-optimizing BFS).
+ *
+ * A top-down step scans the out-edges of the current frontier, a bottom-up step
+ * lets every unvisited node look for a parent in the frontier bitmap and stops
+ * at the first one found. Bottom-up steps pay off when the frontier is large,
+ * which is the case for the middle levels of low-diameter graphs.
+ *
+ * Computes the same distances, predecessors, numbers of paths and stack as BFS;
+ * the order of nodes with equal distance may differ.
+ *
+ * @see Beamer, Asanović, Patterson: Direction-Optimizing Breadth-First Search. SC 2012.
+ */
+class ParallelBFS : public SSSP {
+
+public:
+	/**
+	 * Constructs the ParallelBFS class for @a G and source node @a source.
+	 *
+	 * @param G The graph.
+	 * @param source The source node of the breadth-first search.
+	 * @param storePaths	store paths and number of paths?
+	 * @param storeStack	maintain a stack of nodes in decreasing order of distance
+	 * @param target	stop after the level that contains @a target
+	 * @param alpha	switch to bottom-up once the frontier has more than 1/alpha of the unexplored edges
+	 * @param beta	switch back to top-down once the shrinking frontier has less than n/beta nodes
+	 */
+	ParallelBFS(const Graph& G, node source, bool storePaths=true, bool storeStack=false, node target = none, double alpha = 14.0, double beta = 24.0);
+
+	/**
+	 * Breadth-first search from @a source.
+	 */
+	virtual void run();
+
+	/**
+	 * @return number of levels that were explored bottom-up in the last run.
+	 */
+	count numberOfBottomUpSteps() const;
+
+private:
+	double alpha;
+	double beta;
+	count bottomUpSteps;
+};
+
+} /* namespace NetworKit */
+#endif /* PARALLELBFS_H_ */
@@ -0,0 +1,101 @@
+/*
+ * TiledAPSP.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <omp.h>
+
+#include "TiledAPSP.h"
+#include "Dijkstra.h"
+#include "../io/DistanceMatrixWriter.h"
+#include "../auxiliary/Enforce.h"
+
+namespace NetworKit {
+
+TiledAPSP::TiledAPSP(const Graph& G, TileHandle handle, count tileSize) : Algorithm(), G(G), handle(handle), tileSize(tileSize), bytesPerEntry(0) {
+}
+
+TiledAPSP::TiledAPSP(const Graph& G, const std::string& path, count bytesPerEntry, count tileSize) : Algorithm(), G(G), tileSize(tileSize), path(path), bytesPerEntry(bytesPerEntry) {
+	Aux::enforce(bytesPerEntry == 1 || bytesPerEntry == 2 || bytesPerEntry == 4 || bytesPerEntry == 8, "Entries of a distance matrix must have 1, 2, 4 or 8 bytes");
+	Aux::enforce(!G.isWeighted() || bytesPerEntry >= 4, "Weighted distances need entries of 4 or 8 bytes");
+}
+
+void TiledAPSP::computeTile(node first, count rows, std::vector<edgeweight>& distances) const {
+	const count z = G.upperNodeIdBound();
+	const edgeweight infDist = std::numeric_limits<edgeweight>::max();
+	std::fill(distances.begin(), distances.end(), infDist);
+
+	if (G.isWeighted()) {
+		#pragma omp parallel for schedule(dynamic)
+		for (index i = 0; i < rows; ++i) {
+			const node s = first + i;
+			if (!G.hasNode(s)) continue;
+			Dijkstra dijkstra(G, s, false);
+			dijkstra.run();
+			std::vector<edgeweight> row = dijkstra.getDistances();
+			std::copy(row.begin(), row.end(), distances.begin() + i * z);
+		}
+	} else {
+		#pragma omp parallel
+		{
+			// the row itself marks the visited nodes, so every thread only needs a queue
+			std::vector<node> queue;
+			queue.reserve(z);
+			#pragma omp for schedule(dynamic)
+			for (index i = 0; i < rows; ++i) {
+				const node s = first + i;
+				if (!G.hasNode(s)) continue;
+				edgeweight* row = &distances[i * z];
+				queue.clear();
+				queue.push_back(s);
+				row[s] = 0;
+				for (index head = 0; head < queue.size(); ++head) {
+					const node u = queue[head];
+					const edgeweight d = row[u] + 1;
+					G.forNeighborsOf(u, [&](node v) {
+						if (row[v] == infDist) {
+							row[v] = d;
+							queue.push_back(v);
+						}
+					});
+				}
+			}
+		}
+	}
+}
+
+void TiledAPSP::run() {
+	const count z = G.upperNodeIdBound();
+	const count rowsPerTile = std::max<count>(1, std::min<count>(z, tileSize > 0 ? tileSize : 4 * omp_get_max_threads()));
+
+	TileHandle passOn = handle;
+	std::unique_ptr<DistanceMatrixWriter> writer;
+	if (!path.empty()) {
+		writer.reset(new DistanceMatrixWriter(path, z, z, bytesPerEntry));
+		passOn = [&](node first, count rows, const std::vector<edgeweight>& distances) {
+			writer->writeRows(first, rows, distances.data());
+		};
+	}
+
+	std::vector<edgeweight> distances;
+	for (node first = 0; first < z; first += rowsPerTile) {
+		const count rows = std::min(rowsPerTile, z - first);
+		distances.resize(rows * z);
+		computeTile(first, rows, distances);
+		passOn(first, rows, distances);
+	}
+	if (writer) {
+		writer->close();
+	}
+	hasRun = true;
+}
+
+std::string TiledAPSP::toString() const {
+	return "TiledAPSP";
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,82 @@
+/*
+ * TiledAPSP.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef TILEDAPSP_H_
+#define TILEDAPSP_H_
+
+#include <functional>
+#include <string>
+
+#include "../graph/Graph.h"
+#include "../base/Algorithm.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup distance
+ * All-pairs shortest path distances for graphs whose distance matrix does not fit into memory.
+ *
+ * The sources are processed in tiles of consecutive node ids. The rows of a tile are computed in
+ * parallel, one breadth-first search (or Dijkstra for weighted graphs) per source, and the tile is
+ * then passed on before the next tile is computed, so only the rows of one tile are in memory.
+ * A tile can either be handed to a callback or appended to a distance matrix file
+ * (see DistanceMatrixWriter), whose rows can then be queried lazily with DistanceMatrixReader.
+ *
+ * Unreachable pairs have the distance std::numeric_limits<edgeweight>::max(), as in APSP.
+ */
+class TiledAPSP : public Algorithm {
+
+public:
+	/**
+	 * Called with the first source of a tile, the number of rows of the tile and its
+	 * distances in row-major order; row i holds the distances from source first + i to
+	 * all node ids up to G.upperNodeIdBound().
+	 */
+	using TileHandle = std::function<void(node first, count rows, const std::vector<edgeweight>& distances)>;
+
+	/**
+	 * Passes every tile to @a handle. The handle is called sequentially in the order of the tiles.
+	 *
+	 * @param G The graph.
+	 * @param handle The handle that receives the tiles.
+	 * @param tileSize The number of sources per tile; 0 chooses four sources per thread.
+	 */
+	TiledAPSP(const Graph& G, TileHandle handle, count tileSize = 0);
+
+	/**
+	 * Writes the distance matrix to the file at @a path. Hop distances of unweighted graphs
+	 * fit into entries of 1 or 2 bytes (up to 254 or 65534 hops), weighted distances need
+	 * entries of 4 (float) or 8 (double) bytes.
+	 *
+	 * @param G The graph.
+	 * @param path The path of the distance matrix file.
+	 * @param bytesPerEntry The size of an entry of the file: 1, 2, 4 or 8.
+	 * @param tileSize The number of sources per tile; 0 chooses four sources per thread.
+	 */
+	TiledAPSP(const Graph& G, const std::string& path, count bytesPerEntry = 2, count tileSize = 0);
+
+	void run() override;
+
+	virtual std::string toString() const override;
+
+	virtual bool isParallel() const override { return true; }
+
+private:
+	const Graph& G;
+	TileHandle handle;
+	count tileSize;
+	std::string path;
+	count bytesPerEntry;
+
+	/**
+	 * Computes the distances from the sources [@a first, @a first + @a rows) into @a distances.
+	 */
+	void computeTile(node first, count rows, std::vector<edgeweight>& distances) const;
+};
+
+} /* namespace NetworKit */
+
+#endif /* TILEDAPSP_H_ */
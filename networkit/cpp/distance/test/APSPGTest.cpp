@@ -10,7 +10,10 @@
 #include "APSPGTest.h"
 #include "../APSP.h"
 #include "../DynAPSP.h"
+#include "../TiledAPSP.h"
+#include "../../io/DistanceMatrixReader.h"
 #include "../../io/METISGraphReader.h"
+#include <limits>
 #include <string>
 #include "../../auxiliary/Random.h"
 
@@ -64,6 +67,55 @@ TEST_F(APSPGTest, tryAPSP) {
 	apsp.run();
 }
 
+TEST_F(APSPGTest, testTiledAPSP) {
+	METISGraphReader reader;
+	Graph G = reader.read("input/lesmis.graph");
+	G.removeNode(5);
+	for (bool weighted : {false, true}) {
+		Graph H(G, weighted, false);
+		if (weighted) {
+			H.forEdges([&](node u, node v) {
+				H.setWeight(u, v, 1 + (u + v) % 4);
+			});
+		}
+		APSP apsp(H);
+		apsp.run();
+		const std::vector<std::vector<edgeweight> >& distances = apsp.getDistances();
+
+		// the tiles must cover all rows in order
+		count covered = 0;
+		TiledAPSP tiled(H, [&](node first, count rows, const std::vector<edgeweight>& tile) {
+			EXPECT_EQ(covered, first);
+			EXPECT_EQ(rows * H.upperNodeIdBound(), tile.size());
+			for (index i = 0; i < rows; ++i) {
+				if (!H.hasNode(first + i)) continue;
+				H.forNodes([&](node v) {
+					EXPECT_EQ(distances[first + i][v], tile[i * H.upperNodeIdBound() + v]);
+				});
+			}
+			covered += rows;
+		}, 7);
+		tiled.run();
+		EXPECT_EQ(H.upperNodeIdBound(), covered);
+
+		std::string path = "output/lesmis.nkdm";
+		if (weighted) {
+			EXPECT_THROW(TiledAPSP(H, path, 2), std::runtime_error);
+		}
+		TiledAPSP toFile(H, path, weighted ? 4 : 1);
+		toFile.run();
+		DistanceMatrixReader matrix(path);
+		EXPECT_EQ(H.upperNodeIdBound(), matrix.numberOfRows());
+		H.forNodes([&](node u) {
+			std::vector<edgeweight> row = matrix.getRow(u);
+			H.forNodes([&](node v) {
+				EXPECT_EQ(distances[u][v], row[v]);
+			});
+		});
+		EXPECT_EQ(std::numeric_limits<edgeweight>::max(), matrix.getDistance(5, 0));
+	}
+}
+
 TEST_F(APSPGTest, testDynAPSPRealGraph) {
 	METISGraphReader reader;
 	Graph G = reader.read("input/karate.graph");
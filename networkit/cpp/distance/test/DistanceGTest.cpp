@@ -12,6 +12,7 @@
 #include "../EffectiveDiameter.h"
 #include "../EffectiveDiameterApproximation.h"
 #include "../HopPlotApproximation.h"
+#include "../HyperBall.h"
 #include "../NeighborhoodFunction.h"
 #include "../NeighborhoodFunctionApproximation.h"
 #include "../NeighborhoodFunctionHeuristic.h"
@@ -19,6 +20,7 @@
 #include "../../generators/DorogovtsevMendesGenerator.h"
 #include "../../generators/ErdosRenyiGenerator.h"
 #include "../../io/METISGraphReader.h"
+#include "../../auxiliary/Random.h"
 
 namespace NetworKit {
 
@@ -279,6 +281,101 @@ TEST_F(DistanceGTest, testNeighborhoodFunctionHeuristic) {
 	EXPECT_EQ(exact.size(), heuristic.size());
 }
 
+TEST_F(DistanceGTest, testHyperBall) {
+	Aux::Random::setSeed(42, false);
+	METISGraphReader reader;
+	Graph G = reader.read("input/jazz.graph");
+	HyperBall hyperBall(G, 4096);
+	hyperBall.run();
+
+	NeighborhoodFunction nf(G);
+	nf.run();
+	auto exact = nf.getNeighborhoodFunction();
+	auto approximated = hyperBall.getNeighborhoodFunction();
+	ASSERT_EQ(exact.size(), approximated.size());
+	EXPECT_EQ(exact.size(), hyperBall.numberOfRounds());
+	for (index t = 0; t < exact.size(); ++t) {
+		EXPECT_NEAR(exact[t], approximated[t], 0.05 * exact[t]);
+	}
+
+	std::vector<double> reachable = hyperBall.getReachableNodes();
+	std::vector<double> sumOfDistances = hyperBall.getSumOfDistances();
+	std::vector<double> harmonic = hyperBall.getHarmonicCentrality();
+	std::vector<double> closeness = hyperBall.getCloseness();
+	G.forNodes([&](node u) {
+		double sum = 0;
+		double harmonicSum = 0;
+		G.BFSfrom(u, [&](node, count dist) {
+			sum += dist;
+			if (dist > 0) {
+				harmonicSum += 1.0 / dist;
+			}
+		});
+		EXPECT_NEAR(G.numberOfNodes() - 1, reachable[u], 0.1 * G.numberOfNodes());
+		EXPECT_NEAR(sum, sumOfDistances[u], 0.1 * sum);
+		EXPECT_NEAR(harmonicSum, harmonic[u], 0.1 * harmonicSum);
+		EXPECT_NEAR((G.numberOfNodes() - 1) / sum, closeness[u], 0.1 * (G.numberOfNodes() - 1) / sum);
+	});
+}
+
+TEST_F(DistanceGTest, testHyperBallDisconnected) {
+	Aux::Random::setSeed(42, false);
+	// a path, a triangle and an isolated node
+	Graph G(8);
+	G.addEdge(0, 1);
+	G.addEdge(1, 2);
+	G.addEdge(2, 3);
+	G.addEdge(4, 5);
+	G.addEdge(5, 6);
+	G.addEdge(6, 4);
+
+	HyperBall hyperBall(G, 1024);
+	hyperBall.run();
+	EXPECT_EQ(3u, hyperBall.numberOfRounds());
+	std::vector<double> reachable = hyperBall.getReachableNodes();
+	std::vector<double> sumOfDistances = hyperBall.getSumOfDistances();
+	const double tol = 0.1;
+	for (node u = 0; u < 4; ++u) {
+		EXPECT_NEAR(3, reachable[u], tol);
+	}
+	EXPECT_NEAR(6, sumOfDistances[0], tol);
+	EXPECT_NEAR(4, sumOfDistances[1], tol);
+	for (node u = 4; u < 7; ++u) {
+		EXPECT_NEAR(2, reachable[u], tol);
+		EXPECT_NEAR(2, sumOfDistances[u], tol);
+	}
+	EXPECT_EQ(0, reachable[7]);
+	EXPECT_EQ(0, hyperBall.getCloseness()[7]);
+	std::vector<double> neighborhoodFunction = hyperBall.getNeighborhoodFunction();
+	ASSERT_EQ(3u, neighborhoodFunction.size());
+	EXPECT_NEAR(12, neighborhoodFunction[0], tol);
+	EXPECT_NEAR(16, neighborhoodFunction[1], tol);
+	EXPECT_NEAR(18, neighborhoodFunction[2], tol);
+
+	EffectiveDiameterApproximation aef(G, 0.9, 1024);
+	aef.run();
+	// 2, 2, 2, 3 for the path, 1, 1, 1 for the triangle and 0 for the isolated node
+	EXPECT_NEAR(12.0 / 8, aef.getEffectiveDiameter(), 0.2);
+
+	HopPlotApproximation hp(G, 0, 1024);
+	hp.run();
+	std::map<count, double> hopPlot = hp.getHopPlot();
+	EXPECT_NEAR(8.0 / 26, hopPlot[0], 1e-9);
+	EXPECT_NEAR(1.0, hopPlot[3], 1e-2);
+
+	// balls of directed graphs follow the out-edges
+	Graph D(3, false, true);
+	D.addEdge(0, 1);
+	D.addEdge(1, 2);
+	HyperBall directed(D, 1024);
+	directed.run();
+	reachable = directed.getReachableNodes();
+	EXPECT_NEAR(2, reachable[0], tol);
+	EXPECT_NEAR(1, reachable[1], tol);
+	EXPECT_EQ(0, reachable[2]);
+	EXPECT_NEAR(3, directed.getSumOfDistances()[0], tol);
+}
+
 } /* namespace NetworKit */
 
 #endif /*NOGTEST */
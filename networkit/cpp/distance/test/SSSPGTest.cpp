@@ -8,12 +8,17 @@
 #include "SSSPGTest.h"
 #include "../DynBFS.h"
 #include "../BFS.h"
+#include "../ParallelBFS.h"
 #include "../DynDijkstra.h"
 #include "../Dijkstra.h"
+#include "../IncompleteDijkstra.h"
+#include "../../generators/ErdosRenyiGenerator.h"
+#include "../../auxiliary/Random.h"
 #include "../../io/METISGraphReader.h"
 #include "../../auxiliary/Log.h"
 
 #include <stack>
+#include <algorithm>
 
 
 namespace NetworKit {
@@ -191,4 +196,84 @@ TEST_F(SSSPGTest, testDirectedDijkstra) {
 	EXPECT_EQ(sssp.distance(6), 1);
 	EXPECT_EQ(sssp.distance(7), 3);
 }
+
+TEST_F(SSSPGTest, testDijkstraPriorityQueues) {
+	Aux::Random::setSeed(42, false);
+	Graph G = ErdosRenyiGenerator(500, 0.02, true).generate();
+	G = Graph(G, true, true);
+	G.forEdges([&](node u, node v) {
+		// integral weights produce many ties
+		G.setWeight(u, v, Aux::Random::integer(1, 10));
+	});
+	node s = 0;
+
+	Dijkstra reference(G, s, true, true, none, setQueue);
+	reference.run();
+
+	for (DijkstraQueue queue : {dAryHeap, radixHeap}) {
+		Dijkstra sssp(G, s, true, true, none, queue);
+		sssp.run();
+		std::vector<node> stack = sssp.getStack();
+		EXPECT_EQ(reference.getStack(false).size(), stack.size());
+		G.forNodes([&](node u) {
+			EXPECT_EQ(reference.distance(u), sssp.distance(u));
+			EXPECT_EQ(reference.numberOfPaths(u), sssp.numberOfPaths(u));
+		});
+		for (index i = 1; i < stack.size(); ++i) {
+			EXPECT_LE(sssp.distance(stack[i - 1]), sssp.distance(stack[i]));
+		}
+
+		IncompleteDijkstra incomplete(&G, {s}, nullptr, queue);
+		count settled = 0;
+		edgeweight previous = 0;
+		while (incomplete.hasNext()) {
+			auto next = incomplete.next();
+			EXPECT_EQ(reference.distance(next.first), next.second);
+			EXPECT_LE(previous, next.second);
+			previous = next.second;
+			++settled;
+		}
+		EXPECT_EQ(stack.size(), settled);
+	}
+}
+
+TEST_F(SSSPGTest, testParallelBFS) {
+	Aux::Random::setSeed(42, false);
+	for (bool directed : {false, true}) {
+		Graph G = ErdosRenyiGenerator(2000, 0.004, directed).generate();
+		node s = G.randomNode();
+		while (G.degreeOut(s) == 0) {
+			s = G.randomNode();
+		}
+		BFS reference(G, s, true, true);
+		reference.run();
+
+		// alpha = 0 never goes bottom-up, a huge alpha always does
+		for (double alpha : {0.0, 14.0, 1e12}) {
+			ParallelBFS bfs(G, s, true, true, none, alpha);
+			bfs.run();
+			if (alpha == 0.0) {
+				EXPECT_EQ(0u, bfs.numberOfBottomUpSteps());
+			} else if (alpha > 1.0) {
+				EXPECT_LT(0u, bfs.numberOfBottomUpSteps());
+			}
+
+			G.forNodes([&](node u) {
+				EXPECT_EQ(reference.distance(u), bfs.distance(u));
+				EXPECT_EQ(reference.numberOfPaths(u), bfs.numberOfPaths(u));
+				std::vector<node> expected = reference.getPredecessors(u);
+				std::vector<node> actual = bfs.getPredecessors(u);
+				std::sort(expected.begin(), expected.end());
+				std::sort(actual.begin(), actual.end());
+				EXPECT_EQ(expected, actual);
+			});
+
+			std::vector<node> stack = bfs.getStack();
+			EXPECT_EQ(reference.getStack(false).size(), stack.size());
+			for (index i = 1; i < stack.size(); ++i) {
+				EXPECT_LE(bfs.distance(stack[i - 1]), bfs.distance(stack[i]));
+			}
+		}
+	}
+}
 }
@@ -5,57 +5,323 @@
  *      Author: cls
  */
 
+#include <algorithm>
+#include <sstream>
+#include <unordered_map>
+
 #include "GraphUpdater.h"
 #include "../auxiliary/Log.h"
+#include "../auxiliary/Parallel.h"
 
 namespace NetworKit {
 
+namespace {
+
+/**
+ * The part of an edge event that concerns one adjacency row. Row r is the
+ * out-row of node r for undirected graphs, and the out-row of node r/2 (r even)
+ * or in-row of node r/2 (r odd) for directed graphs.
+ */
+struct RowOperation {
+	index row;
+	index event;
+	node target;
+	bool source;	//!< true for the row of the first endpoint, which accounts for the edge
+	index position;	//!< position of the entry created by this operation, none otherwise
+};
+
+// groups of this size or smaller search their row linearly for every event
+constexpr count linearSearchLimit = 8;
+
+} /* namespace */
+
 GraphUpdater::GraphUpdater(Graph& G) : G(G) {
 }
 
 void GraphUpdater::update(std::vector<GraphEvent>& stream) {
 	for (GraphEvent ev : stream) {
-		TRACE("event: " , ev.toString());
-		switch (ev.type) {
-			case GraphEvent::NODE_ADDITION : {
-				G.addNode();
-				break;
+		apply(ev);
+	}
+	// record graph size
+	size.push_back(std::make_pair(G.numberOfNodes(), G.numberOfEdges()));
+}
+
+void GraphUpdater::updateBatch(const std::vector<GraphEvent>& stream) {
+	auto isEdgeEvent = [](const GraphEvent& ev) {
+		return ev.type == GraphEvent::EDGE_ADDITION || ev.type == GraphEvent::EDGE_REMOVAL
+			|| ev.type == GraphEvent::EDGE_WEIGHT_UPDATE || ev.type == GraphEvent::EDGE_WEIGHT_INCREMENT;
+	};
+
+	index i = 0;
+	while (i < stream.size()) {
+		if (!isEdgeEvent(stream[i])) {
+			apply(stream[i]);
+			++i;
+			continue;
+		}
+		index end = i;
+		while (end < stream.size() && isEdgeEvent(stream[end])) {
+			++end;
+		}
+		applyEdgeBatch(stream, i, end);
+		i = end;
+	}
+	// record graph size
+	size.push_back(std::make_pair(G.numberOfNodes(), G.numberOfEdges()));
+}
+
+void GraphUpdater::apply(const GraphEvent& ev) {
+	TRACE("event: " , ev.toString());
+	switch (ev.type) {
+		case GraphEvent::NODE_ADDITION : {
+			G.addNode();
+			break;
+		}
+		case GraphEvent::NODE_REMOVAL : {
+			G.removeNode(ev.u);
+			break;
+		}
+		case GraphEvent::NODE_RESTORATION :{
+			G.restoreNode(ev.u);
+			break;
+		}
+		case GraphEvent::EDGE_ADDITION : {
+			G.addEdge(ev.u, ev.v, ev.w);
+			break;
+		}
+		case GraphEvent::EDGE_REMOVAL : {
+			G.removeEdge(ev.u, ev.v);
+			break;
+		}
+		case GraphEvent::EDGE_WEIGHT_UPDATE : {
+			G.setWeight(ev.u, ev.v, ev.w);
+			break;
+		}
+		case GraphEvent::EDGE_WEIGHT_INCREMENT : {
+			G.increaseWeight(ev.u, ev.v, ev.w);
+			break;
+		}
+		case GraphEvent::TIME_STEP : {
+			G.timeStep();
+			break;
+		}
+		default: {
+			throw std::runtime_error("unknown event type");
+		}
+	}
+}
+
+void GraphUpdater::applyEdgeBatch(const std::vector<GraphEvent>& stream, index begin, index end) {
+	if (!G.weighted) {
+		for (index e = begin; e < end; ++e) {
+			if (stream[e].type == GraphEvent::EDGE_WEIGHT_UPDATE || stream[e].type == GraphEvent::EDGE_WEIGHT_INCREMENT) {
+				throw std::runtime_error("Cannot set edge weight in unweighted graph.");
 			}
-			case GraphEvent::NODE_REMOVAL : {
-				G.removeNode(ev.u);
-				break;
+		}
+	}
+
+	// split every event into the operations on the rows of its endpoints
+	std::vector<RowOperation> ops;
+	ops.reserve(2 * (end - begin));
+	for (index e = begin; e < end; ++e) {
+		node u = stream[e].u;
+		node v = stream[e].v;
+		if (G.directed) {
+			ops.push_back({2 * u, e, v, true, none});
+			ops.push_back({2 * v + 1, e, u, false, none});
+		} else {
+			ops.push_back({u, e, v, true, none});
+			if (u != v) {
+				ops.push_back({v, e, u, false, none});
+			}
+		}
+	}
+	// the operations of a row keep the order of the stream
+	Aux::Parallel::sort(ops.begin(), ops.end(), [](const RowOperation& a, const RowOperation& b) {
+		return a.row < b.row || (a.row == b.row && a.event < b.event);
+	});
+	std::vector<index> groupBegin;
+	for (index k = 0; k < ops.size(); ++k) {
+		if (k == 0 || ops[k].row != ops[k - 1].row) {
+			groupBegin.push_back(k);
+		}
+	}
+	groupBegin.push_back(ops.size());
+
+	std::vector<char> createdEvent(end - begin, 0);
+	int64_t edgeDiff = 0;
+	int64_t selfLoopDiff = 0;
+	index failedEvent = none;
+
+	#pragma omp parallel for schedule(dynamic) reduction(+:edgeDiff,selfLoopDiff)
+	for (index g = 0; g < groupBegin.size() - 1; ++g) {
+		const index first = groupBegin[g];
+		const index last = groupBegin[g + 1];
+		const index row = ops[first].row;
+		const bool inRow = G.directed && (row % 2 == 1);
+		const node x = G.directed ? row / 2 : row;
+
+		std::vector<node>& adj = inRow ? G.inEdges[x] : G.outEdges[x];
+		std::vector<edgeweight>* weights = G.weighted ? &(inRow ? G.inEdgeWeights[x] : G.outEdgeWeights[x]) : nullptr;
+		std::vector<edgeid>* ids = G.edgesIndexed ? &(inRow ? G.inEdgeIds[x] : G.outEdgeIds[x]) : nullptr;
+		count& deg = inRow ? G.inDeg[x] : G.outDeg[x];
+
+		// positions of the targets in the row, in increasing order; like
+		// indexInOutEdgeArray an operation refers to the first entry of its target
+		const bool indexedRow = adj.size() >= G.adjacencyIndexThreshold;
+		const bool useIndex = indexedRow || last - first > linearSearchLimit;
+		std::unordered_map<node, std::vector<index>> positions;
+		if (useIndex) {
+			for (index k = first; k < last; ++k) {
+				positions[ops[k].target];
+			}
+			// the adjacency index of the row stays valid until the batch is done
+			const Graph::AdjacencyIndex& adjIndex = inRow ? G.inEdgeIndex : G.outEdgeIndex;
+			auto rowIndex = indexedRow ? adjIndex.find(x) : adjIndex.end();
+			if (rowIndex != adjIndex.end()) {
+				for (auto& entry : positions) {
+					auto range = rowIndex->second.equal_range(entry.first);
+					for (auto it = range.first; it != range.second; ++it) {
+						entry.second.push_back(it->second);
+					}
+					std::sort(entry.second.begin(), entry.second.end());
+				}
+			} else {
+				for (index i = 0; i < adj.size(); ++i) {
+					auto it = positions.find(adj[i]);
+					if (it != positions.end()) {
+						it->second.push_back(i);
+					}
+				}
+			}
+		}
+		auto lookup = [&](node t) -> index {
+			if (useIndex) {
+				const std::vector<index>& pos = positions[t];
+				return pos.empty() ? none : pos.front();
 			}
-			case GraphEvent::NODE_RESTORATION :{
-				G.restoreNode(ev.u);
-				break;
+			for (index i = 0; i < adj.size(); ++i) {
+				if (adj[i] == t) {
+					return i;
+				}
 			}
-			case GraphEvent::EDGE_ADDITION : {
-				G.addEdge(ev.u, ev.v, ev.w);
-				break;
+			return none;
+		};
+		auto append = [&](RowOperation& op, edgeweight w) {
+			op.position = adj.size();
+			adj.push_back(op.target);
+			if (weights) {
+				weights->push_back(w);
 			}
-			case GraphEvent::EDGE_REMOVAL : {
-				G.removeEdge(ev.u, ev.v);
-				break;
+			if (ids) {
+				// the ids are assigned in stream order after all rows are done
+				ids->push_back(none);
 			}
-			case GraphEvent::EDGE_WEIGHT_UPDATE : {
-				G.setWeight(ev.u, ev.v, ev.w);
-				break;
+			++deg;
+			if (useIndex) {
+				positions[op.target].push_back(op.position);
 			}
-			case GraphEvent::EDGE_WEIGHT_INCREMENT : {
-				G.setWeight(ev.u, ev.v, G.weight(ev.u, ev.v) + ev.w);
-				break;
+			if (op.source) {
+				createdEvent[op.event - begin] = 1;
+				++edgeDiff;
+				if (op.target == x) {
+					++selfLoopDiff;
+				}
 			}
-			case GraphEvent::TIME_STEP : {
-				G.timeStep();
-				break;
+		};
+
+		for (index k = first; k < last; ++k) {
+			RowOperation& op = ops[k];
+			const GraphEvent& ev = stream[op.event];
+			switch (ev.type) {
+				case GraphEvent::EDGE_ADDITION : {
+					append(op, ev.w);
+					break;
+				}
+				case GraphEvent::EDGE_REMOVAL : {
+					index i = lookup(op.target);
+					if (i == none) {
+						#pragma omp critical
+						failedEvent = std::min(failedEvent, op.event);
+						break;
+					}
+					adj[i] = none;
+					if (weights) {
+						(*weights)[i] = nullWeight;
+					}
+					--deg;
+					if (useIndex) {
+						std::vector<index>& pos = positions[op.target];
+						pos.erase(pos.begin());
+					}
+					if (op.source) {
+						--edgeDiff;
+						if (op.target == x) {
+							--selfLoopDiff;
+						}
+					}
+					break;
+				}
+				case GraphEvent::EDGE_WEIGHT_UPDATE :
+				case GraphEvent::EDGE_WEIGHT_INCREMENT : {
+					index i = lookup(op.target);
+					if (i == none) {
+						// like setWeight and increaseWeight, create the edge
+						append(op, ev.w);
+					} else if (ev.type == GraphEvent::EDGE_WEIGHT_UPDATE) {
+						(*weights)[i] = ev.w;
+					} else {
+						(*weights)[i] += ev.w;
+					}
+					break;
+				}
+				default: {
+					break;
+				}
 			}
-			default: {
-				throw std::runtime_error("unknown event type");
+		}
+	}
+
+	if (G.hasAdjacencyIndex()) {
+		std::vector<node> outRows, inRows;
+		for (index g = 0; g < groupBegin.size() - 1; ++g) {
+			const index row = ops[groupBegin[g]].row;
+			if (G.directed && row % 2 == 1) {
+				inRows.push_back(row / 2);
+			} else {
+				outRows.push_back(G.directed ? row / 2 : row);
 			}
 		}
+		G.reindexAdjacencyArrays(outRows, false);
+		G.reindexAdjacencyArrays(inRows, true);
+	}
+
+	G.m = static_cast<count>(static_cast<int64_t>(G.m) + edgeDiff);
+	G.storedNumberOfSelfLoops = static_cast<count>(static_cast<int64_t>(G.storedNumberOfSelfLoops) + selfLoopDiff);
+
+	if (G.edgesIndexed) {
+		std::vector<edgeid> newId(end - begin, none);
+		for (index e = 0; e < end - begin; ++e) {
+			if (createdEvent[e]) {
+				newId[e] = G.omega++;
+			}
+		}
+		#pragma omp parallel for
+		for (index k = 0; k < ops.size(); ++k) {
+			const RowOperation& op = ops[k];
+			if (op.position != none) {
+				const bool inRow = G.directed && (op.row % 2 == 1);
+				const node x = G.directed ? op.row / 2 : op.row;
+				(inRow ? G.inEdgeIds[x] : G.outEdgeIds[x])[op.position] = newId[op.event - begin];
+			}
+		}
+	}
+
+	if (failedEvent != none) {
+		std::stringstream strm;
+		strm << "edge (" << stream[failedEvent].u << "," << stream[failedEvent].v << ") does not exist";
+		throw std::runtime_error(strm.str());
 	}
-	// record graph size
-	size.push_back(std::make_pair(G.numberOfNodes(), G.numberOfEdges()));
 }
 
 std::vector<std::pair<count, count> > GraphUpdater::getSizeTimeline() {
@@ -24,6 +24,18 @@ public:
 
 	void update(std::vector<GraphEvent>& stream);
 
+	/**
+	 * Applies the events of @a stream with the same result as update().
+	 * Consecutive edge events are grouped by the adjacency rows they modify;
+	 * every row is searched at most once per group and the rows are updated
+	 * in parallel. Node events and time steps are applied sequentially and
+	 * separate the groups.
+	 *
+	 * If an event fails, e.g. the removal of a nonexisting edge, an exception
+	 * is thrown after the group has been applied.
+	 */
+	void updateBatch(const std::vector<GraphEvent>& stream);
+
 	std::vector<std::pair<count, count> > getSizeTimeline();
 
 	static bool compare(GraphEvent a, GraphEvent b);
@@ -33,6 +45,16 @@ private:
 
 	Graph& G;
 	std::vector<std::pair<count, count> > size;
+
+	/**
+	 * Applies a single event.
+	 */
+	void apply(const GraphEvent& ev);
+
+	/**
+	 * Applies the edge events stream[begin], ..., stream[end-1] as one batch.
+	 */
+	void applyEdgeBatch(const std::vector<GraphEvent>& stream, index begin, index end);
 };
 
 } /* namespace NetworKit */
@@ -11,6 +11,7 @@
 #include "../../auxiliary/Log.h"
 #include "../GraphEvent.h"
 #include "../GraphUpdater.h"
+#include "../../auxiliary/Random.h"
 
 namespace NetworKit {
 
@@ -51,4 +52,93 @@ TEST_F(DynamicsGTest, testGraphEventIncrement) {
 
 }
 
+TEST_F(DynamicsGTest, testGraphUpdaterBatch) {
+	Aux::Random::setSeed(42, false);
+	for (index run = 0; run < 4; ++run) {
+		const bool directed = run % 2 == 1;
+		// the second pair of runs uses the adjacency index of the hub rows
+		const bool indexed = run >= 2;
+		Graph G(100, true, directed);
+		G.indexEdges();
+		if (indexed) {
+			G.buildAdjacencyIndex(16);
+		}
+		Graph reference(G);
+
+		// node 0 is a hub that gets many events in every batch
+		std::vector<GraphEvent> stream;
+		GraphUpdater refUpdater(reference);
+		for (index i = 0; i < 5000; ++i) {
+			std::vector<GraphEvent> single;
+			double r = Aux::Random::real();
+			node u = Aux::Random::probability() < 0.3 ? 0 : reference.randomNode();
+			node v = reference.randomNode();
+			if (i % 1000 == 999) {
+				single.emplace_back(GraphEvent::NODE_ADDITION);
+			} else if (r < 0.5) {
+				single.emplace_back(GraphEvent::EDGE_ADDITION, u, v, Aux::Random::real());
+			} else if (r < 0.7 && reference.degreeOut(u) > 0) {
+				single.emplace_back(GraphEvent::EDGE_REMOVAL, u, reference.randomNeighbor(u));
+			} else if (r < 0.85) {
+				single.emplace_back(GraphEvent::EDGE_WEIGHT_UPDATE, u, v, Aux::Random::real());
+			} else {
+				single.emplace_back(GraphEvent::EDGE_WEIGHT_INCREMENT, u, v, Aux::Random::real());
+			}
+			refUpdater.update(single);
+			stream.push_back(single.front());
+		}
+
+		GraphUpdater updater(G);
+		if (indexed) {
+			// later batches start with rows that are already indexed
+			for (index b = 0; b < stream.size(); b += 1000) {
+				std::vector<GraphEvent> batch(stream.begin() + b, stream.begin() + std::min<index>(b + 1000, stream.size()));
+				updater.updateBatch(batch);
+			}
+			EXPECT_TRUE(G.hasAdjacencyIndex());
+		} else {
+			updater.updateBatch(stream);
+		}
+
+		EXPECT_EQ(reference.numberOfNodes(), G.numberOfNodes());
+		EXPECT_EQ(reference.numberOfEdges(), G.numberOfEdges());
+		EXPECT_EQ(reference.numberOfSelfLoops(), G.numberOfSelfLoops());
+		EXPECT_EQ(reference.upperEdgeIdBound(), G.upperEdgeIdBound());
+		reference.forNodes([&](node u) {
+			EXPECT_EQ(reference.degreeOut(u), G.degreeOut(u));
+			EXPECT_EQ(reference.degreeIn(u), G.degreeIn(u));
+		});
+		std::vector<std::tuple<node, node, edgeweight, edgeid>> expected, actual;
+		reference.forEdges([&](node u, node v, edgeweight w, edgeid eid) {
+			expected.emplace_back(u, v, w, eid);
+		});
+		G.forEdges([&](node u, node v, edgeweight w, edgeid eid) {
+			actual.emplace_back(u, v, w, eid);
+		});
+		EXPECT_EQ(expected, actual);
+		if (directed) {
+			reference.forNodes([&](node v) {
+				std::vector<std::tuple<node, edgeweight, edgeid>> expectedIn, actualIn;
+				reference.forInEdgesOf(v, [&](node, node u, edgeweight w, edgeid eid) {
+					expectedIn.emplace_back(u, w, eid);
+				});
+				G.forInEdgesOf(v, [&](node, node u, edgeweight w, edgeid eid) {
+					actualIn.emplace_back(u, w, eid);
+				});
+				EXPECT_EQ(expectedIn, actualIn);
+			});
+		}
+		// lookups through the rebuilt index find the same entries
+		reference.forEdges([&](node u, node v, edgeweight w) {
+			EXPECT_EQ(reference.weight(u, v), G.weight(u, v));
+			EXPECT_TRUE(G.hasEdge(u, v));
+		});
+
+		// removing a nonexisting edge fails as in update()
+		node u = G.addNode();
+		std::vector<GraphEvent> invalid = {GraphEvent(GraphEvent::EDGE_REMOVAL, u, 0)};
+		EXPECT_THROW(updater.updateBatch(invalid), std::runtime_error);
+	}
+}
+
 } /* namespace NetworKit */
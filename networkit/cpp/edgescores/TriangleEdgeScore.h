@@ -15,11 +15,10 @@ namespace NetworKit {
 /**
  * A parallel triangle counting implementation based on ideas in [0].
  *
- * This implementation avoids less work but needs therefore also less checks and
- * is (apart from a fast initialization) parallel without any locks. In experiments
- * this implementation seems to be fast both in non-parallel as well as in parallel
- * settings. With only one thread its performance is similar to the sequential
- * ChibaNishizekiTriangleEdgeScore in NetworKit.
+ * The triangles are listed by TriangleEnumerator, which intersects sorted
+ * adjacency arrays of the degree-oriented graph and needs no per-thread node
+ * markers. Each edge receives the number of triangles it is part of.
+ * The graph must be undirected; run() throws a std::runtime_error for directed graphs.
  *
  * [0] Triangle Listing Algorithms: Back from the Diversion
  * Mark Ortmann and Ulrik Brandes                                                                          *
@@ -10,6 +10,9 @@
 #include "ChibaNishizekiTriangleEdgeScoreGTest.h"
 #include "../ChibaNishizekiTriangleEdgeScore.h"
 #include "../TriangleEdgeScore.h"
+#include "../../graph/TriangleEnumerator.h"
+#include "../../generators/BarabasiAlbertGenerator.h"
+#include "../../generators/ErdosRenyiGenerator.h"
 
 namespace NetworKit {
 
@@ -152,6 +155,33 @@ TEST_F(ChibaNishizekiTriangleEdgeScoreGTest, testNewTriangleCountsSimple) {
 	EXPECT_EQ(1, (counts[g.edgeId(5,4)])) << "wrong triangle count";
 }
 
+TEST_F(ChibaNishizekiTriangleEdgeScoreGTest, testNewTriangleCountsRandom) {
+	// skewed degrees, so that both merging and galloping intersections are used
+	Graph ba = BarabasiAlbertGenerator(10, 2000, 10).generate();
+	Graph er = ErdosRenyiGenerator(1000, 0.02).generate();
+	node hub = er.addNode();
+	er.forNodes([&](node u) {
+		if (u != hub) er.addEdge(hub, u);
+	});
+	er.removeNode(7);
+
+	for (Graph* g : {&ba, &er}) {
+		g->indexEdges();
+
+		ChibaNishizekiTriangleEdgeScore reference(*g);
+		reference.run();
+		TriangleEdgeScore counter(*g);
+		counter.run();
+
+		count sum = 0;
+		g->forEdges([&](node u, node v, edgeid eid) {
+			EXPECT_EQ(reference.scores()[eid], counter.scores()[eid]) << "wrong triangle count for edge (" << u << ", " << v << ")";
+			sum += counter.scores()[eid];
+		});
+		EXPECT_LT(0u, sum);
+		EXPECT_EQ(sum / 3, TriangleEnumerator(*g).numberOfTriangles());
+	}
+}
 
 }
 /* namespace NetworKit */
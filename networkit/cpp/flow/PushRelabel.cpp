@@ -0,0 +1,350 @@
+/*
+ * PushRelabel.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include "PushRelabel.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <queue>
+#include <stdexcept>
+
+namespace NetworKit {
+
+PushRelabel::PushRelabel(const Graph &graph, node source, node sink) : graph(graph), source(source), sink(sink), flowValue(0) {
+}
+
+void PushRelabel::buildResidualNetwork() {
+	const count z = graph.upperNodeIdBound();
+	const bool directed = graph.isDirected();
+
+	arcBegin.assign(z + 1, 0);
+	graph.parallelForNodes([&](node u) {
+		count arcs = 0;
+		graph.forEdgesOf(u, [&](node, node v) {
+			if (v != u) ++arcs;
+		});
+		if (directed) {
+			graph.forInEdgesOf(u, [&](node, node v) {
+				if (v != u) ++arcs;
+			});
+		}
+		arcBegin[u + 1] = arcs;
+	});
+	for (index u = 0; u < z; ++u) {
+		arcBegin[u + 1] += arcBegin[u];
+	}
+
+	head.resize(arcBegin[z]);
+	reverse.resize(arcBegin[z]);
+	residual.resize(arcBegin[z]);
+	// the two arcs of an edge, self-loops have none
+	edgeArc.assign(graph.upperEdgeIdBound(), none);
+	std::vector<index> reverseArc(graph.upperEdgeIdBound(), none);
+
+	graph.parallelForNodes([&](node u) {
+		index a = arcBegin[u];
+		graph.forEdgesOf(u, [&](node, node v, edgeweight w, edgeid eid) {
+			if (v == u) return;
+			head[a] = v;
+			residual[a] = w;
+			if (!directed && u > v) {
+				reverseArc[eid] = a;
+			} else {
+				edgeArc[eid] = a;
+			}
+			++a;
+		});
+		if (directed) {
+			// reverse arcs of the incoming edges start without capacity
+			graph.forInEdgesOf(u, [&](node, node v, edgeweight, edgeid eid) {
+				if (v == u) return;
+				head[a] = v;
+				residual[a] = 0;
+				reverseArc[eid] = a;
+				++a;
+			});
+		}
+	});
+	graph.parallelForEdges([&](node u, node v, edgeid eid) {
+		if (u != v) {
+			reverse[edgeArc[eid]] = reverseArc[eid];
+			reverse[reverseArc[eid]] = edgeArc[eid];
+		}
+	});
+}
+
+std::vector<node> PushRelabel::globalRelabel(node target, node excluded, std::vector<count>& labelCount) {
+	const count n = graph.numberOfNodes();
+	const count z = graph.upperNodeIdBound();
+	label.assign(z, n);
+	labelCount.assign(n + 1, 0);
+
+	std::vector<std::atomic<bool>> visited(z);
+	for (node u = 0; u < z; ++u) {
+		visited[u].store(false, std::memory_order_relaxed);
+	}
+	visited[target] = true;
+	visited[excluded] = true;
+	label[target] = 0;
+	labelCount[0] = 1;
+
+	// breadth-first search along the reverse residual arcs
+	std::vector<node> frontier{target};
+	index distance = 0;
+	while (!frontier.empty()) {
+		++distance;
+		std::vector<node> next;
+		#pragma omp parallel if(frontier.size() > 256)
+		{
+			std::vector<node> local;
+			#pragma omp for schedule(guided) nowait
+			for (index i = 0; i < frontier.size(); ++i) {
+				node y = frontier[i];
+				for (index a = arcBegin[y]; a < arcBegin[y + 1]; ++a) {
+					node x = head[a];
+					if (residual[reverse[a]] > 0 && !visited[x].load(std::memory_order_relaxed) && !visited[x].exchange(true)) {
+						label[x] = distance;
+						local.push_back(x);
+					}
+				}
+			}
+			#pragma omp critical
+			next.insert(next.end(), local.begin(), local.end());
+		}
+		labelCount[distance] = next.size();
+		frontier.swap(next);
+	}
+
+	std::vector<node> active;
+	#pragma omp parallel
+	{
+		std::vector<node> local;
+		#pragma omp for schedule(static) nowait
+		for (node u = 0; u < z; ++u) {
+			if (u != target && excess[u] > 0 && label[u] < n) {
+				local.push_back(u);
+			}
+		}
+		#pragma omp critical
+		active.insert(active.end(), local.begin(), local.end());
+	}
+	return active;
+}
+
+void PushRelabel::discharge(node target, node excluded) {
+	const count n = graph.numberOfNodes();
+	const count z = graph.upperNodeIdBound();
+	// arcs scanned between two global relabelings
+	const count relabelWork = n + head.size();
+
+	std::vector<edgeweight> addedExcess(z, 0);
+	std::vector<edgeweight> remainingExcess(z, 0);
+	std::vector<index> newLabel(z, none);
+	std::vector<std::atomic<bool>> touched(z);
+	for (node u = 0; u < z; ++u) {
+		touched[u].store(false, std::memory_order_relaxed);
+	}
+	std::vector<count> labelCount;
+
+	while (true) {
+		std::vector<node> active = globalRelabel(target, excluded, labelCount);
+		if (active.empty()) {
+			break;
+		}
+
+		count work = 0;
+		while (!active.empty() && work < relabelWork) {
+			// discharge all active nodes against the labels and excesses of the previous round
+			std::vector<node> changed;
+			#pragma omp parallel reduction(+:work)
+			{
+				std::vector<node> local;
+				#pragma omp for schedule(dynamic, 16) nowait
+				for (index i = 0; i < active.size(); ++i) {
+					const node v = active[i];
+					edgeweight e = excess[v];
+					index d = label[v];
+
+					while (e > 0) {
+						index relabel = n;
+						bool skipped = false;
+						for (index a = arcBegin[v]; a < arcBegin[v + 1] && e > 0; ++a) {
+							++work;
+							edgeweight r;
+							#pragma omp atomic read
+							r = residual[a];
+							if (r <= 0) continue;
+
+							const node w = head[a];
+							const bool admissible = (d == label[w] + 1);
+							if (admissible && w != target && excess[w] > 0) {
+								// both nodes are active, only one of them may push to the other
+								const bool wins = label[v] == label[w] + 1 || label[v] + 1 < label[w] || (label[v] == label[w] && v < w);
+								if (!wins) {
+									skipped = true;
+									continue;
+								}
+							}
+							if (admissible) {
+								const edgeweight delta = std::min(r, e);
+								#pragma omp atomic
+								residual[a] -= delta;
+								#pragma omp atomic
+								residual[reverse[a]] += delta;
+								#pragma omp atomic
+								addedExcess[w] += delta;
+								e -= delta;
+								r -= delta;
+								if (!touched[w].load(std::memory_order_relaxed) && !touched[w].exchange(true)) {
+									local.push_back(w);
+								}
+							}
+							if (r > 0 && label[w] >= d) {
+								relabel = std::min(relabel, label[w] + 1);
+							}
+						}
+						if (e == 0 || skipped) {
+							break;
+						}
+						d = relabel;
+						if (d == n) {
+							break;
+						}
+					}
+
+					newLabel[v] = d;
+					remainingExcess[v] = e;
+					if (!touched[v].exchange(true)) {
+						local.push_back(v);
+					}
+				}
+				#pragma omp critical
+				changed.insert(changed.end(), local.begin(), local.end());
+			}
+
+			// apply the new labels and excesses
+			#pragma omp parallel for
+			for (index i = 0; i < active.size(); ++i) {
+				const node v = active[i];
+				excess[v] = remainingExcess[v];
+				if (newLabel[v] != label[v]) {
+					#pragma omp atomic
+					--labelCount[label[v]];
+					if (newLabel[v] < n) {
+						#pragma omp atomic
+						++labelCount[newLabel[v]];
+					}
+					std::swap(label[v], newLabel[v]);
+				}
+			}
+			#pragma omp parallel for
+			for (index i = 0; i < changed.size(); ++i) {
+				const node u = changed[i];
+				excess[u] += addedExcess[u];
+				addedExcess[u] = 0;
+				touched[u].store(false, std::memory_order_relaxed);
+			}
+
+			// gap heuristic: no node above an empty label can reach the target
+			index gap = n;
+			for (node v : active) {
+				if (label[v] != newLabel[v] && labelCount[newLabel[v]] == 0) {
+					gap = std::min(gap, newLabel[v]);
+				}
+			}
+			if (gap < n) {
+				#pragma omp parallel for
+				for (node u = 0; u < z; ++u) {
+					if (label[u] > gap && label[u] < n) {
+						label[u] = n;
+					}
+				}
+				std::fill(labelCount.begin() + gap + 1, labelCount.end(), 0);
+			}
+
+			std::vector<node> next;
+			for (node u : changed) {
+				if (u != target && u != excluded && excess[u] > 0 && label[u] < n) {
+					next.push_back(u);
+				}
+			}
+			active.swap(next);
+		}
+	}
+}
+
+void PushRelabel::run() {
+	if (!graph.hasEdgeIds()) { throw std::runtime_error("edges have not been indexed - call indexEdges first"); }
+	if (source == sink) { throw std::runtime_error("source and sink must be different nodes"); }
+
+	buildResidualNetwork();
+	excess.assign(graph.upperNodeIdBound(), 0);
+
+	// saturate all arcs leaving the source
+	for (index a = arcBegin[source]; a < arcBegin[source + 1]; ++a) {
+		edgeweight delta = residual[a];
+		residual[a] = 0;
+		residual[reverse[a]] += delta;
+		excess[head[a]] += delta;
+	}
+
+	// first the maximum preflow, then the excess that does not reach the sink goes back
+	discharge(sink, source);
+	flowValue = excess[sink];
+	discharge(source, sink);
+
+	const bool directed = graph.isDirected();
+	flow.clear();
+	flow.resize(graph.upperEdgeIdBound(), 0.0);
+	graph.parallelForEdges([&](node u, node v, edgeid eid) {
+		const index a = edgeArc[eid];
+		if (a == none) return;
+		if (directed) {
+			flow[eid] = residual[reverse[a]];
+		} else {
+			// both arcs start with the capacity of the edge
+			flow[eid] = std::abs(residual[reverse[a]] - residual[a]) / 2;
+		}
+	});
+}
+
+edgeweight PushRelabel::getMaxFlow() const {
+	return flowValue;
+}
+
+std::vector<node> PushRelabel::getSourceSet() const {
+	// perform bfs from source in the residual network
+	std::vector<bool> visited(graph.upperNodeIdBound(), false);
+	std::vector<node> sourceSet;
+
+	std::queue<node> Q;
+	Q.push(source);
+	visited[source] = true;
+	while (!Q.empty()) {
+		node u = Q.front(); Q.pop();
+		sourceSet.push_back(u);
+
+		for (index a = arcBegin[u]; a < arcBegin[u + 1]; ++a) {
+			node v = head[a];
+			if (!visited[v] && residual[a] > 0) {
+				Q.push(v);
+				visited[v] = true;
+			}
+		}
+	}
+
+	return sourceSet;
+}
+
+edgeweight PushRelabel::getFlow(node u, node v) const {
+	return flow[graph.edgeId(u, v)];
+}
+
+std::vector<edgeweight> PushRelabel::getFlowVector() const {
+	return flow;
+}
+
+} /* namespace NetworKit */
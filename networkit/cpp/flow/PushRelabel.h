@@ -0,0 +1,129 @@
+/*
+ * PushRelabel.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef PUSHRELABEL_H_
+#define PUSHRELABEL_H_
+
+#include "../graph/Graph.h"
+#include <vector>
+
+namespace NetworKit {
+
+/**
+ * @ingroup flow
+ * The PushRelabel class implements a parallel push-relabel maximum flow algorithm.
+ *
+ * All active nodes are discharged in synchronous rounds. Conflicting pushes between two
+ * active nodes are resolved by a fixed rule, and labels and excesses are updated
+ * after each round. Exact labels are computed by a parallel global relabeling (a
+ * breadth-first search from the sink in the residual network) whenever the
+ * discharges have scanned about as many arcs as the network has; a gap in the
+ * labels lifts all nodes above it at once. In a second phase the excess that cannot
+ * reach the sink is returned to the source, so the result is a flow.
+ *
+ * Undirected edges have their capacity in both directions. Edges need to be
+ * indexed and the result has the same interface as EdmondsKarp.
+ *
+ * @see Baumstark, Blelloch, Shun: Efficient Implementation of a Synchronous Parallel Push-Relabel Algorithm. ESA 2015.
+ */
+class PushRelabel {
+private:
+	const Graph &graph;
+
+	node source;
+	node sink;
+
+	std::vector<edgeweight> flow;
+	edgeweight flowValue;
+
+	// residual network, the arcs of node u are arcBegin[u], ..., arcBegin[u+1]-1
+	std::vector<index> arcBegin;
+	std::vector<node> head;
+	std::vector<index> reverse;
+	std::vector<edgeweight> residual;
+	std::vector<index> edgeArc; //!< arc of every edge in its direction, from the smaller endpoint if undirected
+
+	std::vector<edgeweight> excess;
+	std::vector<index> label;
+
+	/**
+	 * Builds the residual network with one arc per direction of every edge.
+	 */
+	void buildResidualNetwork();
+
+	/**
+	 * Computes the exact distances to @a target in the residual network and
+	 * the number of nodes with each label, and returns the nodes with excess
+	 * that can reach @a target.
+	 */
+	std::vector<node> globalRelabel(node target, node excluded, std::vector<count>& labelCount);
+
+	/**
+	 * Moves all excess that can reach @a target there. The node @a excluded
+	 * neither sends nor receives flow.
+	 */
+	void discharge(node target, node excluded);
+
+public:
+	/**
+	 * Constructs an instance of the push-relabel algorithm for the given graph, source and sink
+	 * @param graph The graph.
+	 * @param source The source node.
+	 * @param sink The sink node.
+	 */
+	PushRelabel(const Graph &graph, node source, node sink);
+
+	/**
+	 * Computes the maximum flow.
+	 */
+	void run();
+
+	/**
+	 * Returns the value of the maximum flow from source to sink.
+	 *
+	 * @return The maximum flow value
+	 */
+	edgeweight getMaxFlow() const;
+
+	/**
+	 * Returns the set of the nodes on the source side of the flow/minimum cut.
+	 *
+	 * @return The set of nodes that form the (smallest) source side of the flow/minimum cut.
+	 */
+	std::vector<node> getSourceSet() const;
+
+	/**
+	 * Get the flow value between two nodes @a u and @a v.
+	 * @warning The running time of this function is linear in the degree of u.
+	 *
+	 * @param u The first node
+	 * @param v The second node
+	 * @return The flow between node u and v.
+	 */
+	edgeweight getFlow(node u, node v) const;
+
+	/**
+	 * Get the flow value of an edge.
+	 *
+	 * @param eid The id of the edge
+	 * @return The flow on the edge identified by eid
+	 */
+	edgeweight getFlow(edgeid eid) const {
+		return flow[eid];
+	};
+
+	/**
+	 * Return a copy of the flow values of all edges.
+	 * @note Instead of copying all values you can also use the inline function "getFlow(edgeid)" in order to access the values efficiently.
+	 *
+	 * @return The flow values of all edges
+	 */
+	std::vector<edgeweight> getFlowVector() const;
+};
+
+} /* namespace NetworKit */
+
+#endif /* PUSHRELABEL_H_ */
@@ -0,0 +1,152 @@
+/*
+ * PushRelabelGTest.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include "PushRelabelGTest.h"
+#include "../EdmondsKarp.h"
+#include "../../auxiliary/Random.h"
+#include "../../generators/ErdosRenyiGenerator.h"
+
+namespace NetworKit {
+
+TEST_F(PushRelabelGTest, testPushRelabelP1) {
+	Graph G(7, false);
+	G.addEdge(0,1);
+	G.addEdge(0,2);
+	G.addEdge(0,3);
+	G.addEdge(1,2);
+	G.addEdge(1,4);
+	G.addEdge(2,3);
+	G.addEdge(2,4);
+	G.addEdge(3,4);
+	G.addEdge(3,5);
+	G.addEdge(4,6);
+	G.addEdge(5,6);
+
+	G.indexEdges();
+
+	PushRelabel pr(G, 0, 6);
+	pr.run();
+	EXPECT_EQ(2, pr.getMaxFlow()) << "max flow is not correct";
+
+	EXPECT_EQ(1, pr.getFlow(4, 6));
+	EXPECT_EQ(1, pr.getFlow(5, 6));
+
+	std::vector<node> sourceSet(pr.getSourceSet());
+	std::sort(sourceSet.begin(), sourceSet.end());
+	EXPECT_EQ(std::vector<node>({0, 1, 2, 3, 4}), sourceSet);
+}
+
+TEST_F(PushRelabelGTest, testPushRelabelDirected) {
+	Graph G(6, true, true);
+	G.addEdge(0, 1, 5);
+	G.addEdge(0, 2, 15);
+	G.addEdge(1, 3, 5);
+	G.addEdge(1, 4, 5);
+	G.addEdge(2, 3, 5);
+	G.addEdge(2, 4, 5);
+	G.addEdge(3, 5, 15);
+	G.addEdge(4, 5, 5);
+	// edges towards the source do not carry flow
+	G.addEdge(3, 0, 10);
+	G.addEdge(5, 2, 10);
+
+	G.indexEdges();
+
+	PushRelabel pr(G, 0, 5);
+	pr.run();
+	EXPECT_EQ(15, pr.getMaxFlow()) << "max flow is not correct";
+	EXPECT_EQ(0, pr.getFlow(3, 0));
+	EXPECT_EQ(0, pr.getFlow(5, 2));
+	EXPECT_EQ(15, pr.getFlow(3, 5) + pr.getFlow(4, 5));
+}
+
+TEST_F(PushRelabelGTest, testPushRelabelUnconnected) {
+	Graph G(6, true);
+	G.addEdge(0,1, 5);
+	G.addEdge(0,2, 15);
+	G.addEdge(1,2, 5);
+	G.addEdge(3, 4, 5);
+	G.addEdge(3,5, 15);
+	G.addEdge(4,5, 5);
+
+	G.indexEdges();
+
+	PushRelabel pr(G, 0, 5);
+	pr.run();
+	EXPECT_EQ(0, pr.getMaxFlow()) << "max flow is not correct";
+	EXPECT_EQ(3u, pr.getSourceSet().size());
+}
+
+TEST_F(PushRelabelGTest, testPushRelabelRandom) {
+	Aux::Random::setSeed(42, false);
+	for (double p : {0.005, 0.02, 0.1}) {
+		Graph G = ErdosRenyiGenerator(500, p).generate();
+		Graph weighted(G, true, false);
+		weighted.forEdges([&](node u, node v) {
+			weighted.setWeight(u, v, Aux::Random::integer(1, 10));
+		});
+		weighted.indexEdges();
+		Graph symmetric(weighted.upperNodeIdBound(), true, true);
+		weighted.forEdges([&](node u, node v, edgeweight w) {
+			symmetric.addEdge(u, v, w);
+			symmetric.addEdge(v, u, w);
+		});
+		symmetric.indexEdges();
+
+		for (index i = 0; i < 5; ++i) {
+			node s = Aux::Random::integer(499);
+			node t = (s + 1 + Aux::Random::integer(498)) % 500;
+
+			EdmondsKarp reference(weighted, s, t);
+			reference.run();
+			PushRelabel pr(weighted, s, t);
+			pr.run();
+			EXPECT_DOUBLE_EQ(reference.getMaxFlow(), pr.getMaxFlow());
+
+			// capacity constraints
+			weighted.forEdges([&](node u, node v, edgeweight w, edgeid eid) {
+				edgeweight f = pr.getFlow(eid);
+				EXPECT_LE(f, w);
+				EXPECT_GE(f, 0);
+			});
+
+			// the flow values of undirected edges have no direction, so flow conservation
+			// is checked on the directed graph with an arc in both directions of every edge
+			PushRelabel directedPr(symmetric, s, t);
+			directedPr.run();
+			EXPECT_DOUBLE_EQ(reference.getMaxFlow(), directedPr.getMaxFlow());
+			std::vector<edgeweight> netFlow(symmetric.upperNodeIdBound(), 0);
+			symmetric.forEdges([&](node u, node v, edgeweight w, edgeid eid) {
+				edgeweight f = directedPr.getFlow(eid);
+				EXPECT_LE(f, w);
+				EXPECT_GE(f, 0);
+				netFlow[u] -= f;
+				netFlow[v] += f;
+			});
+			symmetric.forNodes([&](node u) {
+				if (u == s || u == t) return;
+				EXPECT_DOUBLE_EQ(0, netFlow[u]) << "flow is not conserved at node " << u;
+			});
+			EXPECT_DOUBLE_EQ(directedPr.getMaxFlow(), netFlow[t]);
+			EXPECT_DOUBLE_EQ(-directedPr.getMaxFlow(), netFlow[s]);
+
+			// the source side is a minimum cut
+			std::vector<node> sourceSet = pr.getSourceSet();
+			std::vector<bool> inSource(weighted.upperNodeIdBound(), false);
+			for (node u : sourceSet) {
+				inSource[u] = true;
+			}
+			EXPECT_FALSE(inSource[t]);
+			edgeweight cut = 0;
+			weighted.forEdges([&](node u, node v, edgeweight w) {
+				if (inSource[u] != inSource[v]) cut += w;
+			});
+			EXPECT_DOUBLE_EQ(pr.getMaxFlow(), cut);
+		}
+	}
+}
+
+} /* namespace NetworKit */
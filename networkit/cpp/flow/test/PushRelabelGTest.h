@@ -0,0 +1,21 @@
+/*
+ * PushRelabelGTest.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef PUSHRELABELGTEST_H_
+#define PUSHRELABELGTEST_H_
+
+#include "gtest/gtest.h"
+#include "../PushRelabel.h"
+#include "../../graph/Graph.h"
+
+namespace NetworKit {
+
+class PushRelabelGTest : public testing::Test {
+};
+
+} /* namespace NetworKit */
+
+#endif /* PUSHRELABELGTEST_H_ */
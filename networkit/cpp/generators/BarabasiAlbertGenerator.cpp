@@ -8,7 +8,9 @@
 #include "../auxiliary/Random.h"
 
 #include "BarabasiAlbertGenerator.h"
+#include "../graph/GraphBuilder.h"
 
+#include <algorithm>
 #include <set>
 
 
@@ -110,49 +112,84 @@ Graph BarabasiAlbertGenerator::generateOriginal() {
 	return G;
 }
 
+namespace {
+
+uint64_t mix(uint64_t x) {
+	x += 0x9e3779b97f4a7c15ULL;
+	x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+	return x ^ (x >> 31);
+}
+
+} /* namespace */
+
 Graph BarabasiAlbertGenerator::generateBatagelj() {
-	count n = nMax;
-	Graph G(nMax);
-	std::vector<node> M(2 * k * n);
-	std::set<std::pair<node, node>> uniqueEdges;
+	const count n = nMax;
+	GraphBuilder builder(n);
 
+	// the initial edges, either from initGraph or a path of n0 nodes
+	std::vector<std::pair<node, node>> initEdges;
+	count nInit;
 	if (initGraph.numberOfNodes() == 0) {
-		// initialize n0 connected nodes
-		for (index v = 0; v < n0; ++v) {
-			M[2 * v ] = v;
-			M[2 * v + 1] = v + 1;
+		for (node v = 1; v < n0; ++v) {
+			initEdges.emplace_back(v - 1, v);
 		}
+		nInit = n0;
 	} else {
-		index i = 0;
-		initGraph.forEdges( [&M,&i] (node u, node v) {
-			M[2 * i] = u;
-			M[2 * i +1] = v;
-			++i;
+		initGraph.forEdges([&](node u, node v) {
+			initEdges.emplace_back(u, v);
 		});
-		n0 = i;
+		nInit = initGraph.upperNodeIdBound();
+	}
+	const count m0 = initEdges.size();
+	for (auto& edge : initEdges) {
+		builder.addHalfEdge(edge.first, edge.second);
 	}
 
-	// "draw" the edges
-	for (index v = n0; v < n; ++v) {
-		for (index i = 0; i < k; ++i) {
-			M[2 * (v * k + i)] = v;
-			index r = Aux::Random::integer(2 * (v * k + i));
-			M[2 * (v * k + i) + 1] = M[r];
+	// Edge e >= m0 is the i-th edge of node u = nInit + (e - m0) / k. In the edge array of
+	// Batagelj and Brandes it occupies the slots 2e (its source) and 2e+1 (its target), and its
+	// target is copied from a uniformly random slot r <= 2e. The random slot of every edge is a
+	// hash of the seed and the edge, so the target can be found independently for every edge
+	// by following the copies back to a source slot or an initial edge.
+	const uint64_t seed = Aux::Random::integer();
+	auto randomSlot = [&](index e) -> index {
+		return mix(seed ^ mix(e)) % (2 * e + 1);
+	};
+	auto source = [&](index e) -> node {
+		return e < m0 ? initEdges[e].first : nInit + (e - m0) / k;
+	};
+	auto target = [&](index e) -> node {
+		index r = randomSlot(e);
+		while (r % 2 == 1 && r / 2 >= m0) {
+			r = randomSlot(r / 2);
+		}
+		const index f = r / 2;
+		return r % 2 == 0 ? source(f) : initEdges[f].second;
+	};
+
+	// all targets of node u are at most u, so duplicate edges can only come from u itself
+	#pragma omp parallel
+	{
+		std::vector<node> targets;
+		#pragma omp for schedule(guided)
+		for (node u = nInit; u < n; ++u) {
+			const index first = m0 + (u - nInit) * k;
+			targets.clear();
+			for (index e = first; e < first + k; ++e) {
+				node t = target(e);
+				if (t != u) {
+					targets.push_back(t);
+				}
+			}
+			std::sort(targets.begin(), targets.end());
+			targets.erase(std::unique(targets.begin(), targets.end()), targets.end());
+			for (node t : targets) {
+				builder.addHalfEdge(u, t);
+			}
 		}
 	}
 
-	// remove duplicates and avoid selfloops
-	// for some reason, it seems to be faster with a separate loop when compared to integrating it in the loop above
-	for (index i = 0; i < (k*n); ++i) {
-		if (M[2 * i] != M[2 * i + 1])
-			uniqueEdges.insert( std::minmax({M[2 * i], M[2 * i + 1]}) );
-	}
-	// add the edges to the graph
-	for (const auto& edge : uniqueEdges) {
-		G.addEdge(edge.first, edge.second);
-	}
-	G.shrinkToFit();
-	return G;
+	return builder.toGraph(true, true);
 }
 
 } /* namespace NetworKit */
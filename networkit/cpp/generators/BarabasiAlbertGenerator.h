@@ -27,7 +27,10 @@ private:
 	/**
 	 * Implementation of ALG 5 of Batagelj, Brandes: Efficient Generation of Large Random Networks
 	 * https://kops.uni-konstanz.de/bitstream/handle/123456789/5799/random.pdf?sequence=1
-	 * Running time is O(n+m)
+	 * The edge array is not stored, instead the target of every edge is resolved in parallel by
+	 * following its random copies with hashed random choices, as in Sanders, Schulz: Scalable
+	 * generation of scale-free graphs. Information Processing Letters 116(7), 2016.
+	 * Expected running time is O(n+m)
 	 * @return The generated graph
 	 */
 	Graph generateBatagelj();
@@ -42,6 +45,8 @@ public:
 	 * The original algorithm is very slow and thus, the much faster method from Batagelj and Brandes[2] is
 	 * implemented and the current default.
 	 * The original method can be chosen by setting \p batagelj to false.
+	 * The method of Batagelj and Brandes runs in parallel; for a given seed (see Aux::Random::setSeed)
+	 * the graph does not depend on the number of threads.
 	 * [1] Barabasi, Albert: Emergence of Scaling in Random Networks http://arxiv.org/pdf/cond-mat/9910332.pdf
 	 * [2] ALG 5 of Batagelj, Brandes: Efficient Generation of Large Random Networks https://kops.uni-konstanz.de/bitstream/handle/123456789/5799/random.pdf?sequence=1
 	 *
@@ -5,9 +5,13 @@
  *      Author: Henning
  */
 
+#include <algorithm>
+#include <random>
+
 #include "ErdosRenyiGenerator.h"
 #include "../auxiliary/Random.h"
 #include "../auxiliary/SignalHandling.h"
+#include "../graph/GraphBuilder.h"
 
 namespace NetworKit {
 
@@ -15,42 +19,68 @@ ErdosRenyiGenerator::ErdosRenyiGenerator(count nNodes, double prob, bool directe
 
 }
 
-
-/**
- * Returns number of steps you need to wait until the next success (edge) occurs.
- */
-static inline count get_next_edge_distance(const double log_cp) {
-	return (count) 1 + floor(log(1.0 - Aux::Random::probability()) / log_cp);
-}
-
 Graph ErdosRenyiGenerator::generate() {
 	Aux::SignalHandler handler;
-	Graph G(n, false, directed);
-	const double log_cp = log(1.0 - p); // log of counter probability
-
-	// create edges
-	node curr = 1;
-	node next = -1; // according to Batagelj/Brandes
-	while (curr < n) {
-		handler.assureRunning();
-		// compute new step length
-		next += get_next_edge_distance(log_cp);
-
-		// check if at end of row
-		while ((next >= curr) && (curr < n)) {
-			// adapt to next row
-			next = next - curr;
-			curr++;
-		}
+	GraphBuilder builder(n, false, directed);
+	if (n < 2 || p <= 0) {
+		return builder.toGraph(true, true);
+	}
+
+	// row u holds the candidate pairs (u, v) with v < u, or all v != u if directed
+	auto rowLength = [&](node u) -> double {
+		return directed ? n - 1 : u;
+	};
+	const double pairs = directed ? (double) n * (n - 1) : (double) n * (n - 1) / 2;
+
+	// split the rows into chunks with about the same number of pairs; the chunks only depend
+	// on n and p, so the edges do not depend on the number of threads
+	const double edgesPerChunk = 1 << 14;
+	const count chunks = std::max<count>(1, std::min<count>(n, std::max(p * pairs, (double) n) / edgesPerChunk));
+	std::vector<node> chunkBegin(chunks + 1);
+	for (index c = 0; c <= chunks; ++c) {
+		double fraction = (double) c / chunks;
+		chunkBegin[c] = std::min<node>(n, directed ? fraction * n : std::sqrt(fraction) * n);
+	}
+	chunkBegin[chunks] = n;
+
+	const uint64_t seed = Aux::Random::integer();
+	const double log_cp = std::log1p(-p); // log of counter probability
+
+	// every chunk runs the skip sampling of Batagelj and Brandes with its own random stream
+	// and only inserts edges of its own rows
+	#pragma omp parallel for schedule(dynamic)
+	for (index c = 0; c < chunks; ++c) {
+		if (!handler.isRunning()) continue;
+		std::seed_seq sequence{seed, (uint64_t) c};
+		std::mt19937_64 urng(sequence);
+		std::uniform_real_distribution<double> distribution;
+
+		node curr = chunkBegin[c];
+		const node end = chunkBegin[c + 1];
+		double next = -1;
+		while (curr < end) {
+			// number of steps until the next success (edge) occurs
+			next += 1 + std::floor(std::log(1.0 - distribution(urng)) / log_cp);
+
+			// check if at end of row
+			while (curr < end && next >= rowLength(curr)) {
+				next -= rowLength(curr);
+				curr++;
+			}
 
-		// insert edge
-		if (curr < n) {
-			G.addEdge(curr, next);
+			// insert edge
+			if (curr < end) {
+				node v = (node) next;
+				if (directed && v >= curr) {
+					++v;
+				}
+				builder.addHalfEdge(curr, v);
+			}
 		}
 	}
+	handler.assureRunning();
 
-	G.shrinkToFit();
-	return G;
+	return builder.toGraph(true, true);
 }
 
 } /* namespace NetworKit */
@@ -28,6 +28,10 @@ public:
 	 * Creates random graphs in the G(n,p) model.
 	 * The generation follows Vladimir Batagelj and Ulrik Brandes: "Efficient
 	 * generation of large random networks", Phys Rev E 71, 036113 (2005).
+	 * The rows of the adjacency matrix are split into chunks with about the same number
+	 * of node pairs, which are sampled in parallel with their own random streams.
+	 * For a given seed (see Aux::Random::setSeed) the edges do not depend on the number
+	 * of threads.
 	 *
 	 * @param nNodes Number of nodes n in the graph.
 	 * @param prob Probability of existence for each edge p.
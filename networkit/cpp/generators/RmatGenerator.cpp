@@ -5,92 +5,117 @@
  *      Author: Henning, cls
  */
 
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <omp.h>
+
 #include "RmatGenerator.h"
 #include "../auxiliary/Random.h"
 #include "../auxiliary/NumericTools.h"
 #include "../auxiliary/Log.h"
+#include "../auxiliary/Parallel.h"
+#include "../graph/GraphBuilder.h"
 
 namespace NetworKit {
 
 RmatGenerator::RmatGenerator(count scale, count edgeFactor, double a, double b, double c, double d, bool weighted, count reduceNodes):
 	scale(scale), edgeFactor(edgeFactor), a(a), b(b), c(c), d(d), weighted(weighted), reduceNodes(reduceNodes)
 {
-    if (scale > 63) throw std::runtime_error("Cannot generate more than 2^63 nodes");
+	// both endpoints of an edge are packed into one 64 bit key
+	if (scale > 32) throw std::runtime_error("Cannot generate more than 2^32 nodes");
 	double sum = a+b+c+d;
 	INFO("sum of probabilities: ", sum);
 	if (!Aux::NumericTools::equal(sum, 1.0, 0.0001)) throw std::runtime_error("Probabilities in Rmat have to sum to 1.");
+	if (reduceNodes > (count{1} << scale)) throw std::runtime_error("Cannot delete more nodes than the graph has");
 	defaultEdgeWeight = 1.0;
 }
 
 Graph RmatGenerator::generate() {
-	count n = (1 << scale);
-	count numEdges = n * edgeFactor;
-	Graph G(n, true);
-	double ab = a+b;
-	double abc = ab+c;
-
-	auto quadrant([&]() {
-		double r = Aux::Random::probability();
-		TRACE("r: ", r);
-
-		if (r <= a) {
-			return 0;
-		}
-		else if (r <= ab) {
-			return 1;
-		}
-		else if (r <= abc) {
-			return 2;
-		}
-		else return 3;
-	});
+	const count n = count{1} << scale;
+	const count numEdges = n * edgeFactor;
+	const double ab = a+b;
+	const double abc = ab+c;
 
-	auto drawEdge([&]() {
-		node u = 0;
-		node v = 0;
-		for (index i = 0; i < scale; ++i) {
-			count q = quadrant();
-//			TRACE("q: ", q);
-			u = u << 1;
-			v = v << 1;
-			u = u | (q >> 1);
-			v = v | (q & 1);
+	// choose the nodes to delete to achieve the node count
+	std::vector<char> deleted(n, false);
+	if (reduceNodes > 0) {
+		INFO("deleting random nodes: ", reduceNodes);
+		std::vector<node> nodes(n);
+		std::iota(nodes.begin(), nodes.end(), 0);
+		for (index i = 0; i < reduceNodes; ++i) {
+			std::swap(nodes[i], nodes[Aux::Random::integer(i, n - 1)]);
+			deleted[nodes[i]] = true;
 		}
+	}
 
-		return std::make_pair(u, v);
-	});
+	// every block of edges is drawn with its own random stream, so the edges do not depend on the threads
+	const count edgesPerBlock = 1 << 16;
+	const count blocks = (numEdges + edgesPerBlock - 1) / edgesPerBlock;
+	const uint64_t seed = Aux::Random::integer();
 
-	for (index e = 0; e < numEdges; ++e) {
-		std::pair<node, node> drawnEdge = drawEdge();
-//		TRACE("edge drawn: ", drawnEdge.first, " - ", drawnEdge.second);
-		G.increaseWeight(drawnEdge.first, drawnEdge.second, defaultEdgeWeight);
+	// the edge {u, v} with u < v is stored as the key u * n + v, self-loops and the
+	// edges of deleted nodes get the key none
+	std::vector<uint64_t> keys(numEdges);
+	#pragma omp parallel for schedule(dynamic)
+	for (index block = 0; block < blocks; ++block) {
+		std::seed_seq sequence{seed, (uint64_t) block};
+		std::mt19937_64 urng(sequence);
+		std::uniform_real_distribution<double> distribution;
+		const index end = std::min(numEdges, (block + 1) * edgesPerBlock);
+		for (index e = block * edgesPerBlock; e < end; ++e) {
+			node u = 0;
+			node v = 0;
+			for (index i = 0; i < scale; ++i) {
+				double r = distribution(urng);
+				count q = r <= a ? 0 : r <= ab ? 1 : r <= abc ? 2 : 3;
+				u = (u << 1) | (q >> 1);
+				v = (v << 1) | (q & 1);
+			}
+			if (u == v || deleted[u] || deleted[v]) {
+				keys[e] = none;
+			} else {
+				keys[e] = (std::min(u, v) << scale) | std::max(u, v);
+			}
+		}
 	}
 
-	// delete random nodes to achieve node count
-	INFO("deleting random nodes: ", reduceNodes);
-	for (count i = 0; i < reduceNodes; ++i) {
-		node u = G.randomNode();
-		std::vector<std::pair<node, node>> incidentEdges;
-		G.forEdgesOf(u, [&](node u, node v) {
-			incidentEdges.push_back({u,v});
-		});
-		for (auto edge : incidentEdges) {
-			node x, y;
-			std::tie(x, y) = edge;
-			G.removeEdge(x, y);
+	// equal edges are adjacent after sorting, the discarded ones are at the end
+	Aux::Parallel::sort(keys.begin(), keys.end());
+	const count validKeys = std::lower_bound(keys.begin(), keys.end(), none) - keys.begin();
+
+	// split the keys into ranges that start with a new source node, every range
+	// inserts the merged edges of its own nodes
+	const count ranges = std::max<count>(1, std::min<count>(validKeys / edgesPerBlock, 64 * omp_get_max_threads()));
+	std::vector<index> rangeBegin(ranges + 1, validKeys);
+	for (index r = 0; r < ranges; ++r) {
+		index i = validKeys * r / ranges;
+		while (i > 0 && i < validKeys && (keys[i] >> scale) == (keys[i - 1] >> scale)) {
+			++i;
 		}
-		assert (G.degree(u) == 0);
-		G.removeNode(u);
+		rangeBegin[r] = i;
 	}
 
-	if (!weighted) {
-		// set unit weights
-		G.forEdges([&](node u, node v) {
-			G.setWeight(u, v, 1.0);
-		});
+	GraphBuilder builder(n, weighted, false);
+	#pragma omp parallel for schedule(dynamic)
+	for (index r = 0; r < ranges; ++r) {
+		for (index i = rangeBegin[r]; i < rangeBegin[r + 1];) {
+			index j = i + 1;
+			while (j < rangeBegin[r + 1] && keys[j] == keys[i]) {
+				++j;
+			}
+			builder.addHalfEdge(keys[i] >> scale, keys[i] & (n - 1), (j - i) * defaultEdgeWeight);
+			i = j;
+		}
 	}
+	std::vector<uint64_t>().swap(keys);
 
-	G.shrinkToFit();
+	Graph G = builder.toGraph(true, true);
+	G.forNodes([&](node u) {
+		if (deleted[u]) {
+			G.removeNode(u);
+		}
+	});
 	return G;
 }
 
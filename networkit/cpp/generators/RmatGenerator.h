@@ -20,6 +20,11 @@ namespace NetworKit {
  * More details at http://www.graph500.org or in the original paper:
  * Deepayan Chakrabarti, Yiping Zhan, Christos Faloutsos:
  * R-MAT: A Recursive Model for Graph Mining. SDM 2004: 442-446.
+ *
+ * The edges are drawn in parallel, in blocks with their own random streams, and merged by
+ * a parallel sort; for a given seed (see Aux::Random::setSeed) the graph does not depend on
+ * the number of threads. Self-loops are discarded and multiple edges between the same nodes
+ * are merged into one edge, whose weight is the number of merged edges if the graph is weighted.
  */
 class RmatGenerator: public NetworKit::StaticGraphGenerator {
 protected:
@@ -39,7 +44,7 @@ public:
 	 * @param[in] b Probability for quadrant upper right
 	 * @param[in] c Probability for quadrant lower left
 	 * @param[in] d Probability for quadrant lower right
-	 * @param[in] weighted	result graph weighted?
+	 * @param[in] weighted	result graph weighted with the multiplicity of every edge?
 	 * @param[in] reduceNodes	number of random nodes to delete to achieve a given node count
 	 */
 	RmatGenerator(count scale, count edgeFactor, double a, double b, double c, double d, bool weighted=false, count reduceNodes=0);
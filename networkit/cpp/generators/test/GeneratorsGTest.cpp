@@ -46,6 +46,7 @@ Dy * GeneratorsTest.cpp
 #include "../../auxiliary/MissingMath.h"
 #include "../../auxiliary/Parallel.h"
 #include "../../auxiliary/Random.h"
+#include "../../auxiliary/Parallelism.h"
 #include "../../global/ClusteringCoefficient.h"
 #include "../../community/PLM.h"
 #include "../../community/Modularity.h"
@@ -57,6 +58,41 @@ GeneratorsGTest::GeneratorsGTest() {
 
 }
 
+namespace {
+
+/**
+ * Restores the number of threads when it goes out of scope.
+ */
+class ThreadCountGuard {
+public:
+	const int threads;
+	ThreadCountGuard() : threads(Aux::getMaxNumberOfThreads()) {}
+	~ThreadCountGuard() {
+		Aux::setNumberOfThreads(threads);
+	}
+};
+
+} /* namespace */
+
+Graph GeneratorsGTest::generateOnOneAndManyThreads(std::function<Graph()> generate) {
+	ThreadCountGuard guard;
+	Aux::Random::setSeed(42, false);
+	Aux::setNumberOfThreads(1);
+	Graph G = generate();
+	Aux::Random::setSeed(42, false);
+	Aux::setNumberOfThreads(std::max(guard.threads, 4));
+	Graph H = generate();
+
+	// the graph does not depend on the number of threads
+	EXPECT_EQ(G.numberOfNodes(), H.numberOfNodes());
+	EXPECT_EQ(G.numberOfEdges(), H.numberOfEdges());
+	G.forEdges([&](node u, node v, edgeweight w) {
+		EXPECT_TRUE(H.hasEdge(u, v));
+		EXPECT_EQ(w, H.weight(u, v));
+	});
+	return G;
+}
+
 TEST_F(GeneratorsGTest, testDynamicBarabasiAlbertGeneratorSingleStep) {
 	count k = 2; // number of edges added per node
 	DynamicGraphSource* gen = new DynamicBarabasiAlbertGenerator(k);
@@ -410,6 +446,42 @@ TEST_F(GeneratorsGTest, testBarabasiAlbertGeneratorBatagelj) {
 
 }
 
+TEST_F(GeneratorsGTest, testBarabasiAlbertGeneratorBatageljParallel) {
+	count k = 4;
+	count nMax = 100000;
+	Graph G = generateOnOneAndManyThreads([&]() {
+		return BarabasiAlbertGenerator(k, nMax, 10).generate();
+	});
+
+	EXPECT_EQ(nMax, G.numberOfNodes());
+	EXPECT_EQ(0u, G.numberOfSelfLoops());
+	EXPECT_TRUE(G.checkConsistency());
+	// the path of the initial nodes plus k edges per new node, some of them merged
+	EXPECT_LE(G.numberOfEdges(), 9 + (nMax - 10) * k);
+	EXPECT_GE(G.numberOfEdges(), 0.95 * (nMax - 10) * k);
+	for (node v = 1; v < 10; ++v) {
+		EXPECT_TRUE(G.hasEdge(v - 1, v));
+	}
+
+	// every new node attaches to older nodes only
+	G.forNodes([&](node u) {
+		if (u < 10) return;
+		count older = 0;
+		G.forNeighborsOf(u, [&](node v) {
+			if (v < u) ++older;
+		});
+		EXPECT_GE(k, older);
+		EXPECT_LE(1u, older);
+	});
+
+	// preferential attachment creates hubs
+	count maxDegree = 0;
+	G.forNodes([&](node u) {
+		maxDegree = std::max(maxDegree, G.degree(u));
+	});
+	EXPECT_GE(maxDegree, 100u);
+}
+
 TEST_F(GeneratorsGTest, generatetBarabasiAlbertGeneratorGraph) {
 		count k = 3;
 		count nMax = 1000;
@@ -452,6 +524,44 @@ TEST_F(GeneratorsGTest, testErdosRenyiGenerator) {
 	EXPECT_TRUE(G.checkConsistency());
 }
 
+TEST_F(GeneratorsGTest, testErdosRenyiGeneratorDirected) {
+	count n = 2000;
+	double p = 0.005;
+
+	Graph G = ErdosRenyiGenerator(n, p, true).generate();
+	EXPECT_TRUE(G.isDirected());
+	EXPECT_EQ(n, G.numberOfNodes());
+	EXPECT_EQ(0u, G.numberOfSelfLoops());
+	EXPECT_TRUE(G.checkConsistency());
+
+	count nPairs = n * (n-1);
+	count nEdges = G.numberOfEdges();
+	EXPECT_GE(nEdges, 0.9 * p * nPairs);
+	EXPECT_LE(nEdges, 1.1 * p * nPairs);
+
+	// edges must point to larger as well as to smaller ids
+	count upwards = 0;
+	G.forEdges([&](node u, node v) {
+		if (u < v) ++upwards;
+	});
+	EXPECT_GE(upwards, 0.4 * nEdges);
+	EXPECT_LE(upwards, 0.6 * nEdges);
+}
+
+TEST_F(GeneratorsGTest, testErdosRenyiGeneratorIsDeterministic) {
+	for (bool directed : {false, true}) {
+		Graph G = generateOnOneAndManyThreads([&]() {
+			return ErdosRenyiGenerator(100000, 0.0001, directed).generate();
+		});
+		EXPECT_TRUE(G.checkConsistency());
+	}
+
+	// G(n, 1) is the complete graph
+	Graph K = ErdosRenyiGenerator(50, 1.0).generate();
+	EXPECT_EQ(50u * 49 / 2, K.numberOfEdges());
+	EXPECT_EQ(0u, ErdosRenyiGenerator(50, 0.0).generate().numberOfEdges());
+}
+
 TEST_F(GeneratorsGTest, testRmatGeneratorException) {
 	count scale = 9;
 	count edgeFactor = 12;
@@ -492,6 +602,28 @@ TEST_F(GeneratorsGTest, testRmatGenerator) {
 	EXPECT_TRUE(G.checkConsistency());
 }
 
+TEST_F(GeneratorsGTest, testRmatGeneratorMultiplicities) {
+	count scale = 12;
+	count n = (1 << scale);
+	count edgeFactor = 8;
+	Graph G = generateOnOneAndManyThreads([&]() {
+		return RmatGenerator(scale, edgeFactor, 0.57, 0.19, 0.19, 0.05, true).generate();
+	});
+
+	// the weights count the merged edges, only self-loops are missing
+	EXPECT_TRUE(G.isWeighted());
+	EXPECT_EQ(0u, G.numberOfSelfLoops());
+	EXPECT_LT(G.numberOfEdges(), G.totalEdgeWeight());
+	EXPECT_LE(G.totalEdgeWeight(), n * edgeFactor);
+	EXPECT_GE(G.totalEdgeWeight(), 0.9 * n * edgeFactor);
+	EXPECT_TRUE(G.checkConsistency());
+
+	Graph R = RmatGenerator(scale, edgeFactor, 0.57, 0.19, 0.19, 0.05, false, 1000).generate();
+	EXPECT_FALSE(R.isWeighted());
+	EXPECT_EQ(n - 1000, R.numberOfNodes());
+	EXPECT_EQ(n, R.upperNodeIdBound());
+	EXPECT_TRUE(R.checkConsistency());
+}
 
 TEST_F(GeneratorsGTest, testChungLuGenerator) {
 	count n = 400;
@@ -11,6 +11,7 @@
 #define GENERATORSGTEST_H_
 
 #include <gtest/gtest.h>
+#include <functional>
 
 #include "../HyperbolicGenerator.h"
 #include "../DynamicHyperbolicGenerator.h"
@@ -29,6 +30,12 @@ public:
 		return dynGen.radii;
 	}
 
+	/**
+	 * Calls @a generate from the same seed on one thread and on at least four threads,
+	 * expects both graphs to be equal and returns the first one.
+	 */
+	Graph generateOnOneAndManyThreads(std::function<Graph()> generate);
+
 };
 
 } /* namespace NetworKit */
@@ -33,6 +33,9 @@ public:
 
 	/**
 	 * This calculates the global clustering coefficient
+	 *
+	 * @param G The graph, which must be undirected. Directed graphs are rejected
+	 * since the triangles are listed by TriangleEnumerator.
 	 */
   	static double exactGlobal(Graph& G);
   	static double approxGlobal(Graph& G, const count trials);
@@ -0,0 +1,175 @@
+/*
+ * CSRGraph.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+#include "CSRGraph.h"
+
+namespace NetworKit {
+
+CSRGraph::CSRGraph(const Graph& G, bool sortAdjacency) :
+	n(G.numberOfNodes()),
+	m(G.numberOfEdges()),
+	storedNumberOfSelfLoops(G.numberOfSelfLoops()),
+	z(G.upperNodeIdBound()),
+	omega(G.hasEdgeIds() ? G.upperEdgeIdBound() : 0),
+	weighted(G.isWeighted()),
+	directed(G.isDirected()),
+	edgesIndexed(G.hasEdgeIds()),
+	sorted(sortAdjacency),
+	exists(z, false) {
+
+	G.forNodes([&](node u) {
+		exists[u] = true;
+	});
+
+	freeze<false>(G, outBegin, outTargets, outWeights, outIds);
+	if (directed) {
+		freeze<true>(G, inBegin, inSources, inWeights, inIds);
+	}
+
+	if (sortAdjacency) {
+		sortRows(outBegin, outTargets, outWeights, outIds);
+		if (directed) {
+			sortRows(inBegin, inSources, inWeights, inIds);
+		}
+	}
+}
+
+template<bool incoming>
+void CSRGraph::freeze(const Graph& G, std::vector<index>& begin, std::vector<node>& targets, std::vector<edgeweight>& weights, std::vector<edgeid>& ids) {
+	// offsets are the exclusive prefix sum over the degrees
+	begin.assign(z + 1, 0);
+	#pragma omp parallel for
+	for (node u = 0; u < z; ++u) {
+		if (exists[u]) {
+			begin[u + 1] = incoming ? G.degreeIn(u) : G.degreeOut(u);
+		}
+	}
+	std::partial_sum(begin.begin(), begin.end(), begin.begin());
+
+	const count entries = begin[z];
+	targets.resize(entries);
+	weights.resize(weighted ? entries : 0);
+	ids.resize(edgesIndexed ? entries : 0);
+
+	// every node writes to its own disjoint range
+	#pragma omp parallel for schedule(guided)
+	for (node u = 0; u < z; ++u) {
+		if (!exists[u]) continue;
+		index pos = begin[u];
+		auto copyEdge = [&](node, node v, edgeweight ew, edgeid eid) {
+			targets[pos] = v;
+			if (weighted) {
+				weights[pos] = ew;
+			}
+			if (edgesIndexed) {
+				ids[pos] = eid;
+			}
+			++pos;
+		};
+		if (incoming) {
+			G.forInEdgesOf(u, copyEdge);
+		} else {
+			G.forEdgesOf(u, copyEdge);
+		}
+		assert(pos == begin[u + 1]);
+	}
+}
+
+void CSRGraph::sortRows(const std::vector<index>& begin, std::vector<node>& targets, std::vector<edgeweight>& weights, std::vector<edgeid>& ids) {
+	const count rows = begin.size() - 1;
+	#pragma omp parallel
+	{
+		std::vector<index> perm;
+		std::vector<node> tmpTargets;
+		std::vector<edgeweight> tmpWeights;
+		std::vector<edgeid> tmpIds;
+
+		#pragma omp for schedule(guided)
+		for (index u = 0; u < rows; ++u) {
+			const index first = begin[u];
+			const index last = begin[u + 1];
+			if (std::is_sorted(targets.begin() + first, targets.begin() + last)) continue;
+
+			if (weights.empty() && ids.empty()) {
+				std::sort(targets.begin() + first, targets.begin() + last);
+				continue;
+			}
+
+			perm.resize(last - first);
+			std::iota(perm.begin(), perm.end(), first);
+			std::sort(perm.begin(), perm.end(), [&](index a, index b) {
+				return targets[a] < targets[b];
+			});
+
+			tmpTargets.clear();
+			tmpWeights.clear();
+			tmpIds.clear();
+			for (index i : perm) {
+				tmpTargets.push_back(targets[i]);
+				if (!weights.empty()) tmpWeights.push_back(weights[i]);
+				if (!ids.empty()) tmpIds.push_back(ids[i]);
+			}
+			std::copy(tmpTargets.begin(), tmpTargets.end(), targets.begin() + first);
+			std::copy(tmpWeights.begin(), tmpWeights.end(), weights.begin() + first);
+			std::copy(tmpIds.begin(), tmpIds.end(), ids.begin() + first);
+		}
+	}
+}
+
+index CSRGraph::indexOfOutEdge(node u, node v) const {
+	auto first = outTargets.begin() + outBegin[u];
+	auto last = outTargets.begin() + outBegin[u + 1];
+	auto it = sorted ? std::lower_bound(first, last, v) : std::find(first, last, v);
+	if (it == last || *it != v) {
+		return none;
+	}
+	return it - outTargets.begin();
+}
+
+edgeweight CSRGraph::weightedDegree(node v) const {
+	if (weighted) {
+		edgeweight sum = 0.0;
+		for (index i = outBegin[v]; i < outBegin[v + 1]; ++i) {
+			sum += outWeights[i];
+		}
+		return sum;
+	}
+	return defaultEdgeWeight * degree(v);
+}
+
+edgeweight CSRGraph::weight(node u, node v) const {
+	index i = indexOfOutEdge(u, v);
+	if (i == none) {
+		return nullWeight;
+	}
+	return weighted ? outWeights[i] : defaultEdgeWeight;
+}
+
+edgeid CSRGraph::edgeId(node u, node v) const {
+	if (!edgesIndexed) {
+		throw std::runtime_error("edges have not been indexed - call indexEdges first");
+	}
+	index i = indexOfOutEdge(u, v);
+	if (i == none) {
+		throw std::runtime_error("Edge does not exist");
+	}
+	return outIds[i];
+}
+
+edgeweight CSRGraph::totalEdgeWeight() const {
+	if (weighted) {
+		return parallelSumForEdges([&](node, node, edgeweight ew) {
+			return ew;
+		});
+	}
+	return numberOfEdges() * defaultEdgeWeight;
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,601 @@
+/*
+ * CSRGraph.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef CSRGRAPH_H_
+#define CSRGRAPH_H_
+
+#include <vector>
+
+#include "../Globals.h"
+#include "Graph.h"
+#include "../auxiliary/FunctionTraits.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup graph
+ * An immutable snapshot of a Graph in compressed sparse row (CSR) format.
+ *
+ * The adjacency of all nodes is stored in a single contiguous target array which is
+ * indexed by an offset array (and likewise for edge weights and edge ids), instead of
+ * one heap allocated vector per node. This saves the per-node vector overhead and makes
+ * neighborhood scans cache-friendly. The iterator interface (forNodes, forNeighborsOf,
+ * forEdges, parallelForEdges, ...) accepts the same lambdas as the Graph class, so
+ * templated code can be instantiated on both types.
+ *
+ * A CSRGraph cannot be modified; freeze a new snapshot after the Graph has changed.
+ */
+class CSRGraph final {
+
+private:
+	count n; //!< number of nodes
+	count m; //!< number of edges
+	count storedNumberOfSelfLoops; //!< number of self loops
+	node z; //!< upper bound of node ids
+	edgeid omega; //!< upper bound of edge ids
+
+	bool weighted; //!< true if the graph is weighted
+	bool directed; //!< true if the graph is directed
+	bool edgesIndexed; //!< true if the graph had edge ids when it was frozen
+	bool sorted; //!< true if the adjacency arrays are sorted by node id
+
+	std::vector<bool> exists; //!< exists[v] is true if node v exists
+
+	std::vector<index> outBegin; //!< outgoing edges of u are stored at [outBegin[u], outBegin[u+1])
+	std::vector<node> outTargets; //!< (outgoing) neighbors, for undirected graphs both directions of each edge are stored
+	std::vector<edgeweight> outWeights; //!< same schema as outTargets, empty if the graph is unweighted
+	std::vector<edgeid> outIds; //!< same schema as outTargets, empty if edges are not indexed
+
+	std::vector<index> inBegin; //!< only used for directed graphs, same schema as outBegin
+	std::vector<node> inSources; //!< only used for directed graphs, incoming neighbors
+	std::vector<edgeweight> inWeights; //!< only used for directed weighted graphs, same schema as inSources
+	std::vector<edgeid> inIds; //!< only used for directed graphs with edge ids, same schema as inSources
+
+	/**
+	 * Fills the CSR arrays of one direction from the adjacency of @a G.
+	 */
+	template<bool incoming>
+	void freeze(const Graph& G, std::vector<index>& begin, std::vector<node>& targets, std::vector<edgeweight>& weights, std::vector<edgeid>& ids);
+
+	/**
+	 * Sorts all rows of the given CSR arrays by node id (weights and ids are permuted accordingly).
+	 */
+	static void sortRows(const std::vector<index>& begin, std::vector<node>& targets, std::vector<edgeweight>& weights, std::vector<edgeid>& ids);
+
+	/**
+	 * Returns the position of @a v in the outgoing adjacency of @a u or @c none.
+	 */
+	index indexOfOutEdge(node u, node v) const;
+
+	template<bool hasWeights>
+	inline edgeweight getOutEdgeWeight(index i) const;
+
+	template<bool hasWeights>
+	inline edgeweight getInEdgeWeight(index i) const;
+
+	template<bool graphHasEdgeIds>
+	inline edgeid getOutEdgeId(index i) const;
+
+	template<bool graphHasEdgeIds>
+	inline edgeid getInEdgeId(index i) const;
+
+	/**
+	 * For undirected graphs, only edges with u >= v are used in edge iterations, so that each edge is visited once.
+	 */
+	template<bool graphIsDirected>
+	inline bool useEdgeInIteration(node u, node v) const;
+
+	template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+	inline void forOutEdgesOfImpl(node u, L handle) const;
+
+	template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+	inline void forInEdgesOfImpl(node u, L handle) const;
+
+	template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+	inline void forEdgeImpl(L handle) const;
+
+	template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+	inline void parallelForEdgesImpl(L handle) const;
+
+	template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+	inline double parallelSumForEdgesImpl(L handle) const;
+
+	/*
+	 * The edgeLambda overloads select the lambda signature in the same way as Graph does,
+	 * so that every handle accepted by the Graph iterators is accepted here as well.
+	 */
+
+	template<class F, void* = (void*)0>
+	typename Aux::FunctionTraits<F>::result_type edgeLambda(F&f, ...) const {
+		static_assert(! std::is_same<F, F>::value, "Your lambda does not support the required parameters or the parameters have the wrong type.");
+		return std::declval<typename Aux::FunctionTraits<F>::result_type>();
+	}
+
+	template < class F,
+	         typename std::enable_if <
+	         (Aux::FunctionTraits<F>::arity >= 3) &&
+	         std::is_same<edgeweight, typename Aux::FunctionTraits<F>::template arg<2>::type>::value &&
+	         std::is_same<edgeid, typename Aux::FunctionTraits<F>::template arg<3>::type>::value
+	         >::type * = (void*)0 >
+	auto edgeLambda(F &f, node u, node v, edgeweight ew, edgeid id) const -> decltype(f(u, v, ew, id)) {
+		return f(u, v, ew, id);
+	}
+
+	template<class F,
+			 typename std::enable_if<
+			 (Aux::FunctionTraits<F>::arity >= 2) &&
+			 std::is_same<edgeid, typename Aux::FunctionTraits<F>::template arg<2>::type>::value &&
+			 std::is_same<node, typename Aux::FunctionTraits<F>::template arg<1>::type>::value
+			 >::type* = (void*)0>
+	auto edgeLambda(F&f, node u, node v, edgeweight ew, edgeid id) const -> decltype(f(u, v, id)) {
+		return f(u, v, id);
+	}
+
+	template<class F,
+			 typename std::enable_if<
+			 (Aux::FunctionTraits<F>::arity >= 2) &&
+			 std::is_same<edgeweight, typename Aux::FunctionTraits<F>::template arg<2>::type>::value
+			 >::type* = (void*)0>
+	auto edgeLambda(F&f, node u, node v, edgeweight ew, edgeid id) const -> decltype(f(u, v, ew)) {
+		return f(u, v, ew);
+	}
+
+	template<class F,
+			 typename std::enable_if<
+			 (Aux::FunctionTraits<F>::arity >= 1) &&
+			 std::is_same<node, typename Aux::FunctionTraits<F>::template arg<1>::type>::value
+			 >::type* = (void*)0>
+	auto edgeLambda(F&f, node u, node v, edgeweight ew, edgeid id) const -> decltype(f(u, v)) {
+		return f(u, v);
+	}
+
+	template<class F,
+			 typename std::enable_if<
+			 (Aux::FunctionTraits<F>::arity >= 1) &&
+			 std::is_same<edgeweight, typename Aux::FunctionTraits<F>::template arg<1>::type>::value
+			 >::type* = (void*)0>
+	auto edgeLambda(F&f, node u, node v, edgeweight ew, edgeid id) const -> decltype(f(u, ew)) {
+		return f(v, ew);
+	}
+
+	template<class F,
+			 void* = (void*)0>
+	auto edgeLambda(F&f, node u, node v, edgeweight ew, edgeid id) const -> decltype(f(v)) {
+		return f(v);
+	}
+
+public:
+
+	/**
+	 * Creates an immutable CSR snapshot of @a G. The snapshot is built in parallel.
+	 *
+	 * @param G The graph to freeze.
+	 * @param sortAdjacency If set to @c true, the neighbors of each node are sorted by node id,
+	 * which allows hasEdge and weight to use binary search.
+	 */
+	CSRGraph(const Graph& G, bool sortAdjacency = false);
+
+	/** GRAPH INFORMATION **/
+
+	bool isWeighted() const { return weighted; }
+
+	bool isDirected() const { return directed; }
+
+	bool hasEdgeIds() const { return edgesIndexed; }
+
+	/**
+	 * @return @c true if the neighbors of each node are sorted by node id.
+	 */
+	bool hasSortedAdjacency() const { return sorted; }
+
+	bool isEmpty() const { return n == 0; }
+
+	count numberOfNodes() const { return n; }
+
+	count numberOfEdges() const { return m; }
+
+	count numberOfSelfLoops() const { return storedNumberOfSelfLoops; }
+
+	index upperNodeIdBound() const { return z; }
+
+	index upperEdgeIdBound() const { return omega; }
+
+	bool hasNode(node v) const { return (v < z) && exists[v]; }
+
+	/** NODE PROPERTIES **/
+
+	/**
+	 * Returns the number of outgoing neighbors of @a v.
+	 */
+	count degree(node v) const { return outBegin[v + 1] - outBegin[v]; }
+
+	count degreeOut(node v) const { return degree(v); }
+
+	/**
+	 * Returns the number of incoming neighbors of @a v. For undirected graphs the degree is returned.
+	 */
+	count degreeIn(node v) const { return directed ? inBegin[v + 1] - inBegin[v] : degree(v); }
+
+	bool isIsolated(node v) const { return degreeOut(v) == 0 && degreeIn(v) == 0; }
+
+	/**
+	 * Returns the weighted degree of @a v. For directed graphs this is the sum of weights of all outgoing edges of @a v.
+	 */
+	edgeweight weightedDegree(node v) const;
+
+	/** EDGE ATTRIBUTES **/
+
+	/**
+	 * Checks if the edge (@a u, @a v) exists. Uses binary search if the adjacency is sorted,
+	 * otherwise the running time is linear in the degree of @a u.
+	 */
+	bool hasEdge(node u, node v) const { return indexOfOutEdge(u, v) != none; }
+
+	/**
+	 * Returns the weight of the edge (@a u, @a v) or 0 if the edge does not exist.
+	 */
+	edgeweight weight(node u, node v) const;
+
+	/**
+	 * Returns the id of the edge (@a u, @a v). Throws if the edges are not indexed or the edge does not exist.
+	 */
+	edgeid edgeId(node u, node v) const;
+
+	/**
+	 * Returns the sum of all edge weights.
+	 */
+	edgeweight totalEdgeWeight() const;
+
+	/**
+	 * Returns the @a i-th (outgoing) neighbor of @a u.
+	 */
+	node getIthNeighbor(node u, index i) const { return outTargets[outBegin[u] + i]; }
+
+	/* NODE ITERATORS */
+
+	template<typename L> void forNodes(L handle) const;
+
+	template<typename L> void parallelForNodes(L handle) const;
+
+	template<typename L> void balancedParallelForNodes(L handle) const;
+
+	template<typename L> double parallelSumForNodes(L handle) const;
+
+	/* EDGE ITERATORS */
+
+	/**
+	 * Iterate over all edges and call @a handle (lambda closure).
+	 *
+	 * @param handle Takes parameters <code>(node, node)</code>, <code>(node, node, edgweight)</code>, <code>(node, node, edgeid)</code> or <code>(node, node, edgeweight, edgeid)</code>.
+	 */
+	template<typename L> void forEdges(L handle) const;
+
+	template<typename L> void parallelForEdges(L handle) const;
+
+	template<typename L> double parallelSumForEdges(L handle) const;
+
+	/* NEIGHBORHOOD ITERATORS */
+
+	/**
+	 * Iterate over all (outgoing) neighbors of @a u and call @a handle (lambda closure).
+	 *
+	 * @param handle Takes parameter <code>(node)</code> or <code>(node, edgeweight)</code>.
+	 */
+	template<typename L> void forNeighborsOf(node u, L handle) const;
+
+	template<typename L> void forEdgesOf(node u, L handle) const;
+
+	template<typename L> void forInNeighborsOf(node u, L handle) const;
+
+	template<typename L> void forInEdgesOf(node u, L handle) const;
+};
+
+/* NODE ITERATORS */
+
+template<typename L>
+void CSRGraph::forNodes(L handle) const {
+	for (node v = 0; v < z; ++v) {
+		if (exists[v]) {
+			handle(v);
+		}
+	}
+}
+
+template<typename L>
+void CSRGraph::parallelForNodes(L handle) const {
+	#pragma omp parallel for
+	for (node v = 0; v < z; ++v) {
+		if (exists[v]) {
+			handle(v);
+		}
+	}
+}
+
+template<typename L>
+void CSRGraph::balancedParallelForNodes(L handle) const {
+	#pragma omp parallel for schedule(guided)
+	for (node v = 0; v < z; ++v) {
+		if (exists[v]) {
+			handle(v);
+		}
+	}
+}
+
+template<typename L>
+double CSRGraph::parallelSumForNodes(L handle) const {
+	double sum = 0.0;
+	#pragma omp parallel for reduction(+:sum)
+	for (node v = 0; v < z; ++v) {
+		if (exists[v]) {
+			sum += handle(v);
+		}
+	}
+	return sum;
+}
+
+/* HELPERS */
+
+template<bool hasWeights>
+inline edgeweight CSRGraph::getOutEdgeWeight(index i) const {
+	return outWeights[i];
+}
+
+template<>
+inline edgeweight CSRGraph::getOutEdgeWeight<false>(index) const {
+	return defaultEdgeWeight;
+}
+
+template<bool hasWeights>
+inline edgeweight CSRGraph::getInEdgeWeight(index i) const {
+	return inWeights[i];
+}
+
+template<>
+inline edgeweight CSRGraph::getInEdgeWeight<false>(index) const {
+	return defaultEdgeWeight;
+}
+
+template<bool graphHasEdgeIds>
+inline edgeid CSRGraph::getOutEdgeId(index i) const {
+	return outIds[i];
+}
+
+template<>
+inline edgeid CSRGraph::getOutEdgeId<false>(index) const {
+	return 0;
+}
+
+template<bool graphHasEdgeIds>
+inline edgeid CSRGraph::getInEdgeId(index i) const {
+	return inIds[i];
+}
+
+template<>
+inline edgeid CSRGraph::getInEdgeId<false>(index) const {
+	return 0;
+}
+
+template<bool graphIsDirected>
+inline bool CSRGraph::useEdgeInIteration(node u, node v) const {
+	return true;
+}
+
+template<>
+inline bool CSRGraph::useEdgeInIteration<false>(node u, node v) const {
+	return u >= v;
+}
+
+template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+inline void CSRGraph::forOutEdgesOfImpl(node u, L handle) const {
+	const index end = outBegin[u + 1];
+	for (index i = outBegin[u]; i < end; ++i) {
+		node v = outTargets[i];
+		if (useEdgeInIteration<graphIsDirected>(u, v)) {
+			edgeLambda<L>(handle, u, v, getOutEdgeWeight<hasWeights>(i), getOutEdgeId<graphHasEdgeIds>(i));
+		}
+	}
+}
+
+template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+inline void CSRGraph::forInEdgesOfImpl(node u, L handle) const {
+	if (graphIsDirected) {
+		const index end = inBegin[u + 1];
+		for (index i = inBegin[u]; i < end; ++i) {
+			edgeLambda<L>(handle, u, inSources[i], getInEdgeWeight<hasWeights>(i), getInEdgeId<graphHasEdgeIds>(i));
+		}
+	} else {
+		forOutEdgesOfImpl<true, hasWeights, graphHasEdgeIds, L>(u, handle);
+	}
+}
+
+template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+inline void CSRGraph::forEdgeImpl(L handle) const {
+	for (node u = 0; u < z; ++u) {
+		forOutEdgesOfImpl<graphIsDirected, hasWeights, graphHasEdgeIds, L>(u, handle);
+	}
+}
+
+template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+inline void CSRGraph::parallelForEdgesImpl(L handle) const {
+	#pragma omp parallel for schedule(guided)
+	for (node u = 0; u < z; ++u) {
+		forOutEdgesOfImpl<graphIsDirected, hasWeights, graphHasEdgeIds, L>(u, handle);
+	}
+}
+
+template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+inline double CSRGraph::parallelSumForEdgesImpl(L handle) const {
+	double sum = 0.0;
+	#pragma omp parallel for reduction(+:sum)
+	for (node u = 0; u < z; ++u) {
+		const index end = outBegin[u + 1];
+		for (index i = outBegin[u]; i < end; ++i) {
+			node v = outTargets[i];
+			if (useEdgeInIteration<graphIsDirected>(u, v)) {
+				sum += edgeLambda<L>(handle, u, v, getOutEdgeWeight<hasWeights>(i), getOutEdgeId<graphHasEdgeIds>(i));
+			}
+		}
+	}
+	return sum;
+}
+
+/* EDGE ITERATORS */
+
+template<typename L>
+void CSRGraph::forEdges(L handle) const {
+	switch (weighted + 2 * directed + 4 * edgesIndexed) {
+	case 0: // unweighted, undirected, no edgeIds
+		forEdgeImpl<false, false, false, L>(handle);
+		break;
+	case 1: // weighted,   undirected, no edgeIds
+		forEdgeImpl<false, true, false, L>(handle);
+		break;
+	case 2: // unweighted, directed, no edgeIds
+		forEdgeImpl<true, false, false, L>(handle);
+		break;
+	case 3: // weighted, directed, no edgeIds
+		forEdgeImpl<true, true, false, L>(handle);
+		break;
+	case 4: // unweighted, undirected, with edgeIds
+		forEdgeImpl<false, false, true, L>(handle);
+		break;
+	case 5: // weighted,   undirected, with edgeIds
+		forEdgeImpl<false, true, true, L>(handle);
+		break;
+	case 6: // unweighted, directed, with edgeIds
+		forEdgeImpl<true, false, true, L>(handle);
+		break;
+	case 7: // weighted,   directed, with edgeIds
+		forEdgeImpl<true, true, true, L>(handle);
+		break;
+	}
+}
+
+template<typename L>
+void CSRGraph::parallelForEdges(L handle) const {
+	switch (weighted + 2 * directed + 4 * edgesIndexed) {
+	case 0: // unweighted, undirected, no edgeIds
+		parallelForEdgesImpl<false, false, false, L>(handle);
+		break;
+	case 1: // weighted,   undirected, no edgeIds
+		parallelForEdgesImpl<false, true, false, L>(handle);
+		break;
+	case 2: // unweighted, directed, no edgeIds
+		parallelForEdgesImpl<true, false, false, L>(handle);
+		break;
+	case 3: // weighted, directed, no edgeIds
+		parallelForEdgesImpl<true, true, false, L>(handle);
+		break;
+	case 4: // unweighted, undirected, with edgeIds
+		parallelForEdgesImpl<false, false, true, L>(handle);
+		break;
+	case 5: // weighted,   undirected, with edgeIds
+		parallelForEdgesImpl<false, true, true, L>(handle);
+		break;
+	case 6: // unweighted, directed, with edgeIds
+		parallelForEdgesImpl<true, false, true, L>(handle);
+		break;
+	case 7: // weighted,   directed, with edgeIds
+		parallelForEdgesImpl<true, true, true, L>(handle);
+		break;
+	}
+}
+
+template<typename L>
+double CSRGraph::parallelSumForEdges(L handle) const {
+	double sum = 0.0;
+	switch (weighted + 2 * directed + 4 * edgesIndexed) {
+	case 0: // unweighted, undirected, no edge ids
+		sum = parallelSumForEdgesImpl<false, false, false, L>(handle);
+		break;
+	case 1: // weighted,   undirected, no edge ids
+		sum = parallelSumForEdgesImpl<false, true, false, L>(handle);
+		break;
+	case 2: // unweighted, directed, no edge ids
+		sum = parallelSumForEdgesImpl<true, false, false, L>(handle);
+		break;
+	case 3: // weighted,   directed, no edge ids
+		sum = parallelSumForEdgesImpl<true, true, false, L>(handle);
+		break;
+	case 4: // unweighted, undirected, with edge ids
+		sum = parallelSumForEdgesImpl<false, false, true, L>(handle);
+		break;
+	case 5: // weighted,   undirected, with edge ids
+		sum = parallelSumForEdgesImpl<false, true, true, L>(handle);
+		break;
+	case 6: // unweighted, directed, with edge ids
+		sum = parallelSumForEdgesImpl<true, false, true, L>(handle);
+		break;
+	case 7: // weighted,   directed, with edge ids
+		sum = parallelSumForEdgesImpl<true, true, true, L>(handle);
+		break;
+	}
+	return sum;
+}
+
+/* NEIGHBORHOOD ITERATORS */
+
+template<typename L>
+void CSRGraph::forNeighborsOf(node u, L handle) const {
+	forEdgesOf(u, handle);
+}
+
+template<typename L>
+void CSRGraph::forEdgesOf(node u, L handle) const {
+	switch (weighted + 2 * edgesIndexed) {
+	case 0: //not weighted, no edge ids
+		forOutEdgesOfImpl<true, false, false, L>(u, handle);
+		break;
+	case 1:	//weighted, no edge ids
+		forOutEdgesOfImpl<true, true, false, L>(u, handle);
+		break;
+	case 2: //not weighted, with edge ids
+		forOutEdgesOfImpl<true, false, true, L>(u, handle);
+		break;
+	case 3:	//weighted, with edge ids
+		forOutEdgesOfImpl<true, true, true, L>(u, handle);
+		break;
+	}
+}
+
+template<typename L>
+void CSRGraph::forInNeighborsOf(node u, L handle) const {
+	forInEdgesOf(u, handle);
+}
+
+template<typename L>
+void CSRGraph::forInEdgesOf(node u, L handle) const {
+	switch (weighted + 2 * directed + 4 * edgesIndexed) {
+	case 0: //unweighted, undirected, no edge ids
+		forInEdgesOfImpl<false, false, false, L>(u, handle);
+		break;
+	case 1: //weighted, undirected, no edge ids
+		forInEdgesOfImpl<false, true, false, L>(u, handle);
+		break;
+	case 2: //unweighted, directed, no edge ids
+		forInEdgesOfImpl<true, false, false, L>(u, handle);
+		break;
+	case 3: //weighted, directed, no edge ids
+		forInEdgesOfImpl<true, true, false, L>(u, handle);
+		break;
+	case 4: //unweighted, undirected, with edge ids
+		forInEdgesOfImpl<false, false, true, L>(u, handle);
+		break;
+	case 5: //weighted, undirected, with edge ids
+		forInEdgesOfImpl<false, true, true, L>(u, handle);
+		break;
+	case 6: //unweighted, directed, with edge ids
+		forInEdgesOfImpl<true, false, true, L>(u, handle);
+		break;
+	case 7: //weighted, directed, with edge ids
+		forInEdgesOfImpl<true, true, true, L>(u, handle);
+		break;
+	}
+}
+
+} /* namespace NetworKit */
+
+#endif /* CSRGRAPH_H_ */
@@ -7,6 +7,7 @@
 
 #include <sstream>
 #include <random>
+#include <tuple>
 
 #include "Graph.h"
 #include "GraphBuilder.h"
@@ -44,7 +45,8 @@ Graph::Graph(count n, bool weighted, bool directed) :
 	inEdgeWeights(weighted && directed ? n : 0),
 	outEdgeWeights(weighted ? n : 0),
 	inEdgeIds(),
-	outEdgeIds() {
+	outEdgeIds(),
+	adjacencyIndexThreshold(none) {
 
 	// set name from global id
 	id = getNextGraphId();
@@ -88,7 +90,8 @@ Graph::Graph(const Graph& G, bool weighted, bool directed) :
 	inEdges(0),
 	outEdges(0),
 	inEdgeWeights(0),
-	outEdgeWeights(0) {
+	outEdgeWeights(0),
+	adjacencyIndexThreshold(none) {
 
 	// set name from global id
 	id = getNextGraphId();
@@ -191,6 +194,9 @@ index Graph::indexInInEdgeArray(node v, node u) const {
 	if (!directed) {
 		return indexInOutEdgeArray(v, u);
 	}
+	if (inEdges[v].size() >= adjacencyIndexThreshold) {
+		return lookupAdjacencyIndex(v, true, u);
+	}
 	for (index i = 0; i < inEdges[v].size(); i++) {
 		node x = inEdges[v][i];
 		if (x == u) {
@@ -201,6 +207,9 @@ index Graph::indexInInEdgeArray(node v, node u) const {
 }
 
 index Graph::indexInOutEdgeArray(node u, node v) const {
+	if (outEdges[u].size() >= adjacencyIndexThreshold) {
+		return lookupAdjacencyIndex(u, false, v);
+	}
 	for (index i = 0; i < outEdges[u].size(); i++) {
 		node x = outEdges[u][i];
 		if (x == v) {
@@ -210,6 +219,111 @@ index Graph::indexInOutEdgeArray(node u, node v) const {
 	return none;
 }
 
+index Graph::lookupAdjacencyIndex(node u, bool in, node v) const {
+	const AdjacencyIndex& adjIndex = in ? inEdgeIndex : outEdgeIndex;
+	auto row = adjIndex.find(u);
+	if (row == adjIndex.end()) {
+		// the array is not indexed (yet), fall back to the linear scan
+		const std::vector<node>& adj = in ? inEdges[u] : outEdges[u];
+		for (index i = 0; i < adj.size(); ++i) {
+			if (adj[i] == v) {
+				return i;
+			}
+		}
+		return none;
+	}
+	// with multi-edges, the first entry is the one that a linear scan would find
+	index result = none;
+	auto range = row->second.equal_range(v);
+	for (auto it = range.first; it != range.second; ++it) {
+		result = std::min(result, it->second);
+	}
+	return result;
+}
+
+void Graph::indexAdjacencyArray(node u, bool in) {
+	const std::vector<node>& adj = in ? inEdges[u] : outEdges[u];
+	std::unordered_multimap<node, index>& rowIndex = (in ? inEdgeIndex : outEdgeIndex)[u];
+	rowIndex.clear();
+	rowIndex.reserve(adj.size());
+	for (index i = 0; i < adj.size(); ++i) {
+		if (adj[i] != none) {
+			rowIndex.emplace(adj[i], i);
+		}
+	}
+}
+
+void Graph::reindexAdjacencyArrays(const std::vector<node>& nodes, bool in) {
+	if (!hasAdjacencyIndex()) {
+		return;
+	}
+	AdjacencyIndex& adjIndex = in ? inEdgeIndex : outEdgeIndex;
+	const std::vector<std::vector<node> >& adjacencies = in ? inEdges : outEdges;
+	// the outer map is modified sequentially, the arrays are indexed in parallel
+	std::vector<node> indexed;
+	for (node u : nodes) {
+		if (adjacencies[u].size() >= adjacencyIndexThreshold) {
+			adjIndex[u];
+			indexed.push_back(u);
+		} else {
+			adjIndex.erase(u);
+		}
+	}
+	#pragma omp parallel for schedule(dynamic)
+	for (index i = 0; i < indexed.size(); ++i) {
+		indexAdjacencyArray(indexed[i], in);
+	}
+}
+
+void Graph::addToAdjacencyIndex(node u, bool in, index i) {
+	const std::vector<node>& adj = in ? inEdges[u] : outEdges[u];
+	if (adj.size() < adjacencyIndexThreshold) {
+		return;
+	}
+	AdjacencyIndex& adjIndex = in ? inEdgeIndex : outEdgeIndex;
+	auto row = adjIndex.find(u);
+	if (row == adjIndex.end()) {
+		// the array has just reached the threshold
+		indexAdjacencyArray(u, in);
+	} else {
+		row->second.emplace(adj[i], i);
+	}
+}
+
+void Graph::removeFromAdjacencyIndex(node u, bool in, node v, index i) {
+	if ((in ? inEdges[u] : outEdges[u]).size() < adjacencyIndexThreshold) {
+		return;
+	}
+	std::unordered_multimap<node, index>& rowIndex = (in ? inEdgeIndex : outEdgeIndex)[u];
+	auto range = rowIndex.equal_range(v);
+	for (auto it = range.first; it != range.second; ++it) {
+		if (it->second == i) {
+			rowIndex.erase(it);
+			return;
+		}
+	}
+}
+
+void Graph::buildAdjacencyIndex(count threshold) {
+	adjacencyIndexThreshold = threshold;
+	outEdgeIndex.clear();
+	inEdgeIndex.clear();
+	std::vector<node> nodes;
+	forNodes([&](node u) {
+		nodes.push_back(u);
+	});
+	reindexAdjacencyArrays(nodes, false);
+	if (directed) {
+		reindexAdjacencyArrays(nodes, true);
+	}
+}
+
+void Graph::removeAdjacencyIndex() {
+	adjacencyIndexThreshold = none;
+	AdjacencyIndex().swap(outEdgeIndex);
+	AdjacencyIndex().swap(inEdgeIndex);
+}
+
 
 /** EDGE IDS **/
 
@@ -376,6 +490,10 @@ void Graph::compactEdges() {
 
 		}
 	});
+
+	if (hasAdjacencyIndex()) {
+		buildAdjacencyIndex(adjacencyIndexThreshold);
+	}
 }
 
 void Graph::sortEdges() {
@@ -447,6 +565,10 @@ void Graph::sortEdges() {
 		inEdgeWeights.swap(targetWeight);
 		inEdgeIds.swap(targetEdgeIds);
 	}
+
+	if (hasAdjacencyIndex()) {
+		buildAdjacencyIndex(adjacencyIndexThreshold);
+	}
 }
 
 
@@ -495,6 +617,12 @@ node Graph::addNode() {
 		inEdges.push_back(std::vector<node>{});
 	}
 
+	if (edgesIndexed) {
+		outEdgeIds.push_back(std::vector<edgeid>{});
+		if (directed) {
+			inEdgeIds.push_back(std::vector<edgeid>{});
+		}
+	}
 
 	return v;
 }
@@ -608,9 +736,10 @@ void Graph::addEdge(node u, node v, edgeweight ew) {
 	outEdges[u].push_back(v);
 
 	// if edges indexed, give new id
+	edgeid newId = none;
 	if (edgesIndexed) {
-		edgeid id = omega++;
-		outEdgeIds[u].push_back(id);
+		newId = omega++;
+		outEdgeIds[u].push_back(newId);
 	}
 
 	if (directed) {
@@ -618,7 +747,7 @@ void Graph::addEdge(node u, node v, edgeweight ew) {
 		inEdges[v].push_back(u);
 
 		if (edgesIndexed) {
-			inEdgeIds[v].push_back(id);
+			inEdgeIds[v].push_back(newId);
 		}
 
 		if (weighted) {
@@ -648,6 +777,13 @@ void Graph::addEdge(node u, node v, edgeweight ew) {
 	if (u == v) { //count self loop
 		storedNumberOfSelfLoops++;
 	}
+
+	addToAdjacencyIndex(u, false, outEdges[u].size() - 1);
+	if (directed) {
+		addToAdjacencyIndex(v, true, inEdges[v].size() - 1);
+	} else if (u != v) {
+		addToAdjacencyIndex(v, false, outEdges[v].size() - 1);
+	}
 }
 
 void Graph::removeEdge(node u, node v) {
@@ -665,6 +801,13 @@ void Graph::removeEdge(node u, node v) {
 		throw std::runtime_error(strm.str());
 	}
 
+	removeFromAdjacencyIndex(u, false, v, vi);
+	if (directed) {
+		removeFromAdjacencyIndex(v, true, u, ui);
+	} else if (u != v) {
+		removeFromAdjacencyIndex(v, false, u, ui);
+	}
+
 	m--; // decrease number of edges
 	outDeg[u]--;
 	outEdges[u][vi] = none;
@@ -717,6 +860,21 @@ void Graph::swapEdge(node s1, node t1, node s2, node t2) {
 	if (s2t2 == none) throw std::runtime_error("The second edge does not exist");
 	index t2s2 = indexInInEdgeArray(t2, s2);
 
+	// entries of the adjacency arrays that change: (node, incoming array?, position)
+	std::vector<std::tuple<node, bool, index> > changed;
+	if (hasAdjacencyIndex()) {
+		changed = {std::make_tuple(s1, false, s1t1), std::make_tuple(s2, false, s2t2),
+			std::make_tuple(t1, directed, t1s1), std::make_tuple(t2, directed, t2s2)};
+		std::sort(changed.begin(), changed.end());
+		changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+		for (auto& entry : changed) {
+			node x = std::get<0>(entry);
+			bool in = std::get<1>(entry);
+			index i = std::get<2>(entry);
+			removeFromAdjacencyIndex(x, in, (in ? inEdges[x] : outEdges[x])[i], i);
+		}
+	}
+
 	std::swap(outEdges[s1][s1t1], outEdges[s2][s2t2]);
 
 	if (directed) {
@@ -740,6 +898,10 @@ void Graph::swapEdge(node s1, node t1, node s2, node t2) {
 			std::swap(outEdgeIds[t1][t1s1], outEdgeIds[t2][t2s2]);
 		}
 	}
+
+	for (auto& entry : changed) {
+		addToAdjacencyIndex(std::get<0>(entry), std::get<1>(entry), std::get<2>(entry));
+	}
 }
 
 bool Graph::hasEdge(node u, node v) const {
@@ -15,6 +15,7 @@
 #include <utility>
 #include <stdexcept>
 #include <functional>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "../Globals.h"
@@ -80,6 +81,8 @@ class Graph final {
 
 	friend class ParallelPartitionCoarsening;
 	friend class GraphBuilder;
+	friend class NetworkitBinaryReader;
+	friend class GraphUpdater;
 
 private:
 	// graph attributes
@@ -114,6 +117,12 @@ private:
 	std::vector< std::vector<edgeid> > inEdgeIds; //!< only used for directed graphs, same schema as inEdges
 	std::vector< std::vector<edgeid> > outEdgeIds; //!< same schema (and same order!) as outEdges
 
+	// optional hash index of the adjacency arrays, maps a neighbor to its positions in the array
+	typedef std::unordered_map< node, std::unordered_multimap<node, index> > AdjacencyIndex;
+	count adjacencyIndexThreshold; //!< adjacency arrays with at least this many entries are indexed, none if there is no index
+	AdjacencyIndex inEdgeIndex; //!< only used for directed graphs, index of inEdges
+	AdjacencyIndex outEdgeIndex; //!< index of outEdges
+
 	/**
 	 * Returns the next unique graph id.
 	 */
@@ -129,6 +138,34 @@ private:
 	 */
 	index indexInOutEdgeArray(node u, node v) const;
 
+	/**
+	 * Returns the smallest position of @a v in the indexed adjacency array of @a u (the incoming one if @a in is true).
+	 * Falls back to a linear scan if the array has no index.
+	 */
+	index lookupAdjacencyIndex(node u, bool in, node v) const;
+
+	/**
+	 * Rebuilds the index of the adjacency array of node @a u (the incoming one if @a in is true).
+	 */
+	void indexAdjacencyArray(node u, bool in);
+
+	/**
+	 * Rebuilds the index of the adjacency arrays of @a nodes in parallel after they have been modified
+	 * directly. Arrays below the threshold lose their index. @a nodes must not contain duplicates.
+	 */
+	void reindexAdjacencyArrays(const std::vector<node>& nodes, bool in);
+
+	/**
+	 * Adds the entry at position @a i of the adjacency array of @a u to the index, or builds the index
+	 * if the array has just reached the threshold.
+	 */
+	void addToAdjacencyIndex(node u, bool in, index i);
+
+	/**
+	 * Removes the entry (@a v, @a i) of the adjacency array of @a u from the index, if the array is indexed.
+	 */
+	void removeFromAdjacencyIndex(node u, bool in, node v, index i);
+
 	/**
 	 * Returns the edge weight of the outgoing edge of index i in the outgoing edges of node u
 	 * @param u The node
@@ -421,6 +458,32 @@ public:
 	index upperEdgeIdBound() const { return omega; }
 
 
+	/** ADJACENCY INDEX **/
+
+	/**
+	 * Builds a hash index for every adjacency array with at least @a threshold entries,
+	 * which is maintained by all edge modifiers afterwards. hasEdge, weight, setWeight,
+	 * increaseWeight, removeEdge and edgeId take expected constant time for indexed nodes
+	 * instead of time linear in their degree. Use it for graphs with hub nodes on which
+	 * many single edges are queried.
+	 *
+	 * @param threshold Minimum number of entries of an adjacency array (including removed edges) to be indexed.
+	 */
+	void buildAdjacencyIndex(count threshold = 64);
+
+	/**
+	 * Removes the adjacency index and frees its memory.
+	 */
+	void removeAdjacencyIndex();
+
+	/**
+	 * Checks if the adjacency arrays are indexed.
+	 *
+	 * @return true if buildAdjacencyIndex has been called
+	 */
+	bool hasAdjacencyIndex() const { return adjacencyIndexThreshold != none; }
+
+
 	/** GRAPH INFORMATION **/
 
 	/**
@@ -1051,6 +1114,15 @@ public:
 	 */
 	template<typename L> void forInEdgesOf(node u, L handle) const;
 
+	/**
+	 * Iterate over the incoming neighbors of @a u and call @a handle as long as @a condition remains true.
+	 * This allows for breaking from a neighbor loop.
+	 *
+	 * @param condition Returning <code>false</code> breaks the loop.
+	 * @param handle Takes parameter <code>(node)</code>.
+	 */
+	template<typename C, typename L> void forInNeighborsOfWhile(node u, C condition, L handle) const;
+
 	/* REDUCTION ITERATORS */
 
 	/**
@@ -1405,6 +1477,19 @@ void Graph::forInNeighborsOf(node u, L handle) const {
 	forInEdgesOf(u, handle);
 }
 
+template<typename C, typename L>
+void Graph::forInNeighborsOfWhile(node u, C condition, L handle) const {
+	const std::vector<node>& adjacency = directed ? inEdges[u] : outEdges[u];
+	for (node v : adjacency) {
+		if (v != none) {
+			if (!condition()) {
+				break;
+			}
+			handle(v);
+		}
+	}
+}
+
 template<typename L>
 void Graph::forInEdgesOf(node u, L handle) const {
 	switch (weighted + 2 * directed + 4 * edgesIndexed) {
@@ -215,7 +215,10 @@ void GraphBuilder::toGraphParallel(Graph& G) {
 	std::vector<count> numberOfSelfLoopsPerThread(maxThreads, 0);
 
 	// step 1
-	parallelForNodes([&](node v) {
+	// every thread handles a contiguous block of nodes in order, so the collected
+	// edges of every node are sorted by their source and do not depend on the schedule
+	#pragma omp parallel for schedule(static)
+	for (node v = 0; v < n; v++) {
 		int tid = omp_get_thread_num();
 		for (index i = 0; i < outEdges[v].size(); i++) {
 			node u = outEdges[v][i];
@@ -230,7 +233,7 @@ void GraphBuilder::toGraphParallel(Graph& G) {
 				numberOfSelfLoopsPerThread[tid]++;
 			}
 		}
-	});
+	}
 
 	// we have already half of the edges
 	G.outEdges.swap(outEdges);
@@ -0,0 +1,89 @@
+/*
+ * TriangleEnumerator.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include "TriangleEnumerator.h"
+#include "../auxiliary/Parallel.h"
+
+namespace NetworKit {
+
+constexpr count TriangleEnumerator::gallopingRatio;
+
+TriangleEnumerator::TriangleEnumerator(const Graph& G) : G(G) {
+	if (G.isDirected()) {
+		throw std::runtime_error("TriangleEnumerator: the graph must be undirected");
+	}
+
+	const count z = G.upperNodeIdBound();
+	nodeOfRank.reserve(G.numberOfNodes());
+	G.forNodes([&](node u) {
+		nodeOfRank.push_back(u);
+	});
+	Aux::Parallel::sort(nodeOfRank.begin(), nodeOfRank.end(), [&](node u, node v) {
+		return G.degree(u) < G.degree(v) || (G.degree(u) == G.degree(v) && u < v);
+	});
+	const count n = nodeOfRank.size();
+	std::vector<index> rank(z, none);
+	#pragma omp parallel for
+	for (index r = 0; r < n; ++r) {
+		rank[nodeOfRank[r]] = r;
+	}
+
+	// every edge is stored once, at the endpoint of lower rank
+	outBegin.assign(n + 1, 0);
+	#pragma omp parallel for schedule(guided)
+	for (index r = 0; r < n; ++r) {
+		count out = 0;
+		G.forNeighborsOf(nodeOfRank[r], [&](node v) {
+			if (rank[v] > r) ++out;
+		});
+		outBegin[r + 1] = out;
+	}
+	for (index r = 0; r < n; ++r) {
+		outBegin[r + 1] += outBegin[r];
+	}
+
+	const bool ids = G.hasEdgeIds();
+	head.resize(outBegin[n]);
+	if (ids) {
+		headId.resize(outBegin[n]);
+	}
+	#pragma omp parallel
+	{
+		std::vector<std::pair<index, edgeid> > neighbors;
+		#pragma omp for schedule(guided)
+		for (index r = 0; r < n; ++r) {
+			neighbors.clear();
+			G.forEdgesOf(nodeOfRank[r], [&](node, node v, edgeid eid) {
+				if (rank[v] > r) {
+					neighbors.emplace_back(rank[v], ids ? eid : none);
+				}
+			});
+			std::sort(neighbors.begin(), neighbors.end());
+			index pos = outBegin[r];
+			for (auto& entry : neighbors) {
+				head[pos] = entry.first;
+				if (ids) {
+					headId[pos] = entry.second;
+				}
+				++pos;
+			}
+		}
+	}
+}
+
+count TriangleEnumerator::numberOfTriangles() const {
+	count triangles = 0;
+	#pragma omp parallel for schedule(dynamic, 64) reduction(+:triangles)
+	for (index r = 0; r < nodeOfRank.size(); ++r) {
+		auto countTriangle = [&](node, node, node) {
+			++triangles;
+		};
+		trianglesOf(r, countTriangle);
+	}
+	return triangles;
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,177 @@
+/*
+ * TriangleEnumerator.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef TRIANGLEENUMERATOR_H_
+#define TRIANGLEENUMERATOR_H_
+
+#include <algorithm>
+#include <omp.h>
+
+#include "Graph.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup graph
+ * Lists all triangles of an undirected graph and calls a handle for each of them.
+ *
+ * The nodes are ranked by degree (ties broken by id) and every edge is directed from
+ * the endpoint of lower rank to the endpoint of higher rank, which bounds the out-degree
+ * by O(sqrt(m)). A triangle u, v, w with increasing ranks is found exactly once as the
+ * intersection of the out-neighbors of u and v, which are stored as sorted lists of
+ * ranks. Intersections of lists with similar length are computed by a branch-free merge,
+ * very unequal ones by galloping through the longer list.
+ *
+ * The oriented adjacency arrays need O(n + m) memory, independent of the number of
+ * threads. Self-loops are ignored; multi-edges are not supported.
+ *
+ * Handles may take (node u, node v, node w) or, if the graph has edge ids,
+ * (node u, node v, node w, edgeid uv, edgeid uw, edgeid vw), where u, v, w are in
+ * increasing order of rank.
+ *
+ * [0] Triangle Listing Algorithms: Back from the Diversion
+ * Mark Ortmann and Ulrik Brandes
+ * 2014 Proceedings of the Sixteenth Workshop on Algorithm Engineering and Experiments (ALENEX). 2014, 1-8
+ */
+class TriangleEnumerator {
+public:
+	/**
+	 * Builds the oriented adjacency arrays of the undirected graph @a G.
+	 * The graph must not be modified afterwards.
+	 *
+	 * @throws std::runtime_error if @a G is directed. This also applies to the users of this
+	 * class: ClusteringCoefficient::exactGlobal and TriangleEdgeScore reject directed graphs.
+	 */
+	TriangleEnumerator(const Graph& G);
+
+	/**
+	 * Calls @a handle for every triangle.
+	 */
+	template<typename L> void forTriangles(L handle) const;
+
+	/**
+	 * Calls @a handle for every triangle in parallel, so @a handle has to be thread-safe.
+	 */
+	template<typename L> void parallelForTriangles(L handle) const;
+
+	/**
+	 * @return number of triangles of the graph.
+	 */
+	count numberOfTriangles() const;
+
+private:
+	const Graph& G;
+	std::vector<node> nodeOfRank; //!< nodes in increasing order of degree
+	std::vector<index> outBegin; //!< out-neighbors of rank r are head[outBegin[r]], ..., head[outBegin[r+1]-1]
+	std::vector<index> head; //!< ranks of the out-neighbors, sorted for every rank
+	std::vector<edgeid> headId; //!< edge id for every entry of head, only if the graph has edge ids
+
+	// a list is galloped through if it is this many times longer than the other one
+	static constexpr count gallopingRatio = 32;
+
+	template<typename L> void trianglesOf(index r, L& handle) const;
+
+	template<typename F>
+	static void mergeIntersect(index a, index aEnd, index b, index bEnd, const index* list, F found);
+
+	template<typename F>
+	static void gallopIntersect(index a, index aEnd, index b, index bEnd, const index* list, F found);
+
+	template<class F>
+	auto triangleLambda(F& f, node u, node v, node w, edgeid uv, edgeid uw, edgeid vw) const -> decltype(f(u, v, w, uv, uw, vw)) {
+		return f(u, v, w, uv, uw, vw);
+	}
+
+	template<class F>
+	auto triangleLambda(F& f, node u, node v, node w, edgeid, edgeid, edgeid) const -> decltype(f(u, v, w)) {
+		return f(u, v, w);
+	}
+};
+
+template<typename F>
+inline void TriangleEnumerator::mergeIntersect(index a, index aEnd, index b, index bEnd, const index* list, F found) {
+	while (a < aEnd && b < bEnd) {
+		index x = list[a];
+		index y = list[b];
+		if (x == y) {
+			found(a, b);
+		}
+		// advance both on a match, otherwise the smaller one
+		a += (x <= y);
+		b += (y <= x);
+	}
+}
+
+template<typename F>
+inline void TriangleEnumerator::gallopIntersect(index a, index aEnd, index b, index bEnd, const index* list, F found) {
+	// [a, aEnd) is the shorter list
+	for (; a < aEnd && b < bEnd; ++a) {
+		index x = list[a];
+		// find the first entry >= x by doubling the step, then binary search
+		index step = 1;
+		index hi = b;
+		while (hi < bEnd && list[hi] < x) {
+			b = hi + 1;
+			hi += step;
+			step *= 2;
+		}
+		b = std::lower_bound(list + b, list + std::min(hi, bEnd), x) - list;
+		if (b < bEnd && list[b] == x) {
+			found(a, b);
+			++b;
+		}
+	}
+}
+
+template<typename L>
+inline void TriangleEnumerator::trianglesOf(index r, L& handle) const {
+	const bool ids = !headId.empty();
+	const node u = nodeOfRank[r];
+	for (index i = outBegin[r]; i < outBegin[r + 1]; ++i) {
+		const index s = head[i];
+		const node v = nodeOfRank[s];
+		// the third node has a higher rank than v, i.e. it comes after v in the list of u
+		index uBegin = i + 1;
+		index uEnd = outBegin[r + 1];
+		index vBegin = outBegin[s];
+		index vEnd = outBegin[s + 1];
+		auto report = [&](index uw, index vw) {
+			triangleLambda(handle, u, v, nodeOfRank[head[uw]], ids ? headId[i] : none, ids ? headId[uw] : none, ids ? headId[vw] : none);
+		};
+		count uLength = uEnd - uBegin;
+		count vLength = vEnd - vBegin;
+		if (uLength == 0 || vLength == 0) {
+			continue;
+		}
+		if (uLength * gallopingRatio < vLength) {
+			gallopIntersect(uBegin, uEnd, vBegin, vEnd, head.data(), report);
+		} else if (vLength * gallopingRatio < uLength) {
+			gallopIntersect(vBegin, vEnd, uBegin, uEnd, head.data(), [&](index vw, index uw) {
+				report(uw, vw);
+			});
+		} else {
+			mergeIntersect(uBegin, uEnd, vBegin, vEnd, head.data(), report);
+		}
+	}
+}
+
+template<typename L>
+void TriangleEnumerator::forTriangles(L handle) const {
+	for (index r = 0; r < nodeOfRank.size(); ++r) {
+		trianglesOf(r, handle);
+	}
+}
+
+template<typename L>
+void TriangleEnumerator::parallelForTriangles(L handle) const {
+	#pragma omp parallel for schedule(dynamic, 64)
+	for (index r = 0; r < nodeOfRank.size(); ++r) {
+		trianglesOf(r, handle);
+	}
+}
+
+} /* namespace NetworKit */
+#endif /* TRIANGLEENUMERATOR_H_ */
@@ -11,6 +11,7 @@
 
 #include "GraphGTest.h"
 #include "../GraphBuilder.h"
+#include "../CSRGraph.h"
 #include "../../io/METISGraphReader.h"
 #include "../../auxiliary/NumericTools.h"
 #include "../../distance/DynBFS.h"
@@ -2158,6 +2159,162 @@ TEST_P(GraphGTest, testSortEdges) {
 	}
 }
 
+TEST_P(GraphGTest, testAdjacencyIndex) {
+	Aux::Random::setSeed(42, false);
+	const count n = 100;
+	Graph G = createGraph(n);
+	G.indexEdges();
+	Graph reference = G;
+	G.buildAdjacencyIndex(8);
+	EXPECT_TRUE(G.hasAdjacencyIndex());
+	EXPECT_FALSE(reference.hasAdjacencyIndex());
+
+	auto both = [&](std::function<void(Graph&)> modify) {
+		modify(G);
+		modify(reference);
+	};
+	auto expectSameLookups = [&]() {
+		ASSERT_EQ(reference.numberOfEdges(), G.numberOfEdges());
+		for (node u = 0; u < n; ++u) {
+			for (node v = 0; v < n; ++v) {
+				ASSERT_EQ(reference.hasEdge(u, v), G.hasEdge(u, v));
+				ASSERT_EQ(reference.weight(u, v), G.weight(u, v));
+				if (reference.hasEdge(u, v)) {
+					ASSERT_EQ(reference.edgeId(u, v), G.edgeId(u, v));
+				}
+			}
+		}
+	};
+
+	// node 0 is a hub, node 1 gets a multi-edge to it
+	for (index i = 0; i < 1000; ++i) {
+		node u = Aux::Random::probability() < 0.5 ? 0 : Aux::Random::integer(n - 1);
+		node v = Aux::Random::integer(n - 1);
+		edgeweight w = Aux::Random::real();
+		double r = Aux::Random::real();
+		if (r < 0.6) {
+			both([&](Graph& H) { H.addEdge(u, v, w); });
+		} else if (r < 0.8 && reference.hasEdge(u, v)) {
+			both([&](Graph& H) { H.removeEdge(u, v); });
+		} else if (isWeighted()) {
+			both([&](Graph& H) { H.increaseWeight(u, v, w); });
+		}
+	}
+	both([](Graph& H) { H.addEdge(1, 0, 2.0); H.addEdge(1, 0, 3.0); H.removeEdge(1, 0); });
+	expectSameLookups();
+
+	std::pair<node, node> e1 = reference.randomEdge();
+	std::pair<node, node> e2 = reference.randomEdge();
+	if (e1.first != e2.first && e1.second != e2.second && !reference.hasEdge(e1.first, e2.second) && !reference.hasEdge(e2.first, e1.second)) {
+		both([&](Graph& H) { H.swapEdge(e1.first, e1.second, e2.first, e2.second); });
+		expectSameLookups();
+	}
+
+	both([](Graph& H) { H.compactEdges(); });
+	expectSameLookups();
+	both([](Graph& H) { H.sortEdges(); });
+	expectSameLookups();
+
+	G.removeAdjacencyIndex();
+	EXPECT_FALSE(G.hasAdjacencyIndex());
+	expectSameLookups();
+}
+
+/** CSR SNAPSHOT **/
+
+TEST_P(GraphGTest, testCSRGraphFreeze) {
+	this->Ghouse.removeEdge(2, 4);
+	this->Ghouse.addEdge(0, 0);
+	this->Ghouse.indexEdges();
+
+	CSRGraph C(this->Ghouse);
+
+	ASSERT_EQ(this->Ghouse.isWeighted(), C.isWeighted());
+	ASSERT_EQ(this->Ghouse.isDirected(), C.isDirected());
+	ASSERT_TRUE(C.hasEdgeIds());
+	ASSERT_EQ(this->Ghouse.numberOfNodes(), C.numberOfNodes());
+	ASSERT_EQ(this->Ghouse.numberOfEdges(), C.numberOfEdges());
+	ASSERT_EQ(this->Ghouse.numberOfSelfLoops(), C.numberOfSelfLoops());
+	ASSERT_EQ(this->Ghouse.upperNodeIdBound(), C.upperNodeIdBound());
+	ASSERT_EQ(this->Ghouse.upperEdgeIdBound(), C.upperEdgeIdBound());
+	ASSERT_DOUBLE_EQ(this->Ghouse.totalEdgeWeight(), C.totalEdgeWeight());
+
+	this->Ghouse.forNodes([&](node u) {
+		ASSERT_EQ(this->Ghouse.degreeOut(u), C.degreeOut(u));
+		ASSERT_EQ(this->Ghouse.degreeIn(u), C.degreeIn(u));
+		ASSERT_DOUBLE_EQ(this->Ghouse.weightedDegree(u), C.weightedDegree(u));
+
+		std::vector<std::tuple<node, edgeweight, edgeid> > expected, actual;
+		this->Ghouse.forEdgesOf(u, [&](node, node v, edgeweight w, edgeid eid) {
+			expected.emplace_back(v, w, eid);
+		});
+		C.forEdgesOf(u, [&](node, node v, edgeweight w, edgeid eid) {
+			actual.emplace_back(v, w, eid);
+		});
+		EXPECT_EQ(expected, actual);
+
+		expected.clear();
+		actual.clear();
+		this->Ghouse.forInEdgesOf(u, [&](node, node v, edgeweight w, edgeid eid) {
+			expected.emplace_back(v, w, eid);
+		});
+		C.forInEdgesOf(u, [&](node, node v, edgeweight w, edgeid eid) {
+			actual.emplace_back(v, w, eid);
+		});
+		EXPECT_EQ(expected, actual);
+	});
+
+	std::vector<std::pair<node, node> > expectedEdges, actualEdges;
+	this->Ghouse.forEdges([&](node u, node v) {
+		expectedEdges.emplace_back(u, v);
+	});
+	C.forEdges([&](node u, node v) {
+		actualEdges.emplace_back(u, v);
+	});
+	EXPECT_EQ(expectedEdges, actualEdges);
+
+	count edges = 0;
+	C.parallelForEdges([&](node, node) {
+		#pragma omp atomic
+		edges++;
+	});
+	EXPECT_EQ(this->Ghouse.numberOfEdges(), edges);
+}
+
+TEST_P(GraphGTest, testCSRGraphSortedLookup) {
+	Graph G = createGraph(100);
+	G.forNodes([&](node u) {
+		for (index i = 0; i < 5; ++i) {
+			node v = Aux::Random::integer(99);
+			if (!G.hasEdge(u, v)) {
+				G.addEdge(u, v, Aux::Random::real());
+			}
+		}
+	});
+	G.indexEdges();
+
+	for (bool sortAdjacency : {false, true}) {
+		CSRGraph C(G, sortAdjacency);
+		ASSERT_EQ(sortAdjacency, C.hasSortedAdjacency());
+		G.forNodes([&](node u) {
+			node last = 0;
+			C.forNeighborsOf(u, [&](node v) {
+				if (sortAdjacency) {
+					EXPECT_LE(last, v);
+				}
+				last = v;
+			});
+			G.forNodes([&](node v) {
+				ASSERT_EQ(G.hasEdge(u, v), C.hasEdge(u, v));
+				ASSERT_EQ(G.weight(u, v), C.weight(u, v));
+				if (G.hasEdge(u, v)) {
+					ASSERT_EQ(G.edgeId(u, v), C.edgeId(u, v));
+				}
+			});
+		});
+	}
+}
+
 } /* namespace NetworKit */
 
 #endif /*NOGTEST */
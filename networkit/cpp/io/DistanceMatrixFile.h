@@ -0,0 +1,38 @@
+/*
+ * DistanceMatrixFile.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef DISTANCEMATRIXFILE_H_
+#define DISTANCEMATRIXFILE_H_
+
+#include <cstdint>
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ * Layout of the NetworKit distance matrix format. The header below is followed by the
+ * rows * columns entries of the matrix in row-major order, so every row can be read
+ * directly from a memory mapping. All fields are stored in host byte order.
+ *
+ * Entries are 1, 2, 4 or 8 bytes wide. Entries of 1 and 2 bytes are unsigned integers
+ * and are meant for hop distances, the largest value stands for unreachable pairs.
+ * Entries of 4 and 8 bytes are float and double; unreachable pairs are infinity.
+ */
+struct DistanceMatrixHeader {
+	static constexpr uint64_t magicValue = 0x313054414d444b4eull; //!< "NKDMAT01"
+	static constexpr uint64_t byteOrderValue = 0x0102030405060708ull;
+
+	uint64_t magic;
+	uint64_t byteOrder;
+	uint64_t bytesPerEntry;
+	uint64_t rows;
+	uint64_t columns;
+};
+
+static_assert(sizeof(DistanceMatrixHeader) == 5 * sizeof(uint64_t), "DistanceMatrixHeader must not contain padding");
+
+} /* namespace NetworKit */
+#endif /* DISTANCEMATRIXFILE_H_ */
@@ -0,0 +1,71 @@
+/*
+ * DistanceMatrixReader.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include "DistanceMatrixReader.h"
+#include "DistanceMatrixFile.h"
+#include "../auxiliary/Enforce.h"
+
+namespace NetworKit {
+
+DistanceMatrixReader::DistanceMatrixReader(const std::string& path) : file(path) {
+	Aux::enforce(file.size() >= sizeof(DistanceMatrixHeader), "File is too small to contain a distance matrix");
+
+	const DistanceMatrixHeader& header = *reinterpret_cast<const DistanceMatrixHeader*>(file.begin());
+	Aux::enforce(header.magic == DistanceMatrixHeader::magicValue, "File is not a NetworKit distance matrix");
+	Aux::enforce(header.byteOrder == DistanceMatrixHeader::byteOrderValue, "Distance matrix was written with a different byte order");
+	bytesPerEntry = header.bytesPerEntry;
+	rows = header.rows;
+	columns = header.columns;
+	Aux::enforce(bytesPerEntry == 1 || bytesPerEntry == 2 || bytesPerEntry == 4 || bytesPerEntry == 8, "Broken distance matrix header");
+	Aux::enforce(file.size() == sizeof(DistanceMatrixHeader) + rows * columns * bytesPerEntry, "Size of distance matrix does not match its header");
+	entries = file.begin() + sizeof(DistanceMatrixHeader);
+}
+
+edgeweight DistanceMatrixReader::decode(const char* entry) const {
+	switch (bytesPerEntry) {
+		case 1: {
+			uint8_t d = *reinterpret_cast<const uint8_t*>(entry);
+			return d == std::numeric_limits<uint8_t>::max() ? std::numeric_limits<edgeweight>::max() : d;
+		}
+		case 2: {
+			uint16_t d;
+			std::memcpy(&d, entry, sizeof(d));
+			return d == std::numeric_limits<uint16_t>::max() ? std::numeric_limits<edgeweight>::max() : d;
+		}
+		case 4: {
+			float d;
+			std::memcpy(&d, entry, sizeof(d));
+			return std::isinf(d) ? std::numeric_limits<edgeweight>::max() : d;
+		}
+		default: {
+			double d;
+			std::memcpy(&d, entry, sizeof(d));
+			return std::isinf(d) ? std::numeric_limits<edgeweight>::max() : d;
+		}
+	}
+}
+
+edgeweight DistanceMatrixReader::getDistance(index u, index v) const {
+	Aux::enforce(u < rows && v < columns, "Entry is out of the range of the distance matrix");
+	return decode(entries + (u * columns + v) * bytesPerEntry);
+}
+
+std::vector<edgeweight> DistanceMatrixReader::getRow(index u) const {
+	Aux::enforce(u < rows, "Row is out of the range of the distance matrix");
+	std::vector<edgeweight> row(columns);
+	const char* entry = entries + u * columns * bytesPerEntry;
+	for (index v = 0; v < columns; ++v, entry += bytesPerEntry) {
+		row[v] = decode(entry);
+	}
+	return row;
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,57 @@
+/*
+ * DistanceMatrixReader.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef DISTANCEMATRIXREADER_H_
+#define DISTANCEMATRIXREADER_H_
+
+#include <string>
+#include <vector>
+
+#include "MemoryMappedFile.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ * Gives access to a distance matrix written by DistanceMatrixWriter. The file is
+ * memory-mapped and only the rows that are queried are read from disk. Unreachable
+ * pairs have the distance std::numeric_limits<edgeweight>::max(), as in BFS and Dijkstra.
+ */
+class DistanceMatrixReader {
+
+public:
+	/**
+	 * Opens the distance matrix at @a path. Throws a std::runtime_error if the file
+	 * is not a distance matrix.
+	 */
+	DistanceMatrixReader(const std::string& path);
+
+	count numberOfRows() const { return rows; }
+
+	count numberOfColumns() const { return columns; }
+
+	/**
+	 * @return the distance in row @a u and column @a v
+	 */
+	edgeweight getDistance(index u, index v) const;
+
+	/**
+	 * @return the distances in row @a u
+	 */
+	std::vector<edgeweight> getRow(index u) const;
+
+private:
+	MemoryMappedFile file;
+	const char* entries;
+	count bytesPerEntry;
+	count rows;
+	count columns;
+
+	edgeweight decode(const char* entry) const;
+};
+
+} /* namespace NetworKit */
+#endif /* DISTANCEMATRIXREADER_H_ */
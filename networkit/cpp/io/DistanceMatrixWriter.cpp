@@ -0,0 +1,75 @@
+/*
+ * DistanceMatrixWriter.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#include "DistanceMatrixWriter.h"
+#include "DistanceMatrixFile.h"
+#include "../auxiliary/Enforce.h"
+
+namespace NetworKit {
+
+DistanceMatrixWriter::DistanceMatrixWriter(const std::string& path, count rows, count columns, count bytesPerEntry) : rows(rows), columns(columns), bytesPerEntry(bytesPerEntry) {
+	Aux::enforce(bytesPerEntry == 1 || bytesPerEntry == 2 || bytesPerEntry == 4 || bytesPerEntry == 8, "Entries of a distance matrix must have 1, 2, 4 or 8 bytes");
+	file.open(path, std::ios::binary | std::ios::trunc);
+	Aux::enforceOpened(file);
+
+	DistanceMatrixHeader header;
+	header.magic = DistanceMatrixHeader::magicValue;
+	header.byteOrder = DistanceMatrixHeader::byteOrderValue;
+	header.bytesPerEntry = bytesPerEntry;
+	header.rows = rows;
+	header.columns = columns;
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+}
+
+template<typename T>
+bool DistanceMatrixWriter::encode(count numberOfRows, const edgeweight* distances) {
+	const count entries = numberOfRows * columns;
+	T* out = reinterpret_cast<T*>(buffer.data());
+	bool representable = true;
+	#pragma omp parallel for reduction(&&:representable)
+	for (index i = 0; i < entries; ++i) {
+		const edgeweight d = distances[i];
+		if (d == std::numeric_limits<edgeweight>::max()) {
+			out[i] = std::is_integral<T>::value ? std::numeric_limits<T>::max() : std::numeric_limits<T>::infinity();
+		} else if (std::is_integral<T>::value) {
+			// the largest value is reserved for unreachable pairs
+			representable = representable && d >= 0 && d == std::floor(d) && d < std::numeric_limits<T>::max();
+			out[i] = static_cast<T>(d);
+		} else {
+			// large finite distances must not turn into the marker of unreachable pairs
+			out[i] = static_cast<T>(d);
+			representable = representable && std::isfinite(out[i]);
+		}
+	}
+	return representable;
+}
+
+void DistanceMatrixWriter::writeRows(index first, count numberOfRows, const edgeweight* distances) {
+	Aux::enforce(first + numberOfRows <= rows, "Rows are out of the range of the distance matrix");
+	buffer.resize(numberOfRows * columns * bytesPerEntry);
+	bool representable;
+	switch (bytesPerEntry) {
+		case 1: representable = encode<uint8_t>(numberOfRows, distances); break;
+		case 2: representable = encode<uint16_t>(numberOfRows, distances); break;
+		case 4: representable = encode<float>(numberOfRows, distances); break;
+		default: representable = encode<double>(numberOfRows, distances);
+	}
+	Aux::enforce(representable, "Distance cannot be stored in an entry of the distance matrix, use wider entries");
+
+	file.seekp(sizeof(DistanceMatrixHeader) + first * columns * bytesPerEntry);
+	file.write(buffer.data(), buffer.size());
+	Aux::enforce(file.good(), "Writing the distance matrix failed");
+}
+
+void DistanceMatrixWriter::close() {
+	file.close();
+}
+
+} /* namespace NetworKit */
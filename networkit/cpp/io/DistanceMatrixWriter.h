@@ -0,0 +1,59 @@
+/*
+ * DistanceMatrixWriter.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef DISTANCEMATRIXWRITER_H_
+#define DISTANCEMATRIXWRITER_H_
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "../Globals.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ * Writes a distance matrix in the NetworKit distance matrix format (see DistanceMatrixFile.h)
+ * block of rows by block of rows, so the matrix never has to be in memory as a whole.
+ * Distances of std::numeric_limits<edgeweight>::max() (as returned by BFS and Dijkstra)
+ * are stored as unreachable.
+ */
+class DistanceMatrixWriter {
+
+public:
+	/**
+	 * Creates the file at @a path for a matrix with @a rows rows and @a columns columns
+	 * with entries of @a bytesPerEntry bytes (1, 2, 4 or 8).
+	 */
+	DistanceMatrixWriter(const std::string& path, count rows, count columns, count bytesPerEntry = 2);
+
+	/**
+	 * Writes the @a numberOfRows rows starting with row @a first, which are given
+	 * in row-major order in @a distances. Throws a std::runtime_error if a distance
+	 * cannot be stored in an entry, e.g. a fractional or too large distance in an
+	 * integer entry.
+	 */
+	void writeRows(index first, count numberOfRows, const edgeweight* distances);
+
+	/**
+	 * Flushes and closes the file.
+	 */
+	void close();
+
+private:
+	std::ofstream file;
+	const count rows;
+	const count columns;
+	const count bytesPerEntry;
+	std::vector<char> buffer;
+
+	template<typename T>
+	bool encode(count numberOfRows, const edgeweight* distances);
+};
+
+} /* namespace NetworKit */
+#endif /* DISTANCEMATRIXWRITER_H_ */
@@ -6,9 +6,15 @@
  */
 
 #include "EdgeListReader.h"
+#include "MemoryMappedFile.h"
 #include "../auxiliary/Log.h"
+#include "../auxiliary/Parallel.h"
+#include "../graph/GraphBuilder.h"
 
+#include <cstdlib>
 #include <sstream>
+#include <tuple>
+#include <omp.h>
 
 #include "../auxiliary/Enforce.h"
 
@@ -37,109 +43,188 @@ std::map<std::string,node> EdgeListReader::getNodeMap() {
 }
 
 Graph EdgeListReader::readContinuous(const std::string& path) {
-	std::ifstream file(path);
-	Aux::enforceOpened(file);
-	std::string line; // the current line
+	// edge as parsed from the file; undirected edges are normalized to u >= v
+	struct ParsedEdge {
+		node u;
+		node v;
+		index line; //!< position in the file, the first occurrence of an edge wins
+		edgeweight weight;
+	};
 
-	// read file once to get to the last line and figure out the number of nodes
-	// unfortunately there is an empty line at the ending of the file, so we need to get the line before that
+	// per chunk results of the parallel parsing
+	struct Chunk {
+		std::vector<ParsedEdge> edges;
+		count lines = 0; //!< number of lines in the chunk
+		count firstFields = 0; //!< number of fields of the first edge line, 0 if there is none
+		index malformed = none; //!< chunk local number of the first malformed line
+		std::string malformedLine;
+		node maxNode = 0;
+	};
 
-	node maxNode = 0;
-	bool weighted = false;
-	bool checkedWeighted = false;
+	// marks lines with three fields in ParsedEdge::line during parsing
+	constexpr index weightedLineFlag = index(1) << 63;
 
 	DEBUG("separator: " , this->separator);
 	DEBUG("first node: " , this->firstNode);
 
-	// first find out the maximum node id
-	DEBUG("first pass");
-	count i = 0;
-	while (file.good()) {
-		++i;
-		std::getline(file, line);
-		TRACE("read line: " , line);
-		if (!line.empty()) {
-			if (line.back() == '\r') line.pop_back();
-			if (line.compare(0, this->commentPrefix.length(), this->commentPrefix) == 0) {
-				TRACE("ignoring comment: " , line);
-			} else {
-				std::vector<std::string> split = Aux::StringTools::split(line, this->separator);
-				if (!checkedWeighted) {
-					if (split.size() == 2) {
-						weighted = false;
-					} else if (split.size() == 3) {
-						INFO("Identified graph as weighted.");
-						weighted = true;
-					}
-					checkedWeighted = true;
+	MemoryMappedFile file(path);
+	std::vector<const char*> bounds = MemoryMappedFile::splitAtLines(file.begin(), file.end(), 4 * omp_get_max_threads());
+	const count chunks = bounds.size() - 1;
+	std::vector<Chunk> parsed(chunks);
+
+	DEBUG("parsing ", chunks, " chunks in parallel");
+	#pragma omp parallel
+	{
+		std::string line;
+		std::vector<char*> fields;
+
+		#pragma omp for schedule(dynamic)
+		for (index c = 0; c < chunks; ++c) {
+			Chunk& chunk = parsed[c];
+			const char* it = bounds[c];
+			const char* end = bounds[c + 1];
+			while (it != end) {
+				const char* eol = std::find(it, end, '\n');
+				line.assign(it, eol);
+				it = (eol == end) ? end : eol + 1;
+				++chunk.lines;
+
+				if (!line.empty() && line.back() == '\r') line.pop_back();
+				if (line.empty() || line.compare(0, this->commentPrefix.length(), this->commentPrefix) == 0) {
+					continue;
 				}
-				if (split.size() == 2 || split.size() == 3) {
-					TRACE("split into : " , split[0] , " and " , split[1]);
-					node u = std::stoul(split[0]);
-					if (u > maxNode) {
-						maxNode = u;
+
+				// split the line in place, a trailing separator does not start a new field
+				fields.clear();
+				fields.push_back(&line[0]);
+				for (char& ch : line) {
+					if (ch == this->separator) {
+						ch = '\0';
+						fields.push_back(&ch + 1);
 					}
-					node v = std::stoul(split[1]);
-					if (v > maxNode) {
-						maxNode = v;
+				}
+				if (*fields.back() == '\0' && fields.size() > 1) {
+					fields.pop_back();
+				}
+				if (chunk.firstFields == 0) {
+					chunk.firstFields = fields.size();
+				}
+
+				ParsedEdge e;
+				bool ok = (fields.size() == 2 || fields.size() == 3);
+				node ids[2] = {0, 0};
+				for (index f = 0; ok && f < 2; ++f) {
+					char* parsedEnd;
+					ids[f] = std::strtoull(fields[f], &parsedEnd, 10);
+					ok = (parsedEnd != fields[f]);
+				}
+				e.weight = defaultEdgeWeight;
+				if (ok && fields.size() == 3) {
+					char* parsedEnd;
+					e.weight = std::strtod(fields[2], &parsedEnd);
+					ok = (parsedEnd != fields[2]);
+				}
+				if (!ok) {
+					if (chunk.malformed == none) {
+						chunk.malformed = chunk.lines;
+						chunk.malformedLine.assign(line.begin(), line.end());
+						std::replace(chunk.malformedLine.begin(), chunk.malformedLine.end(), '\0', this->separator);
 					}
-				} else {
-					std::stringstream message;
-					message << "malformed line ";
-					message << i << ": ";
-					message << line;
-					throw std::runtime_error(message.str());
+					continue;
 				}
+
+				chunk.maxNode = std::max(chunk.maxNode, std::max(ids[0], ids[1]));
+				e.u = ids[0] - this->firstNode;
+				e.v = ids[1] - this->firstNode;
+				if (!directed && e.u < e.v) {
+					std::swap(e.u, e.v);
+				}
+				e.line = chunk.lines;
+				if (fields.size() == 3) {
+					// mark lines with weights, they are malformed if the graph turns out to be unweighted
+					e.line |= weightedLineFlag;
+				}
+				chunk.edges.push_back(e);
 			}
-		} else {
-			DEBUG("line ", i, " is empty.");
 		}
 	}
-	file.close();
+
+	// the first edge line decides whether the graph is weighted
+	bool weighted = false;
+	for (const Chunk& chunk : parsed) {
+		if (chunk.firstFields != 0) {
+			weighted = (chunk.firstFields == 3);
+			if (weighted) {
+				INFO("Identified graph as weighted.");
+			}
+			break;
+		}
+	}
+
+	// compute global line numbers and report the first malformed line
+	count linesBefore = 0;
+	node maxNode = 0;
+	std::vector<index> firstEdge(chunks + 1, 0);
+	for (index c = 0; c < chunks; ++c) {
+		Chunk& chunk = parsed[c];
+		index malformed = chunk.malformed;
+		if (!weighted) {
+			for (const ParsedEdge& e : chunk.edges) {
+				if ((e.line & weightedLineFlag) && (e.line & ~weightedLineFlag) < malformed) {
+					malformed = e.line & ~weightedLineFlag;
+					break;
+				}
+			}
+		}
+		if (malformed != none) {
+			std::string text = chunk.malformedLine;
+			if (malformed != chunk.malformed) {
+				text = "(weighted edge in unweighted graph)";
+			}
+			std::stringstream message;
+			message << "malformed line ";
+			message << linesBefore + malformed << ": ";
+			message << text;
+			throw std::runtime_error(message.str());
+		}
+		linesBefore += chunk.lines;
+		maxNode = std::max(maxNode, chunk.maxNode);
+		firstEdge[c + 1] = firstEdge[c] + chunk.edges.size();
+	}
 	maxNode = maxNode - this->firstNode + 1;
 	DEBUG("max. node id found: " , maxNode);
 
-	Graph G(maxNode, weighted, directed);
+	// gather all edges with global positions and keep only the first occurrence of each edge
+	std::vector<ParsedEdge> edges(firstEdge[chunks]);
+	#pragma omp parallel for schedule(dynamic)
+	for (index c = 0; c < chunks; ++c) {
+		index pos = firstEdge[c];
+		for (ParsedEdge e : parsed[c].edges) {
+			e.line = pos;
+			edges[pos++] = e;
+		}
+		std::vector<ParsedEdge>().swap(parsed[c].edges);
+	}
+	Aux::Parallel::sort(edges.begin(), edges.end(), [](const ParsedEdge& a, const ParsedEdge& b) {
+		return std::tie(a.u, a.v, a.line) < std::tie(b.u, b.v, b.line);
+	});
+	auto last = std::unique(edges.begin(), edges.end(), [](const ParsedEdge& a, const ParsedEdge& b) {
+		return a.u == b.u && a.v == b.v;
+	});
+	edges.erase(last, edges.end());
 
-	DEBUG("second pass");
-	file.open(path);
-	// split the line into start and end node. since the edges are sorted, the start node has the highest id of all nodes
-	i = 0; // count lines
-	while(std::getline(file,line)){
-		if (line.empty()) continue;
-		if(*line.rbegin() == '\r') line.pop_back();
-		++i;
-		if (line.compare(0, this->commentPrefix.length(), this->commentPrefix) == 0) {
-			// TRACE("ignoring comment: " , line);
-		} else {
-			// TRACE("edge line: " , line);
-			std::vector<std::string> split = Aux::StringTools::split(line, this->separator);
-			if (split.size() == 2) {
-				node u = std::stoul(split[0]) - this->firstNode;
-				node v = std::stoul(split[1]) - this->firstNode;
-			    if (!G.hasEdge(u,v)) {
-					G.addEdge(u, v);
-				}
-			} else if (weighted && split.size() == 3) {
-				node u = std::stoul(split[0]) - this->firstNode;
-				node v = std::stoul(split[1]) - this->firstNode;
-				double weight = std::stod(split[2]);
-			    if (!G.hasEdge(u,v)) {
-					G.addEdge(u, v, weight);
-				}
-			} else {
-				std::stringstream message;
-				message << "malformed line ";
-				message << i << ": ";
-				message << line;
-				throw std::runtime_error(message.str());
+	// the edges of one source node are consecutive now, so each node's half edges can be added in parallel
+	GraphBuilder builder(maxNode, weighted, directed);
+	#pragma omp parallel for schedule(guided)
+	for (index i = 0; i < edges.size(); ++i) {
+		if (i == 0 || edges[i - 1].u != edges[i].u) {
+			for (index j = i; j < edges.size() && edges[j].u == edges[i].u; ++j) {
+				builder.addHalfEdge(edges[j].u, edges[j].v, edges[j].weight);
 			}
 		}
 	}
-	file.close();
 
-	G.shrinkToFit();
-	return G;
+	return builder.toGraph(true, true);
 }
 
 
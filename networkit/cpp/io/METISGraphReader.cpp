@@ -5,15 +5,35 @@
  *      Author: Christian Staudt (christian.staudt@kit.edu)
  */
 
+#include <algorithm>
+#include <numeric>
+#include <omp.h>
+
 #include "METISGraphReader.h"
 #include "METISParser.h"
+#include "MemoryMappedFile.h"
 #include "../auxiliary/Enforce.h"
 #include "../auxiliary/Log.h"
+#include "../auxiliary/NumberParsing.h"
 #include "../auxiliary/StringTools.h"
 #include "../graph/GraphBuilder.h"
 
 namespace NetworKit {
 
+/**
+ * Calls @a handle(first, last) for every line in [@a it, @a end) that is not a comment.
+ */
+template<typename L>
+static void forAdjacencyLines(const char* it, const char* end, L handle) {
+	while (it != end) {
+		const char* eol = std::find(it, end, '\n');
+		if (*it != '%') {
+			handle(it, eol);
+		}
+		it = (eol == end) ? end : eol + 1;
+	}
+}
+
 Graph METISGraphReader::read(const std::string& path) {
 
 	METISParser parser(path);
@@ -23,6 +43,7 @@ Graph METISGraphReader::read(const std::string& path) {
 	count m = std::get<1>(header);
 	index fmt = std::get<2>(header);
 	count ncon = std::get<3>(header);
+	std::streamoff bodyOffset = parser.getBodyOffset();
 
 	bool weighted;
 	if (fmt % 10 == 1) {
@@ -41,63 +62,78 @@ Graph METISGraphReader::read(const std::string& path) {
 	std::string graphName = Aux::StringTools::split(Aux::StringTools::split(path, '/').back(), '.').front();
 	b.setName(graphName);
 
-	INFO("\n[BEGIN] reading graph G(n=", n, ", m=", m, ") from METIS file: ", graphName);	// progress bar follows
-
-#if (LOG_LEVEL == LOG_LEVEL_TRACE)
-	double p = 0.0; // percentage for progress bar
-#endif
-	node u = 0; // begin with 0
-	count edgeCounter = 0;
-	if (weighted == 0) {
-		while (parser.hasNext() && u < n) {
-			std::vector<node> adjacencies = parser.getNext(ignoreFirst);
-			edgeCounter += adjacencies.size();
-			for (index i=0; i < adjacencies.size(); i++) {
-				if (adjacencies[i] == 0) {
-					ERROR("METIS Node ID should not be 0, edge ignored.");
-					continue;
-				}
-				Aux::Checkers::Enforcer::enforce(adjacencies[i] > 0 && adjacencies[i] <= n);
-				node v = adjacencies[i] - 1; 	// METIS-indices are 1-based
-				// correct edgeCounter for selfloops
-				edgeCounter += (u == v);
-				b.addHalfEdge(u, v);
-			}
-			u++; // next node
-#if (LOG_LEVEL == LOG_LEVEL_TRACE)
-			if ((u % ((n + 10)/10)) == 0) {
-				p = ((double) (u-1) / (double) n) * 100;
-				DEBUG(p, "% ");
+	INFO("\n[BEGIN] reading graph G(n=", n, ", m=", m, ") from METIS file: ", graphName);
+
+	// split the adjacency lines into chunks which are parsed in parallel
+	MemoryMappedFile file(path);
+	const char* body = file.begin() + std::min<size_t>(bodyOffset, file.size());
+	std::vector<const char*> bounds = MemoryMappedFile::splitAtLines(body, file.end(), 4 * omp_get_max_threads());
+	const count chunks = bounds.size() - 1;
+
+	// the i-th adjacency line belongs to node i, so count the lines per chunk first
+	std::vector<count> firstNode(chunks + 1, 0);
+	#pragma omp parallel for schedule(dynamic)
+	for (index c = 0; c < chunks; ++c) {
+		forAdjacencyLines(bounds[c], bounds[c + 1], [&](const char*, const char*) {
+			++firstNode[c + 1];
+		});
+	}
+	std::partial_sum(firstNode.begin(), firstNode.end(), firstNode.begin());
+
+	// every line is parsed by exactly one thread, which adds all half edges of its node
+	std::vector<count> edgeCounters(chunks, 0);
+	std::vector<std::string> errors(chunks);
+	#pragma omp parallel for schedule(dynamic)
+	for (index c = 0; c < chunks; ++c) {
+		node u = firstNode[c];
+		forAdjacencyLines(bounds[c], bounds[c + 1], [&](const char* it, const char* end) {
+			if (u >= n || !errors[c].empty()) {
+				return;
 			}
-#endif
-		}
-	} else {
-		while (parser.hasNext() && u < n) {
-			std::vector<std::pair<node,double>> adjacencies = parser.getNextWithWeights(ignoreFirst);
-			edgeCounter += adjacencies.size();
-			DEBUG("node ",u," has ",adjacencies.size()," edges");
-			for (index i=0; i < adjacencies.size(); i++) {
-				if (adjacencies[i].first == 0) {
-					ERROR("METIS Node ID should not be 0, edge ignored.");
-					continue;
+			try {
+				for (index i = 0; i < ignoreFirst; ++i) {
+					// parse first values but ignore them.
+					double dummy;
+					std::tie(dummy, it) = Aux::Parsing::strTo<double>(it, end);
 				}
-				Aux::Checkers::Enforcer::enforce(adjacencies[i].first > 0 && adjacencies[i].first <= n);
-				node v = adjacencies[i].first - 1; 	// METIS-indices are 1-based
-				// correct edgeCounter for selfloops
-				edgeCounter += (u == v);
-				double weight = adjacencies[i].second;
-				b.addHalfEdge(u, v, weight);
-				TRACE("(",u,",",v,",",adjacencies[i].second,")");
-			}
-			u += 1; // next node
-#if (LOG_LEVEL == LOG_LEVEL_TRACE)
-			if ((u % ((n + 10)/10)) == 0) {
-				p = ((double) (u-1) / (double) n) * 100;
-				DEBUG(p, "% ");
+				while (it != end) {
+					node v;
+					double weight = defaultEdgeWeight;
+					if (weighted) {
+						try {
+							std::tie(v, it) = Aux::Parsing::strTo<node>(it, end);
+							std::tie(weight, it) = Aux::Parsing::strTo<double, const char*, Aux::Checkers::Enforcer>(it, end);
+						} catch (std::exception& e) {
+							ERROR("malformed line; not all edges have been read correctly");
+							break;
+						}
+					} else {
+						std::tie(v, it) = Aux::Parsing::strTo<node>(it, end);
+					}
+					edgeCounters[c]++;
+					if (v == 0) {
+						ERROR("METIS Node ID should not be 0, edge ignored.");
+						continue;
+					}
+					Aux::Checkers::Enforcer::enforce(v <= n);
+					v = v - 1; 	// METIS-indices are 1-based
+					// correct edgeCounter for selfloops
+					edgeCounters[c] += (u == v);
+					b.addHalfEdge(u, v, weight);
+				}
+			} catch (std::exception& e) {
+				errors[c] = e.what();
 			}
-#endif
+			++u; // next node
+		});
+	}
+
+	for (const std::string& error : errors) {
+		if (!error.empty()) {
+			throw std::runtime_error("METIS file " + path + " could not be parsed: " + error);
 		}
 	}
+	count edgeCounter = std::accumulate(edgeCounters.begin(), edgeCounters.end(), count(0));
 
 	auto G = b.toGraph(false);
 
@@ -138,6 +138,17 @@ std::tuple<count, count, index, count> METISParser::getHeader() {
 
 
 
+std::streamoff METISParser::getBodyOffset() {
+	std::streamoff offset = this->graphFile.tellg();
+	if (offset < 0) {
+		// the header was the last line of the file
+		this->graphFile.clear();
+		this->graphFile.seekg(0, std::ios::end);
+		offset = this->graphFile.tellg();
+	}
+	return offset;
+}
+
 bool METISParser::hasNext() {
 	// if graph file has lines left, return true
 	return this->graphFile.good();
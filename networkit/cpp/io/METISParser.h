@@ -41,6 +41,11 @@ public:
 	 */
 	std::tuple<count, count, index, count> getHeader();
 
+	/**
+	 * Returns the byte offset of the first line after the header, to be called after getHeader().
+	 */
+	std::streamoff getBodyOffset();
+
 	/**
 	 * Test if graph file has a next line.
 	 */
@@ -0,0 +1,68 @@
+/*
+ * MemoryMappedFile.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "MemoryMappedFile.h"
+
+namespace NetworKit {
+
+MemoryMappedFile::MemoryMappedFile(const std::string& path) : data(nullptr), length(0) {
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0) {
+		throw std::runtime_error("Could not open " + path);
+	}
+	struct stat info;
+	if (fstat(fd, &info) != 0) {
+		close(fd);
+		throw std::runtime_error("Could not stat " + path);
+	}
+	length = info.st_size;
+	if (length > 0) {
+		void* mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (mapping == MAP_FAILED) {
+			close(fd);
+			throw std::runtime_error("Could not map " + path);
+		}
+		madvise(mapping, length, MADV_SEQUENTIAL);
+		data = static_cast<const char*>(mapping);
+	}
+	close(fd); // the mapping stays valid
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+	if (data != nullptr) {
+		munmap(const_cast<char*>(data), length);
+	}
+}
+
+std::vector<const char*> MemoryMappedFile::splitAtLines(const char* begin, const char* end, count parts) {
+	std::vector<const char*> bounds;
+	bounds.push_back(begin);
+	const count total = end - begin;
+	for (index i = 1; i < parts; ++i) {
+		const char* pos = std::max(bounds.back(), begin + total / parts * i);
+		if (pos != begin && pos < end && pos[-1] != '\n') {
+			pos = std::find(pos, end, '\n');
+			if (pos != end) {
+				++pos;
+			}
+		}
+		if (pos != bounds.back() && pos != end) {
+			bounds.push_back(pos);
+		}
+	}
+	bounds.push_back(end);
+	return bounds;
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,53 @@
+/*
+ * MemoryMappedFile.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef MEMORYMAPPEDFILE_H_
+#define MEMORYMAPPEDFILE_H_
+
+#include <string>
+#include <vector>
+
+#include "../Globals.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ * Read-only memory mapping of a whole file. The mapping is released on destruction.
+ */
+class MemoryMappedFile {
+
+public:
+
+	/**
+	 * Maps the file at @a path into memory. Throws a std::runtime_error if this fails.
+	 */
+	MemoryMappedFile(const std::string& path);
+
+	~MemoryMappedFile();
+
+	MemoryMappedFile(const MemoryMappedFile&) = delete;
+	MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+	const char* begin() const { return data; }
+
+	const char* end() const { return data + length; }
+
+	size_t size() const { return length; }
+
+	/**
+	 * Splits [@a begin, @a end) into at most @a parts ranges of similar size whose boundaries are
+	 * line starts. Returns the boundaries, i.e. range i is [result[i], result[i+1]).
+	 */
+	static std::vector<const char*> splitAtLines(const char* begin, const char* end, count parts);
+
+private:
+	const char* data;
+	size_t length;
+};
+
+} /* namespace NetworKit */
+#endif /* MEMORYMAPPEDFILE_H_ */
@@ -0,0 +1,52 @@
+/*
+ * NetworkitBinaryGraph.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef NETWORKITBINARYGRAPH_H_
+#define NETWORKITBINARYGRAPH_H_
+
+#include <cstdint>
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ * Layout of the NetworKit binary graph format. All fields are 8 bytes wide and stored in
+ * host byte order, so every section is 8-byte aligned and can be used directly from a
+ * memory mapping. The file consists of
+ *
+ *   - the header below
+ *   - the ids of deleted nodes (upperNodeIdBound - numberOfNodes entries)
+ *   - out offsets (upperNodeIdBound + 1 entries), out targets (outEntries entries),
+ *     out weights (if weighted) and out edge ids (if indexed)
+ *   - for directed graphs: in offsets, in sources, in weights and in edge ids in the same schema
+ *
+ * For undirected graphs every edge {u, v} with u != v is stored at u and at v, exactly like
+ * the adjacency arrays of the Graph class.
+ */
+struct NetworkitBinaryHeader {
+	static constexpr uint64_t magicValue = 0x3130304742424b4eull; //!< "NKBBG001"
+	static constexpr uint64_t byteOrderValue = 0x0102030405060708ull;
+
+	static constexpr uint64_t directedFlag = 1;
+	static constexpr uint64_t weightedFlag = 2;
+	static constexpr uint64_t indexedFlag = 4;
+
+	uint64_t magic;
+	uint64_t byteOrder;
+	uint64_t flags;
+	uint64_t upperNodeIdBound;
+	uint64_t numberOfNodes;
+	uint64_t numberOfEdges;
+	uint64_t numberOfSelfLoops;
+	uint64_t upperEdgeIdBound;
+	uint64_t outEntries;
+	uint64_t inEntries;
+};
+
+static_assert(sizeof(NetworkitBinaryHeader) == 10 * sizeof(uint64_t), "NetworkitBinaryHeader must not contain padding");
+
+} /* namespace NetworKit */
+#endif /* NETWORKITBINARYGRAPH_H_ */
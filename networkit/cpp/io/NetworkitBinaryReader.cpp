@@ -0,0 +1,120 @@
+/*
+ * NetworkitBinaryReader.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include "NetworkitBinaryReader.h"
+#include "NetworkitBinaryGraph.h"
+#include "MemoryMappedFile.h"
+#include "../auxiliary/Enforce.h"
+
+namespace NetworKit {
+
+Graph NetworkitBinaryReader::read(const std::string& path) {
+	MemoryMappedFile file(path);
+	Aux::enforce(file.size() >= sizeof(NetworkitBinaryHeader), "File is too small to contain a NetworKit binary graph");
+
+	const NetworkitBinaryHeader& header = *reinterpret_cast<const NetworkitBinaryHeader*>(file.begin());
+	Aux::enforce(header.magic == NetworkitBinaryHeader::magicValue, "File is not a NetworKit binary graph");
+	Aux::enforce(header.byteOrder == NetworkitBinaryHeader::byteOrderValue, "NetworKit binary graph was written with a different byte order");
+
+	const bool directed = header.flags & NetworkitBinaryHeader::directedFlag;
+	const bool weighted = header.flags & NetworkitBinaryHeader::weightedFlag;
+	const bool indexed = header.flags & NetworkitBinaryHeader::indexedFlag;
+	const count z = header.upperNodeIdBound;
+	Aux::enforce(header.numberOfNodes <= z, "Broken NetworKit binary graph header");
+
+	// compute the sections of the file and check that they fit
+	const uint64_t* sections = reinterpret_cast<const uint64_t*>(file.begin() + sizeof(NetworkitBinaryHeader));
+	const count words = (file.size() - sizeof(NetworkitBinaryHeader)) / sizeof(uint64_t);
+	// every section has at least as many words as these counts; bounding them first keeps the
+	// sums below far from overflowing, so a crafted header cannot wrap around to the file size
+	Aux::enforce(z <= words && header.outEntries <= words && (!directed || header.inEntries <= words), "Size of NetworKit binary graph does not match its header");
+	auto sectionsSize = [&](count entries) {
+		return (z + 1) + entries * (1 + weighted + indexed);
+	};
+	count expectedWords = (z - header.numberOfNodes) + sectionsSize(header.outEntries);
+	if (directed) {
+		expectedWords += sectionsSize(header.inEntries);
+	}
+	Aux::enforce(words == expectedWords, "Size of NetworKit binary graph does not match its header");
+
+	const uint64_t* deleted = sections;
+	const uint64_t* outBegin = deleted + (z - header.numberOfNodes);
+	const node* outTargets = outBegin + (z + 1);
+	const edgeweight* outWeights = reinterpret_cast<const edgeweight*>(outTargets + header.outEntries);
+	const edgeid* outIds = outTargets + header.outEntries * (1 + weighted);
+	const uint64_t* inBegin = outTargets + header.outEntries * (1 + weighted + indexed);
+	const node* inSources = inBegin + (z + 1);
+	const edgeweight* inWeights = reinterpret_cast<const edgeweight*>(inSources + header.inEntries);
+	const edgeid* inIds = inSources + header.inEntries * (1 + weighted);
+	Aux::enforce(outBegin[z] == header.outEntries && (!directed || inBegin[z] == header.inEntries), "Broken adjacency offsets in NetworKit binary graph");
+
+	Graph G(z, weighted, directed);
+	if (indexed) {
+		G.outEdgeIds.resize(z);
+		if (directed) {
+			G.inEdgeIds.resize(z);
+		}
+	}
+
+	// every node copies its slice of the mapping into its own adjacency arrays; exceptions
+	// must not leave the parallel region, so broken slices are only reported afterwards
+	auto validSlice = [&](const uint64_t* begin, const node* neighbors, count entries, node u) {
+		if (begin[u] > begin[u + 1] || begin[u + 1] > entries) {
+			return false;
+		}
+		for (index i = begin[u]; i < begin[u + 1]; ++i) {
+			if (neighbors[i] >= z) {
+				return false;
+			}
+		}
+		return true;
+	};
+	bool valid = true;
+	#pragma omp parallel for schedule(guided) reduction(&&:valid)
+	for (node u = 0; u < z; ++u) {
+		if (!validSlice(outBegin, outTargets, header.outEntries, u) || (directed && !validSlice(inBegin, inSources, header.inEntries, u))) {
+			valid = false;
+			continue;
+		}
+		const index outFirst = outBegin[u];
+		const index outLast = outBegin[u + 1];
+		G.outEdges[u].assign(outTargets + outFirst, outTargets + outLast);
+		G.outDeg[u] = outLast - outFirst;
+		if (weighted) {
+			G.outEdgeWeights[u].assign(outWeights + outFirst, outWeights + outLast);
+		}
+		if (indexed) {
+			G.outEdgeIds[u].assign(outIds + outFirst, outIds + outLast);
+		}
+		if (directed) {
+			const index inFirst = inBegin[u];
+			const index inLast = inBegin[u + 1];
+			G.inEdges[u].assign(inSources + inFirst, inSources + inLast);
+			G.inDeg[u] = inLast - inFirst;
+			if (weighted) {
+				G.inEdgeWeights[u].assign(inWeights + inFirst, inWeights + inLast);
+			}
+			if (indexed) {
+				G.inEdgeIds[u].assign(inIds + inFirst, inIds + inLast);
+			}
+		}
+	}
+	Aux::enforce(valid, "Broken adjacency arrays in NetworKit binary graph");
+
+	for (index i = 0; i < z - header.numberOfNodes; ++i) {
+		Aux::enforce(deleted[i] < z, "Broken node id in NetworKit binary graph");
+		G.exists[deleted[i]] = false;
+	}
+	G.n = header.numberOfNodes;
+	G.m = header.numberOfEdges;
+	G.storedNumberOfSelfLoops = header.numberOfSelfLoops;
+	G.omega = header.upperEdgeIdBound;
+	G.edgesIndexed = indexed;
+
+	return G;
+}
+
+} /* namespace NetworKit */
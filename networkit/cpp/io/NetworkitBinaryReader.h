@@ -0,0 +1,37 @@
+/*
+ * NetworkitBinaryReader.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef NETWORKITBINARYREADER_H_
+#define NETWORKITBINARYREADER_H_
+
+#include <string>
+
+#include "GraphReader.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ * Reads graphs in the NetworKit binary format written by NetworkitBinaryWriter.
+ * The file is memory-mapped and the adjacency arrays of the graph are copied from the
+ * mapping in parallel, without parsing or per-edge insertion.
+ */
+class NetworkitBinaryReader: public NetworKit::GraphReader {
+
+public:
+
+	NetworkitBinaryReader() = default; //nullary constructor for Python shell
+
+	/**
+	 * Given the path of an input file, read the graph contained.
+	 *
+	 * @param[in]	path	input file path
+	 */
+	virtual Graph read(const std::string& path) override;
+};
+
+} /* namespace NetworKit */
+#endif /* NETWORKITBINARYREADER_H_ */
@@ -0,0 +1,145 @@
+/*
+ * NetworkitBinaryWriter.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include <vector>
+
+#include "NetworkitBinaryWriter.h"
+#include "NetworkitBinaryGraph.h"
+#include "../auxiliary/Enforce.h"
+
+namespace NetworKit {
+
+namespace {
+
+/**
+ * Buffers fixed-size values and writes them to the file in large blocks.
+ */
+template<typename T>
+class BlockWriter {
+public:
+	BlockWriter(std::ofstream& file) : file(file) {
+		buffer.reserve(blockSize);
+	}
+
+	~BlockWriter() {
+		flush();
+	}
+
+	void push(T value) {
+		buffer.push_back(value);
+		if (buffer.size() == blockSize) {
+			flush();
+		}
+	}
+
+	void flush() {
+		file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size() * sizeof(T));
+		buffer.clear();
+	}
+
+private:
+	static constexpr count blockSize = 1 << 16;
+	std::ofstream& file;
+	std::vector<T> buffer;
+};
+
+template<bool incoming, typename L>
+void forAdjacentEdges(const Graph& G, node u, L handle) {
+	if (incoming) {
+		G.forInEdgesOf(u, handle);
+	} else {
+		G.forEdgesOf(u, handle);
+	}
+}
+
+}
+
+void NetworkitBinaryWriter::write(const Graph& G, const std::string& path) {
+	std::ofstream file(path, std::ios::binary | std::ios::out | std::ios::trunc);
+	Aux::enforceOpened(file);
+
+	NetworkitBinaryHeader header;
+	header.magic = NetworkitBinaryHeader::magicValue;
+	header.byteOrder = NetworkitBinaryHeader::byteOrderValue;
+	header.flags = (G.isDirected() ? NetworkitBinaryHeader::directedFlag : 0)
+		| (G.isWeighted() ? NetworkitBinaryHeader::weightedFlag : 0)
+		| (G.hasEdgeIds() ? NetworkitBinaryHeader::indexedFlag : 0);
+	header.upperNodeIdBound = G.upperNodeIdBound();
+	header.numberOfNodes = G.numberOfNodes();
+	header.numberOfEdges = G.numberOfEdges();
+	header.numberOfSelfLoops = G.numberOfSelfLoops();
+	header.upperEdgeIdBound = G.hasEdgeIds() ? G.upperEdgeIdBound() : 0;
+	header.outEntries = 0;
+	header.inEntries = 0;
+	G.forNodes([&](node u) {
+		header.outEntries += G.degreeOut(u);
+		if (G.isDirected()) {
+			header.inEntries += G.degreeIn(u);
+		}
+	});
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+	{
+		BlockWriter<uint64_t> deleted(file);
+		for (node u = 0; u < G.upperNodeIdBound(); ++u) {
+			if (!G.hasNode(u)) {
+				deleted.push(u);
+			}
+		}
+	}
+
+	writeAdjacency<false>(file, G);
+	if (G.isDirected()) {
+		writeAdjacency<true>(file, G);
+	}
+
+	Aux::enforce(file.good(), "Error while writing " + path);
+	file.close();
+}
+
+template<bool incoming>
+void NetworkitBinaryWriter::writeAdjacency(std::ofstream& file, const Graph& G) {
+	{
+		BlockWriter<uint64_t> offsets(file);
+		uint64_t offset = 0;
+		offsets.push(offset);
+		for (node u = 0; u < G.upperNodeIdBound(); ++u) {
+			if (G.hasNode(u)) {
+				offset += incoming ? G.degreeIn(u) : G.degreeOut(u);
+			}
+			offsets.push(offset);
+		}
+	}
+
+	{
+		BlockWriter<uint64_t> targets(file);
+		G.forNodes([&](node u) {
+			forAdjacentEdges<incoming>(G, u, [&](node, node v, edgeweight, edgeid) {
+				targets.push(v);
+			});
+		});
+	}
+
+	if (G.isWeighted()) {
+		BlockWriter<double> weights(file);
+		G.forNodes([&](node u) {
+			forAdjacentEdges<incoming>(G, u, [&](node, node, edgeweight ew, edgeid) {
+				weights.push(ew);
+			});
+		});
+	}
+
+	if (G.hasEdgeIds()) {
+		BlockWriter<uint64_t> ids(file);
+		G.forNodes([&](node u) {
+			forAdjacentEdges<incoming>(G, u, [&](node, node, edgeweight, edgeid eid) {
+				ids.push(eid);
+			});
+		});
+	}
+}
+
+} /* namespace NetworKit */
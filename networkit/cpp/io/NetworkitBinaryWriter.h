@@ -0,0 +1,40 @@
+/*
+ * NetworkitBinaryWriter.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef NETWORKITBINARYWRITER_H_
+#define NETWORKITBINARYWRITER_H_
+
+#include <fstream>
+#include <string>
+
+#include "GraphWriter.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ * Writes graphs in the NetworKit binary format (see NetworkitBinaryGraph.h), which can be
+ * loaded by NetworkitBinaryReader without any parsing. Edge weights and edge ids are stored
+ * if the graph has them.
+ */
+class NetworkitBinaryWriter: public NetworKit::GraphWriter {
+
+public:
+
+	NetworkitBinaryWriter() = default;
+
+	/**
+	 * Write @a G to the file at @a path.
+	 */
+	virtual void write(const Graph& G, const std::string& path) override;
+
+private:
+	template<bool incoming>
+	void writeAdjacency(std::ofstream& file, const Graph& G);
+};
+
+} /* namespace NetworKit */
+#endif /* NETWORKITBINARYWRITER_H_ */
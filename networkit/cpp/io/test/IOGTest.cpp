@@ -9,7 +9,9 @@
 
 #include "IOGTest.h"
 
+#include <cstddef>
 #include <fstream>
+#include <limits>
 #include <unordered_set>
 #include <vector>
 
@@ -32,6 +34,11 @@
 #include "../GMLGraphReader.h"
 #include "../GraphToolBinaryReader.h"
 #include "../GraphToolBinaryWriter.h"
+#include "../NetworkitBinaryReader.h"
+#include "../NetworkitBinaryWriter.h"
+#include "../NetworkitBinaryGraph.h"
+#include "../DistanceMatrixReader.h"
+#include "../DistanceMatrixWriter.h"
 #include "../../generators/ErdosRenyiGenerator.h"
 
 #include "../../community/GraphClusteringTools.h"
@@ -387,6 +394,69 @@ TEST_F(IOGTest, testEdgeListReader) {
 
 }
 
+TEST_F(IOGTest, testEdgeListReaderKeepsFirstOccurrence) {
+	std::string path = "output/duplicates.edgelist";
+	{
+		std::ofstream file(path);
+		file << "# comment\n";
+		for (index i = 0; i < 2000; ++i) {
+			node u = i % 100 + 1;
+			node v = (i * 7) % 100 + 1;
+			file << u << "\t" << v << "\t" << (i + 1) << "\n";
+			if (i % 10 == 0) {
+				file << "\n# empty lines and comments are skipped\n";
+			}
+		}
+	}
+
+	Graph reference(100, true, false);
+	Graph referenceDirected(100, true, true);
+	for (index i = 0; i < 2000; ++i) {
+		node u = i % 100;
+		node v = (i * 7) % 100;
+		if (!reference.hasEdge(u, v)) {
+			reference.addEdge(u, v, i + 1);
+		}
+		if (!referenceDirected.hasEdge(u, v)) {
+			referenceDirected.addEdge(u, v, i + 1);
+		}
+	}
+
+	EdgeListReader reader('\t', 1);
+	Graph G = reader.read(path);
+	EdgeListReader directedReader('\t', 1, "#", true, true);
+	Graph D = directedReader.read(path);
+
+	for (auto& pair : {std::make_pair(&reference, &G), std::make_pair(&referenceDirected, &D)}) {
+		const Graph& expected = *pair.first;
+		const Graph& actual = *pair.second;
+		EXPECT_TRUE(actual.isWeighted());
+		EXPECT_EQ(expected.isDirected(), actual.isDirected());
+		EXPECT_EQ(expected.numberOfNodes(), actual.numberOfNodes());
+		EXPECT_EQ(expected.numberOfEdges(), actual.numberOfEdges());
+		EXPECT_EQ(expected.numberOfSelfLoops(), actual.numberOfSelfLoops());
+		EXPECT_TRUE(actual.checkConsistency());
+		expected.forEdges([&](node u, node v, edgeweight ew) {
+			EXPECT_EQ(ew, actual.weight(u, v));
+		});
+	}
+}
+
+TEST_F(IOGTest, testEdgeListReaderMalformedLine) {
+	std::string path = "output/malformed.edgelist";
+	{
+		std::ofstream file(path);
+		file << "1 2\n2 3\n# comment\n3 4 5\n";
+	}
+	EdgeListReader reader(' ', 1);
+	try {
+		reader.read(path);
+		FAIL() << "expected a malformed line";
+	} catch (std::runtime_error& e) {
+		EXPECT_NE(std::string::npos, std::string(e.what()).find("malformed line 4"));
+	}
+}
+
 TEST_F(IOGTest, testEdgeListPartitionReader) {
 	EdgeListPartitionReader reader(1);
 
@@ -698,6 +768,126 @@ TEST_F(IOGTest, testGraphToolBinaryWriterDirected) {
 	EXPECT_EQ(G.isWeighted(),Gread.isWeighted());
 }
 
+TEST_F(IOGTest, testNetworkitBinaryRoundTrip) {
+	for (bool weighted : {false, true}) {
+		for (bool directed : {false, true}) {
+			Graph G(20, weighted, directed);
+			for (node u = 0; u < 20; ++u) {
+				for (node v : {(u * 7 + 3) % 20, (u + 1) % 20}) {
+					if (!G.hasEdge(u, v) && !G.hasEdge(v, u)) {
+						G.addEdge(u, v, 1.0 + u);
+					}
+				}
+			}
+			G.addEdge(4, 4, 2.5);
+			G.removeEdge(5, 6);
+			G.removeNode(11);
+			G.indexEdges();
+
+			NetworkitBinaryWriter writer;
+			NetworkitBinaryReader reader;
+			std::string path = "output/test.nkbg";
+			writer.write(G, path);
+			Graph Gread = reader.read(path);
+
+			EXPECT_EQ(G.isWeighted(), Gread.isWeighted());
+			EXPECT_EQ(G.isDirected(), Gread.isDirected());
+			EXPECT_TRUE(Gread.hasEdgeIds());
+			EXPECT_EQ(G.numberOfNodes(), Gread.numberOfNodes());
+			EXPECT_EQ(G.upperNodeIdBound(), Gread.upperNodeIdBound());
+			EXPECT_EQ(G.numberOfEdges(), Gread.numberOfEdges());
+			EXPECT_EQ(G.numberOfSelfLoops(), Gread.numberOfSelfLoops());
+			EXPECT_EQ(G.upperEdgeIdBound(), Gread.upperEdgeIdBound());
+			EXPECT_FALSE(Gread.hasNode(11));
+			EXPECT_TRUE(Gread.checkConsistency());
+
+			G.forNodes([&](node u) {
+				EXPECT_EQ(G.degreeOut(u), Gread.degreeOut(u));
+				EXPECT_EQ(G.degreeIn(u), Gread.degreeIn(u));
+			});
+			G.forEdges([&](node u, node v, edgeweight ew, edgeid eid) {
+				EXPECT_TRUE(Gread.hasEdge(u, v));
+				EXPECT_EQ(ew, Gread.weight(u, v));
+				EXPECT_EQ(eid, Gread.edgeId(u, v));
+			});
+			Gread.forInEdgesOf(7, [&](node u, node v, edgeweight ew) {
+				EXPECT_EQ(G.weight(v, u), ew);
+			});
+
+			// the graph read from the file must still be modifiable
+			Gread.addEdge(0, 10);
+			EXPECT_EQ(G.numberOfEdges() + 1, Gread.numberOfEdges());
+		}
+	}
+}
+
+TEST_F(IOGTest, testNetworkitBinaryReaderRejectsOtherFormats) {
+	NetworkitBinaryReader reader;
+	EXPECT_THROW(reader.read("input/power.gt"), std::runtime_error);
+
+	// a file with the right size but broken adjacency arrays
+	Graph G(3);
+	G.addEdge(0, 1);
+	G.addEdge(1, 2);
+	std::string path = "output/test.nkbg";
+	// the header is followed by the z + 1 offsets and the targets of the out-edges
+	const std::streamoff offsets = sizeof(NetworkitBinaryHeader);
+	const std::streamoff targets = offsets + 4 * sizeof(uint64_t);
+	// the deleted ids and the offsets both grow with the upper node id bound, so adding
+	// 2^63 to it leaves the expected size unchanged modulo 2^64
+	const std::streamoff upperNodeIdBound = offsetof(NetworkitBinaryHeader, upperNodeIdBound);
+	const uint64_t wrapped = 3 + (uint64_t(1) << 63);
+	for (auto broken : {std::make_pair(targets, uint64_t(99)), std::make_pair(offsets + static_cast<std::streamoff>(sizeof(uint64_t)), uint64_t(4)), std::make_pair(upperNodeIdBound, wrapped)}) {
+		NetworkitBinaryWriter().write(G, path);
+		{
+			std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+			file.seekp(broken.first);
+			file.write(reinterpret_cast<const char*>(&broken.second), sizeof(uint64_t));
+		}
+		EXPECT_THROW(reader.read(path), std::runtime_error);
+	}
+}
+
+TEST_F(IOGTest, testDistanceMatrixRoundTrip) {
+	const edgeweight infDist = std::numeric_limits<edgeweight>::max();
+	std::vector<edgeweight> distances = {0, 1, infDist, 2, 0, 3.5, 254, infDist, 0};
+	std::string path = "output/test.nkdm";
+
+	for (count bytes : {1, 2, 4, 8}) {
+		// the fractional distance only fits into floating point entries
+		distances[5] = bytes < 4 ? 3 : 3.5;
+		DistanceMatrixWriter writer(path, 3, 3, bytes);
+		// rows can be written in any order
+		writer.writeRows(2, 1, &distances[6]);
+		writer.writeRows(0, 2, &distances[0]);
+		writer.close();
+
+		DistanceMatrixReader reader(path);
+		EXPECT_EQ(3u, reader.numberOfRows());
+		EXPECT_EQ(3u, reader.numberOfColumns());
+		for (index u = 0; u < 3; ++u) {
+			std::vector<edgeweight> row = reader.getRow(u);
+			for (index v = 0; v < 3; ++v) {
+				EXPECT_EQ(distances[u * 3 + v], row[v]);
+				EXPECT_EQ(distances[u * 3 + v], reader.getDistance(u, v));
+			}
+		}
+		EXPECT_THROW(reader.getRow(3), std::runtime_error);
+	}
+
+	DistanceMatrixWriter writer(path, 1, 3, 1);
+	std::vector<edgeweight> tooLong = {0, 255, 1};
+	EXPECT_THROW(writer.writeRows(0, 1, tooLong.data()), std::runtime_error);
+	std::vector<edgeweight> fractional = {0, 0.5, 1};
+	EXPECT_THROW(writer.writeRows(0, 1, fractional.data()), std::runtime_error);
+	EXPECT_THROW(writer.writeRows(1, 1, distances.data()), std::runtime_error);
+	DistanceMatrixWriter floatWriter(path, 1, 3, 4);
+	std::vector<edgeweight> tooLarge = {0, 1e300, 1};
+	EXPECT_THROW(floatWriter.writeRows(0, 1, tooLarge.data()), std::runtime_error);
+
+	EXPECT_THROW(DistanceMatrixReader("input/power.gt"), std::runtime_error);
+}
+
 TEST_F(IOGTest, testGraphToolBinaryWriterWithDeletedNodesDirected) {
 	Graph G(10,false,true);
 	G.removeNode(0);
@@ -0,0 +1,93 @@
+/*
+ * SuitorMatcher.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include "SuitorMatcher.h"
+#include <omp.h>
+
+namespace NetworKit {
+
+SuitorMatcher::SuitorMatcher(const Graph& G): Matcher(G) {
+	if (G.isDirected()) throw std::runtime_error("Matcher only defined for undirected graphs");
+}
+
+SuitorMatcher::SuitorMatcher(const Graph& G, const std::vector<double>& edgeScores): Matcher(G, edgeScores) {
+	if (G.isDirected()) throw std::runtime_error("Matcher only defined for undirected graphs");
+}
+
+void SuitorMatcher::run() {
+	const count z = G.upperNodeIdBound();
+
+	// the best proposal every node has received so far
+	std::vector<node> suitor(z, none);
+	std::vector<edgeweight> suitorWeight(z, 0);
+	std::vector<omp_lock_t> locks(z);
+	#pragma omp parallel for
+	for (index u = 0; u < z; ++u) {
+		omp_init_lock(&locks[u]);
+	}
+
+	// a proposal of x with weight w is better than the one v holds, ties go to the larger id
+	auto beats = [&](edgeweight w, node x, node v) {
+		edgeweight current;
+		node holder;
+		#pragma omp atomic read
+		current = suitorWeight[v];
+		#pragma omp atomic read
+		holder = suitor[v];
+		return w > current || (w == current && holder != none && x > holder);
+	};
+
+	G.balancedParallelForNodes([&](node u) {
+		node current = u;
+		while (current != none) {
+			// heaviest neighbor that would accept current as its suitor
+			node partner = none;
+			edgeweight heaviest = 0;
+			G.forEdgesOf(current, [&](node, node v, edgeweight w, edgeid eid) {
+				if (v == current) return;
+				if (edgeScoresAsWeights) {
+					w = edgeScores[eid];
+				}
+				if ((w > heaviest || (w == heaviest && partner != none && v > partner)) && beats(w, current, v)) {
+					partner = v;
+					heaviest = w;
+				}
+			});
+			if (partner == none) {
+				break;
+			}
+
+			omp_set_lock(&locks[partner]);
+			if (beats(heaviest, current, partner)) {
+				// the displaced suitor has to look for another partner
+				node displaced = suitor[partner];
+				#pragma omp atomic write
+				suitor[partner] = current;
+				#pragma omp atomic write
+				suitorWeight[partner] = heaviest;
+				current = displaced;
+			}
+			omp_unset_lock(&locks[partner]);
+		}
+	});
+
+	#pragma omp parallel for
+	for (index u = 0; u < z; ++u) {
+		omp_destroy_lock(&locks[u]);
+	}
+
+	// nodes that are each other's suitors are matched
+	G.parallelForNodes([&](node u) {
+		node v = suitor[u];
+		if (v != none && u < v && suitor[v] == u) {
+			M.match(u, v);
+		}
+	});
+
+	hasRun = true;
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,47 @@
+/*
+ * SuitorMatcher.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef SUITORMATCHER_H_
+#define SUITORMATCHER_H_
+
+#include "Matcher.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup matching
+ * Parallel suitor algorithm for approximate maximum weight matching as described by
+ *   Manne and Halappanavar, http://dx.doi.org/10.1109/IPDPS.2014.54
+ *
+ * Every node proposes to its heaviest neighbor whose current suitor is lighter and
+ * displaces that suitor, which then proposes again. Ties are broken by node id.
+ * The resulting matching is the same as the one of the sequential greedy algorithm
+ * and therefore at least half as heavy as a maximum weight matching. All nodes
+ * propose in parallel, conflicting proposals are serialized by a lock per node.
+ *
+ * Only edges with positive weight (or score) are matched, self-loops are ignored.
+ */
+class SuitorMatcher: public NetworKit::Matcher {
+public:
+	/**
+	 * @param[in] G Undirected graph for which matching is computed.
+	 */
+	SuitorMatcher(const Graph& G);
+
+	/**
+	 * @param[in] G Undirected graph for which matching is computed.
+	 * @param[in] edgeScores Scores to be used instead of the edge weights.
+	 */
+	SuitorMatcher(const Graph& G, const std::vector<double>& edgeScores);
+
+	/**
+	 * Computes a 1/2-approximate maximum weight matching of the graph.
+	 */
+	virtual void run();
+};
+
+} /* namespace NetworKit */
+#endif /* SUITORMATCHER_H_ */
@@ -12,11 +12,15 @@
 #include "../Matching.h"
 #include "../PathGrowingMatcher.h"
 #include "../LocalMaxMatcher.h"
+#include "../SuitorMatcher.h"
 #include "../../graph/Graph.h"
 #include "../../io/DibapGraphReader.h"
 #include "../../io/METISGraphReader.h"
 #include "../../auxiliary/Random.h"
 
+#include <algorithm>
+#include <tuple>
+
 
 namespace NetworKit {
 
@@ -115,6 +119,77 @@ TEST_F(MatcherGTest, testPgaMatching) {
 #endif
 }
 
+TEST_F(MatcherGTest, testSuitorMatching) {
+	count n = 50;
+	Graph G(n);
+	G.forNodePairs([&](node u, node v){
+		G.addEdge(u,v);
+	});
+	SuitorMatcher suitorMatcher(G);
+	suitorMatcher.run();
+	Matching M = suitorMatcher.getMatching();
+	EXPECT_TRUE(M.isProper(G));
+	EXPECT_EQ(n / 2, M.size(G));
+
+	EXPECT_THROW(SuitorMatcher(Graph(2, false, true)), std::runtime_error);
+}
+
+TEST_F(MatcherGTest, testSuitorMatchingIsGreedy) {
+	Aux::Random::setSeed(42, false);
+	count n = 300;
+	Graph G(n, true);
+	G.forNodePairs([&](node u, node v){
+		if (Aux::Random::probability() < 0.05) {
+			G.addEdge(u, v, Aux::Random::real());
+		}
+	});
+	G.addEdge(7, 7, 10.0);
+
+	SuitorMatcher suitorMatcher(G);
+	suitorMatcher.run();
+	Matching M = suitorMatcher.getMatching();
+	EXPECT_TRUE(M.isProper(G));
+	EXPECT_FALSE(M.areMatched(7, 7));
+
+	// the weights are distinct, so the result is the matching of the sequential greedy algorithm
+	std::vector<std::tuple<edgeweight, node, node> > edges;
+	G.forEdges([&](node u, node v, edgeweight w) {
+		if (u != v) {
+			edges.emplace_back(w, u, v);
+		}
+	});
+	std::sort(edges.rbegin(), edges.rend());
+	Matching greedy(n);
+	for (auto& e : edges) {
+		node u = std::get<1>(e);
+		node v = std::get<2>(e);
+		if (!greedy.isMatched(u) && !greedy.isMatched(v)) {
+			greedy.match(u, v);
+		}
+	}
+	G.forNodes([&](node u) {
+		EXPECT_EQ(greedy.mate(u), M.mate(u));
+	});
+	EXPECT_DOUBLE_EQ(greedy.weight(G), M.weight(G));
+
+	// scores instead of weights
+	G.indexEdges();
+	std::vector<double> scores(G.upperEdgeIdBound());
+	G.forEdges([&](node u, node v, edgeid eid) {
+		scores[eid] = (u + v) % 7;
+	});
+	SuitorMatcher scoreMatcher(G, scores);
+	scoreMatcher.run();
+	Matching S = scoreMatcher.getMatching();
+	EXPECT_TRUE(S.isProper(G));
+	G.forEdges([&](node u, node v, edgeid eid) {
+		// every edge with a positive score is maximal, i.e. one endpoint is matched
+		if (u != v && scores[eid] > 0) {
+			EXPECT_TRUE(S.isMatched(u) || S.isMatched(v));
+		}
+	});
+}
+
 TEST_F(MatcherGTest, tryValidMatching) {
 	METISGraphReader reader;
 	Graph G = reader.read("coAuthorsDBLP.graph");
@@ -8,12 +8,15 @@
 #ifndef CONJUGATE_GRADIENT_H_
 #define CONJUGATE_GRADIENT_H_
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <utility>
 
 #include "LinearSolver.h"
 #include "../algebraic/Vector.h"
 #include "../algebraic/CSRMatrix.h"
+#include "../algebraic/DenseMatrix.h"
 
 namespace NetworKit {
 
@@ -50,7 +53,17 @@ public:
 	SolverStatus solve(const Vector& rhs, Vector& result, count maxConvergenceTime = 5 * 60 * 1000, count maxIterations = std::numeric_limits<count>::max());
 
 	/**
-	 * Solves the linear systems in parallel.
+	 * Solves the linear systems \f$Ax = b\f$ for all columns b of @a rhs at once. Every column has its own conjugate
+	 * gradient iteration, but the products with @a A are computed for all columns together, so the matrix is traversed
+	 * once per iteration instead of once per column. Columns that have converged are no longer updated. The columns of
+	 * @a result are used as initial values.
+	 * @return A @ref SolverStatus object for each column.
+	 */
+	std::vector<SolverStatus> solve(const DenseMatrix& rhs, DenseMatrix& result, count maxConvergenceTime = 5 * 60 * 1000, count maxIterations = std::numeric_limits<count>::max());
+
+	/**
+	 * Solves the linear systems in parallel. The systems are solved in blocks of at most maxBlockWidth right-hand
+	 * sides by the block solver.
 	 * @param rhs
 	 * @param results
 	 * @param maxConvergenceTime
@@ -62,6 +75,9 @@ private:
 	Matrix matrix;
 	Preconditioner precond;
 
+	// maximum number of right-hand sides that are solved together as one block
+	static constexpr count maxBlockWidth = 16;
+
 };
 
 template<class Matrix, class Preconditioner>
@@ -106,17 +122,127 @@ SolverStatus ConjugateGradient<Matrix, Preconditioner>::solve(const Vector& rhs,
 }
 
 template<class Matrix, class Preconditioner>
-void ConjugateGradient<Matrix, Preconditioner>::parallelSolve(const std::vector<Vector>& rhs, std::vector<Vector>& results, count maxConvergenceTime, count maxIterations) {
+std::vector<SolverStatus> ConjugateGradient<Matrix, Preconditioner>::solve(const DenseMatrix& rhs, DenseMatrix& result, count maxConvergenceTime, count maxIterations) {
+	assert(matrix.numberOfRows() == rhs.numberOfRows());
+	assert(rhs.numberOfRows() == result.numberOfRows() && rhs.numberOfColumns() == result.numberOfColumns());
+	const count n = rhs.numberOfRows();
+	const count k = rhs.numberOfColumns();
+
+	// Absolute residuals to achieve
+	std::vector<double> sqr_desired_residual = DenseMatrix::columnInnerProducts(rhs, rhs);
+	for (double& value : sqr_desired_residual) {
+		value *= this->tolerance * this->tolerance;
+	}
+
+	// The iteration of the single system, applied to every column that has not converged yet
+	DenseMatrix residual_dir = rhs - matrix*result;
+	DenseMatrix conjugate_dir = precond.rhs(residual_dir);
+	std::vector<double> sqr_residual = DenseMatrix::columnInnerProducts(residual_dir, residual_dir);
+	std::vector<double> sqr_residual_precond = DenseMatrix::columnInnerProducts(residual_dir, conjugate_dir);
+
+	std::vector<char> active(k);
+	bool anyActive = false;
+	for (index c = 0; c < k; ++c) {
+		active[c] = sqr_residual[c] > sqr_desired_residual[c];
+		anyActive = anyActive || active[c];
+	}
+
+	std::vector<count> niters(k, 0);
+	std::vector<double> step(k), beta(k);
+	DenseMatrix tmp, residual_precond;
+	while (anyActive) {
+		for (index c = 0; c < k; ++c) {
+			if (active[c]) niters[c]++;
+		}
+		if (*std::max_element(niters.begin(), niters.end()) > maxIterations) {
+			break;
+		}
+
+		tmp = matrix * conjugate_dir;
+		std::vector<double> curvature = DenseMatrix::columnInnerProducts(conjugate_dir, tmp);
+		for (index c = 0; c < k; ++c) {
+			step[c] = active[c] ? sqr_residual_precond[c] / curvature[c] : 0.0;
+		}
 #pragma omp parallel for
-	for (index i = 0; i < rhs.size(); ++i) {
-		this->solve(rhs[i], results[i], maxConvergenceTime, maxIterations);
+		for (index i = 0; i < n; ++i) {
+			double* x = result.rowData(i);
+			double* r = residual_dir.rowData(i);
+			const double* p = conjugate_dir.rowData(i);
+			const double* t = tmp.rowData(i);
+			for (index c = 0; c < k; ++c) {
+				if (!active[c]) continue;
+				x[c] += step[c] * p[c];
+				r[c] -= step[c] * t[c];
+			}
+		}
+		sqr_residual = DenseMatrix::columnInnerProducts(residual_dir, residual_dir);
+
+		residual_precond = precond.rhs(residual_dir);
+		std::vector<double> new_sqr_residual_precond = DenseMatrix::columnInnerProducts(residual_dir, residual_precond);
+		for (index c = 0; c < k; ++c) {
+			beta[c] = active[c] ? new_sqr_residual_precond[c] / sqr_residual_precond[c] : 0.0;
+		}
+#pragma omp parallel for
+		for (index i = 0; i < n; ++i) {
+			double* p = conjugate_dir.rowData(i);
+			const double* z = residual_precond.rowData(i);
+			for (index c = 0; c < k; ++c) {
+				if (!active[c]) continue;
+				p[c] = beta[c] * p[c] + z[c];
+			}
+		}
+
+		anyActive = false;
+		for (index c = 0; c < k; ++c) {
+			if (active[c]) {
+				sqr_residual_precond[c] = new_sqr_residual_precond[c];
+				active[c] = sqr_residual[c] > sqr_desired_residual[c];
+				anyActive = anyActive || active[c];
+			}
+		}
 	}
-}
 
+	std::vector<double> sqr_final_residual = DenseMatrix::columnInnerProducts(rhs - matrix*result, rhs - matrix*result);
+	std::vector<double> sqr_rhs = DenseMatrix::columnInnerProducts(rhs, rhs);
+	std::vector<SolverStatus> status(k);
+	for (index c = 0; c < k; ++c) {
+		status[c].numIters = niters[c];
+		status[c].residual = std::sqrt(sqr_final_residual[c]);
+		status[c].converged = status[c].residual / std::sqrt(sqr_rhs[c]) <= this->tolerance;
+	}
 
+	return status;
+}
 
+template<class Matrix, class Preconditioner>
+void ConjugateGradient<Matrix, Preconditioner>::parallelSolve(const std::vector<Vector>& rhs, std::vector<Vector>& results, count maxConvergenceTime, count maxIterations) {
+	assert(rhs.size() == results.size());
+	const count n = matrix.numberOfRows();
+	for (index begin = 0; begin < rhs.size(); begin += maxBlockWidth) {
+		const index end = std::min<index>(begin + maxBlockWidth, rhs.size());
+		DenseMatrix B(n, end - begin, 0.0);
+		DenseMatrix X(n, end - begin, 0.0);
+#pragma omp parallel for
+		for (index i = 0; i < n; ++i) {
+			double* b = B.rowData(i);
+			double* x = X.rowData(i);
+			for (index c = begin; c < end; ++c) {
+				b[c - begin] = rhs[c][i];
+				x[c - begin] = results[c][i];
+			}
+		}
 
+		solve(B, X, maxConvergenceTime, maxIterations);
 
+#pragma omp parallel for
+		for (index i = 0; i < n; ++i) {
+			const double* x = X.rowData(i);
+			for (index c = begin; c < end; ++c) {
+				results[c][i] = x[c - begin];
+			}
+		}
+	}
+}
 
 } /* namespace NetworKit */
 
@@ -10,11 +10,19 @@
 
 #include "Smoother.h"
 
+#include <algorithm>
+#include <cmath>
+#include <omp.h>
+
 namespace NetworKit {
 
 /**
  * @ingroup numerics
  * Implementation of the Gauss-Seidel smoother.
+ *
+ * Large systems are relaxed in parallel (hybrid Gauss-Seidel): the rows are split into one block per thread, each
+ * block is relaxed by Gauss-Seidel and uses the values of the previous sweep for the unknowns of the other blocks.
+ * Inside a parallel region, the smoother always works sequentially.
  */
 template<class Matrix>
 class GaussSeidelRelaxation : public Smoother<Matrix> {
@@ -22,6 +30,14 @@ class GaussSeidelRelaxation : public Smoother<Matrix> {
 private:
 	double tolerance;
 
+	// minimum number of rows of a block that is relaxed by one thread
+	static constexpr count minBlockSize = 2048;
+
+	/**
+	 * @return True if the relative residual of every column of @a X is below the tolerance.
+	 */
+	bool converged(const Matrix& A, const DenseMatrix& B, const DenseMatrix& X) const;
+
 public:
 	/**
 	 * Constructs a Gauss-Seidel smoother with the given @a tolerance (default: 1e-15).
@@ -51,6 +67,18 @@ public:
 	 */
 	Vector relax(const Matrix& A, const Vector& b, const count maxIterations = std::numeric_limits<count>::max()) const;
 
+	/**
+	 * Relaxes the systems A * X = B for all columns of @a B at once, starting with @a initialGuess. Every row of @a A is
+	 * traversed once per sweep for all columns. Stops after @a maxIterations sweeps or if the relative residual of
+	 * every column is below the tolerance specified in the constructor.
+	 * @param A The matrix.
+	 * @param B The right-hand sides, one per column.
+	 * @param initialGuess
+	 * @param maxIterations
+	 * @return The (approximate) solutions to the systems.
+	 */
+	DenseMatrix relax(const Matrix& A, const DenseMatrix& B, const DenseMatrix& initialGuess, const count maxIterations = std::numeric_limits<count>::max()) const;
+
 };
 
 template<class Matrix>
@@ -62,19 +90,38 @@ Vector GaussSeidelRelaxation<Matrix>::relax(const Matrix& A, const Vector& b, co
 
 	count dimension = A.numberOfColumns();
 	Vector diagonal = A.diagonal();
+	const count blocks = omp_in_parallel() ? 1 : std::max<count>(1, std::min<count>(omp_get_max_threads(), dimension / minBlockSize));
 
 	do {
 		x_old = x_new;
 
-		for (index i = 0; i < dimension; ++i) {
-			double sigma = 0.0;
-			A.forNonZeroElementsInRow(i, [&](index column, double value) {
-				if (column != i) {
-					sigma += value * x_new[column];
+		if (blocks == 1) {
+			for (index i = 0; i < dimension; ++i) {
+				double sigma = 0.0;
+				A.forNonZeroElementsInRow(i, [&](index column, double value) {
+					if (column != i) {
+						sigma += value * x_new[column];
+					}
+				});
+
+				x_new[i] = (b[i] - sigma) / diagonal[i];
+			}
+		} else {
+#pragma omp parallel for num_threads(blocks) schedule(static, 1)
+			for (index block = 0; block < blocks; ++block) {
+				const index begin = block * dimension / blocks;
+				const index end = (block + 1) * dimension / blocks;
+				for (index i = begin; i < end; ++i) {
+					double sigma = 0.0;
+					A.forNonZeroElementsInRow(i, [&](index column, double value) {
+						if (column != i) {
+							sigma += value * (column >= begin && column < end ? x_new[column] : x_old[column]);
+						}
+					});
+
+					x_new[i] = (b[i] - sigma) / diagonal[i];
 				}
-			});
-
-			x_new[i] = (b[i] - sigma) / diagonal[i];
+			}
 		}
 
 		iterations++;
@@ -89,6 +136,92 @@ Vector GaussSeidelRelaxation<Matrix>::relax(const Matrix& A, const Vector& b, co
 	return relax(A, b, x, maxIterations);
 }
 
+template<class Matrix>
+DenseMatrix GaussSeidelRelaxation<Matrix>::relax(const Matrix& A, const DenseMatrix& B, const DenseMatrix& initialGuess, const count maxIterations) const {
+	count iterations = 0;
+	DenseMatrix X_old = initialGuess;
+	DenseMatrix X_new = initialGuess;
+	if (maxIterations == 0) return initialGuess;
+
+	count dimension = A.numberOfColumns();
+	const count k = B.numberOfColumns();
+	Vector diagonal = A.diagonal();
+	const count blocks = omp_in_parallel() ? 1 : std::max<count>(1, std::min<count>(omp_get_max_threads(), dimension / minBlockSize));
+
+	do {
+		X_old = X_new;
+
+#pragma omp parallel for num_threads(blocks) schedule(static, 1) if(blocks > 1)
+		for (index block = 0; block < blocks; ++block) {
+			const index begin = block * dimension / blocks;
+			const index end = (block + 1) * dimension / blocks;
+			std::vector<double> sigma(k);
+			for (index i = begin; i < end; ++i) {
+				std::fill(sigma.begin(), sigma.end(), 0.0);
+				A.forNonZeroElementsInRow(i, [&](index column, double value) {
+					if (column != i) {
+						const double* x = column >= begin && column < end ? X_new.rowData(column) : X_old.rowData(column);
+						for (index c = 0; c < k; ++c) {
+							sigma[c] += value * x[c];
+						}
+					}
+				});
+
+				const double* b = B.rowData(i);
+				double* x = X_new.rowData(i);
+				for (index c = 0; c < k; ++c) {
+					x[c] = (b[c] - sigma[c]) / diagonal[i];
+				}
+			}
+		}
+
+		iterations++;
+	} while (iterations < maxIterations && !converged(A, B, X_new));
+
+	return X_new;
+}
+
+template<class Matrix>
+bool GaussSeidelRelaxation<Matrix>::converged(const Matrix& A, const DenseMatrix& B, const DenseMatrix& X) const {
+	const count k = B.numberOfColumns();
+	std::vector<double> sqrResidual(k, 0.0);
+	std::vector<double> sqrRhs(k, 0.0);
+#pragma omp parallel
+	{
+		std::vector<double> localResidual(k, 0.0);
+		std::vector<double> localRhs(k, 0.0);
+		std::vector<double> r(k);
+#pragma omp for
+		for (index i = 0; i < A.numberOfRows(); ++i) {
+			const double* b = B.rowData(i);
+			for (index c = 0; c < k; ++c) {
+				r[c] = -b[c];
+			}
+			A.forNonZeroElementsInRow(i, [&](index column, double value) {
+				const double* x = X.rowData(column);
+				for (index c = 0; c < k; ++c) {
+					r[c] += value * x[c];
+				}
+			});
+			for (index c = 0; c < k; ++c) {
+				localResidual[c] += r[c] * r[c];
+				localRhs[c] += b[c] * b[c];
+			}
+		}
+#pragma omp critical
+		for (index c = 0; c < k; ++c) {
+			sqrResidual[c] += localResidual[c];
+			sqrRhs[c] += localRhs[c];
+		}
+	}
+
+	for (index c = 0; c < k; ++c) {
+		if (std::sqrt(sqrResidual[c] / sqrRhs[c]) > tolerance) {
+			return false;
+		}
+	}
+	return true;
+}
 
 } /* namespace NetworKit */
 
@@ -64,6 +64,13 @@ constexpr count SETUP_MAX_AGGREGATION_STAGES = 2;
 
 constexpr count SETUP_RELAX_COARSEST_SWEEPS = 400;
 
+/**************************
+ * SOLVE                  *
+ **************************/
+
+// maximum number of right-hand sides that are solved together as one block
+constexpr count SOLVE_MAX_BLOCK_WIDTH = 16;
+
 }
 
 
@@ -46,6 +46,11 @@ private:
 
 	void initializeForOneComponent();
 
+	/**
+	 * Solves the systems for the columns of @a rhs with @a solver, @a results holds the initial guesses.
+	 */
+	std::vector<SolverStatus> solveBlock(SolverLamg<Matrix>& solver, const DenseMatrix& rhs, DenseMatrix& results, count maxConvergenceTime, count maxIterations);
+
 public:
 	/**
 	 * Construct a solver with the given @a tolerance. The relative residual ||Ax-b||/||b|| will be less than or equal to
@@ -83,10 +88,24 @@ public:
 	 */
 	SolverStatus solve(const Vector& rhs, Vector& result, count maxConvergenceTime = 5 * 60 * 1000, count maxIterations = std::numeric_limits<count>::max());
 
+	/**
+	 * Computes the @a results for the matrix currently setup and the right-hand sides given by the columns of @a rhs.
+	 * All systems are solved together by a block solver, so every cycle traverses the matrices of the hierarchy only
+	 * once for all right-hand sides. The columns of @a results are used as initial guesses.
+	 * @param rhs
+	 * @param results
+	 * @param maxConvergenceTime
+	 * @param maxIterations
+	 * @return A @ref SolverStatus object for each column.
+	 */
+	std::vector<SolverStatus> solve(const DenseMatrix& rhs, DenseMatrix& results, count maxConvergenceTime = 5 * 60 * 1000, count maxIterations = std::numeric_limits<count>::max());
+
 	/**
 	 * Compute the @a results for the matrix currently setup and the right-hand sides @a rhs.
 	 * The maximum spent time for each system can be specified by @a maxConvergenceTime and the maximum number of iterations can be set
 	 * by @a maxIterations.
+	 * The right-hand sides are split into blocks of at most SOLVE_MAX_BLOCK_WIDTH vectors, which are solved in parallel by
+	 * the block solver.
 	 * @param rhs
 	 * @param results
 	 * @param maxConvergenceTime
@@ -215,10 +234,57 @@ SolverStatus Lamg<Matrix>::solve(const Vector& rhs, Vector& result, count maxCon
 	return status;
 }
 
+template<class Matrix>
+std::vector<SolverStatus> Lamg<Matrix>::solve(const DenseMatrix& rhs, DenseMatrix& results, count maxConvergenceTime, count maxIterations) {
+	if (!validSetup || results.numberOfRows() != laplacianMatrix.numberOfColumns()
+			|| rhs.numberOfRows() != laplacianMatrix.numberOfRows() || rhs.numberOfColumns() != results.numberOfColumns()) {
+		throw std::runtime_error("No or wrong matrix is setup for given vectors.");
+	}
+
+	if (numComponents == 1) {
+		return solveBlock(compSolvers[0], rhs, results, maxConvergenceTime, maxIterations);
+	}
+
+	// solve the columns one after another on every component
+	std::vector<SolverStatus> status(rhs.numberOfColumns());
+	for (index c = 0; c < rhs.numberOfColumns(); ++c) {
+		Vector result = results.column(c);
+		status[c] = solve(rhs.column(c), result, maxConvergenceTime, maxIterations);
+		for (index i = 0; i < result.getDimension(); ++i) {
+			results.setValue(i, c, result[i]);
+		}
+	}
+	return status;
+}
+
+template<class Matrix>
+std::vector<SolverStatus> Lamg<Matrix>::solveBlock(SolverLamg<Matrix>& solver, const DenseMatrix& rhs, DenseMatrix& results, count maxConvergenceTime, count maxIterations) {
+	const count k = rhs.numberOfColumns();
+	DenseMatrix residual = laplacianMatrix * results - rhs;
+	std::vector<double> sqrRhs = DenseMatrix::columnInnerProducts(rhs, rhs);
+	std::vector<double> sqrResidual = DenseMatrix::columnInnerProducts(residual, residual);
+
+	std::vector<LAMGSolverStatus> stati(k);
+	for (index c = 0; c < k; ++c) {
+		stati[c].desiredResidualReduction = this->tolerance * std::sqrt(sqrRhs[c] / sqrResidual[c]);
+		stati[c].maxIters = maxIterations;
+		stati[c].maxConvergenceTime = maxConvergenceTime;
+	}
+	solver.solve(results, rhs, stati);
+
+	std::vector<SolverStatus> status(k);
+	for (index c = 0; c < k; ++c) {
+		status[c].residual = stati[c].residual;
+		status[c].numIters = stati[c].numIters;
+		status[c].converged = stati[c].converged;
+	}
+	return status;
+}
+
 template<class Matrix>
 void Lamg<Matrix>::parallelSolve(const std::vector<Vector>& rhs, std::vector<Vector>& results, count maxConvergenceTime, count maxIterations) {
+	assert(rhs.size() == results.size());
 	if (numComponents == 1) {
-		assert(rhs.size() == results.size());
 		const index numThreads = omp_get_max_threads();
 		if (compSolvers.size() != numThreads) {
 			compSolvers.clear();
@@ -228,20 +294,44 @@ void Lamg<Matrix>::parallelSolve(const std::vector<Vector>& rhs, std::vector<Vec
 			}
 		}
 
+		// as few blocks as possible, but at least one per thread
+		const count k = rhs.size();
+		const count n = laplacianMatrix.numberOfRows();
+		const count numBlocks = std::max((k + SOLVE_MAX_BLOCK_WIDTH - 1) / SOLVE_MAX_BLOCK_WIDTH, std::min<count>(numThreads, k));
+
 		bool nested = omp_get_nested();
 		if (nested) omp_set_nested(false);
 
-#pragma omp parallel for
-		for (index i = 0; i < rhs.size(); ++i) {
-			index threadId = omp_get_thread_num();
-			LAMGSolverStatus stat;
-			stat.desiredResidualReduction = this->tolerance * rhs[i].length() / (laplacianMatrix * results[i] - rhs[i]).length();
-			stat.maxIters = maxIterations;
-			stat.maxConvergenceTime = maxConvergenceTime;
-			compSolvers[threadId].solve(results[i], rhs[i], stat);
+#pragma omp parallel for schedule(dynamic) if(numBlocks > 1)
+		for (index block = 0; block < numBlocks; ++block) {
+			const index begin = block * k / numBlocks;
+			const index end = (block + 1) * k / numBlocks;
+			DenseMatrix B(n, end - begin, 0.0);
+			DenseMatrix X(n, end - begin, 0.0);
+			for (index i = 0; i < n; ++i) {
+				double* b = B.rowData(i);
+				double* x = X.rowData(i);
+				for (index c = begin; c < end; ++c) {
+					b[c - begin] = rhs[c][i];
+					x[c - begin] = results[c][i];
+				}
+			}
+
+			solveBlock(compSolvers[omp_get_thread_num()], B, X, maxConvergenceTime, maxIterations);
+
+			for (index i = 0; i < n; ++i) {
+				const double* x = X.rowData(i);
+				for (index c = begin; c < end; ++c) {
+					results[c][i] = x[c - begin];
+				}
+			}
 		}
 
 		if (nested) omp_set_nested(true);
+	} else {
+		for (index i = 0; i < rhs.size(); ++i) {
+			solve(rhs[i], results[i], maxConvergenceTime, maxIterations);
+		}
 	}
 }
 
@@ -9,6 +9,7 @@
 #define LEVEL_H_
 
 #include "../../../algebraic/CSRMatrix.h"
+#include "../../../algebraic/DenseMatrix.h"
 
 namespace NetworKit {
 
@@ -50,6 +51,18 @@ public:
 	virtual void interpolate(const Vector& xc, Vector& xf) const {}
 
 	virtual void interpolate(const Vector& xc, Vector& xf, const std::vector<Vector>& bStages) const {}
+
+	// the same operations on blocks of vectors, one vector per column
+
+	virtual void coarseType(const DenseMatrix& xf, DenseMatrix& xc) const {}
+
+	virtual void restrict(const DenseMatrix& bf, DenseMatrix& bc) const {}
+
+	virtual void restrict(const DenseMatrix& bf, DenseMatrix& bc, std::vector<DenseMatrix>& bStages) const {}
+
+	virtual void interpolate(const DenseMatrix& xc, DenseMatrix& xf) const {}
+
+	virtual void interpolate(const DenseMatrix& xc, DenseMatrix& xf, const std::vector<DenseMatrix>& bStages) const {}
 };
 
 
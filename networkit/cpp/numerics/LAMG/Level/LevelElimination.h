@@ -11,6 +11,8 @@
 #include "Level.h"
 #include "EliminationStage.h"
 
+#include <algorithm>
+
 namespace NetworKit {
 
 /**
@@ -23,6 +25,7 @@ private:
 	std::vector<index> cIndexFine;
 
 	void subVectorExtract(Vector& subVector, const Vector& vector, const std::vector<index>& elements) const;
+	void subBlockExtract(DenseMatrix& subBlock, const DenseMatrix& block, const std::vector<index>& elements) const;
 
 public:
 	LevelElimination(const Matrix& A, const std::vector<EliminationStage<Matrix>>& coarseningStages);
@@ -30,6 +33,10 @@ public:
 	void coarseType(const Vector& xf, Vector& xc) const;
 	void restrict(const Vector& bf, Vector& bc, std::vector<Vector>& bStages) const;
 	void interpolate(const Vector& xc, Vector& xf, const std::vector<Vector>& bStages) const;
+
+	void coarseType(const DenseMatrix& xf, DenseMatrix& xc) const;
+	void restrict(const DenseMatrix& bf, DenseMatrix& bc, std::vector<DenseMatrix>& bStages) const;
+	void interpolate(const DenseMatrix& xc, DenseMatrix& xf, const std::vector<DenseMatrix>& bStages) const;
 };
 
 template<class Matrix>
@@ -37,14 +44,12 @@ LevelElimination<Matrix>::LevelElimination(const Matrix& A, const std::vector<El
 	cIndexFine = std::vector<index>(this->A.numberOfRows());
 #pragma omp parallel for
 	for (index i = 0; i < cIndexFine.size(); ++i) {
-		cIndexFine[i] = i;
-	}
-
-	for (index k = coarseningStages.size(); k-- > 0;) {
-		for (index i = 0; i < cIndexFine.size(); ++i) {
-			assert(cIndexFine[i] < coarseningStages[k].getCSet().size());
-			cIndexFine[i] = coarseningStages[k].getCSet()[cIndexFine[i]];
+		index fineIndex = i;
+		for (index k = coarseningStages.size(); k-- > 0;) {
+			assert(fineIndex < coarseningStages[k].getCSet().size());
+			fineIndex = coarseningStages[k].getCSet()[fineIndex];
 		}
+		cIndexFine[i] = fineIndex;
 	}
 }
 
@@ -110,6 +115,62 @@ void LevelElimination<Matrix>::interpolate(const Vector& xc, Vector& xf, const s
 	}
 }
 
+template<class Matrix>
+void LevelElimination<Matrix>::coarseType(const DenseMatrix& xf, DenseMatrix& xc) const {
+	subBlockExtract(xc, xf, cIndexFine);
+}
+
+template<class Matrix>
+void LevelElimination<Matrix>::restrict(const DenseMatrix& bf, DenseMatrix& bc, std::vector<DenseMatrix>& bStages) const {
+	bStages.resize(coarseningStages.size() + 1);
+	bStages[0] = bf;
+	bc = bf;
+	index curStage = 0;
+	for (const EliminationStage<Matrix>& s : coarseningStages) {
+		DenseMatrix bCSet;
+		subBlockExtract(bCSet, bc, s.getCSet());
+
+		DenseMatrix bFSet;
+		subBlockExtract(bFSet, bc, s.getFSet());
+		bc = s.getR() * bFSet;
+		bc += bCSet;
+		bStages[curStage+1] = bc; // B = B.c + s.P^T * B.f
+
+		curStage++;
+	}
+}
+
+template<class Matrix>
+void LevelElimination<Matrix>::interpolate(const DenseMatrix& xc, DenseMatrix& xf, const std::vector<DenseMatrix>& bStages) const {
+	const count k = xc.numberOfColumns();
+	DenseMatrix currX = xc;
+	for (index stage = coarseningStages.size(); stage-- > 0;) {
+		const EliminationStage<Matrix>& s = coarseningStages[stage];
+		xf = DenseMatrix(s.getN(), k, 0.0);
+		DenseMatrix xFSet = s.getP() * currX;
+
+		const Vector &q = s.getQ();
+		const std::vector<index> &fSet = s.getFSet();
+#pragma omp parallel for
+		for (index i = 0; i < fSet.size(); ++i) { // X.f = s.P * X.c + s.q .* B.f
+			const double* b = bStages[stage].rowData(fSet[i]);
+			const double* x = xFSet.rowData(i);
+			double* out = xf.rowData(fSet[i]);
+			for (index c = 0; c < k; ++c) {
+				out[c] = x[c] + q[i] * b[c];
+			}
+		}
+
+		const std::vector<index> &cSet = s.getCSet();
+#pragma omp parallel for
+		for (index i = 0; i < cSet.size(); ++i) {
+			std::copy(currX.rowData(i), currX.rowData(i) + k, xf.rowData(cSet[i]));
+		}
+
+		currX = xf;
+	}
+}
+
 template<class Matrix>
 void LevelElimination<Matrix>::subVectorExtract(Vector& subVector, const Vector& vector, const std::vector<index>& elements) const {
 	subVector = Vector(elements.size());
@@ -119,6 +180,16 @@ void LevelElimination<Matrix>::subVectorExtract(Vector& subVector, const Vector&
 	}
 }
 
+template<class Matrix>
+void LevelElimination<Matrix>::subBlockExtract(DenseMatrix& subBlock, const DenseMatrix& block, const std::vector<index>& elements) const {
+	const count k = block.numberOfColumns();
+	subBlock = DenseMatrix(elements.size(), k, 0.0);
+#pragma omp parallel for
+	for (index i = 0; i < elements.size(); ++i) {
+		std::copy(block.rowData(elements[i]), block.rowData(elements[i]) + k, subBlock.rowData(i));
+	}
+}
+
 } /* namespace NetworKit */
 
 #endif /* LEVELELIMINATION_H_ */
@@ -11,6 +11,7 @@
 #include "LevelHierarchy.h"
 #include "../Smoother.h"
 #include "../../algebraic/CSRMatrix.h"
+#include "../../algebraic/SparseAccumulator.h"
 
 #include <limits>
 
@@ -39,9 +40,31 @@ private:
 	bool coarseningElimination(Matrix& matrix, LevelHierarchy<Matrix>& hierarchy) const;
 
 	/**
-	 * Scans the Laplacian matrix for nodes with a low degree (i.e. nodes with less than 5 neighbors). For each node
-	 * having low degree and independent from already found low degree nodes, @code{true} is stored in @a fNode. The
-	 * @a stage parameter specifies if we are in the first or subsequent stages during elimination.
+	 * Pseudo-random priority of node @a i, used to select independent low degree nodes in parallel.
+	 */
+	static inline uint64_t priority(index i) {
+		uint64_t x = i + 0x9E3779B97F4A7C15ULL;
+		x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+		return x ^ (x >> 31);
+	}
+
+	/**
+	 * Assembles a matrix with @a nRows rows and @a nCols columns in parallel. For every row i, @a rowEntries(i, spa)
+	 * scatters the entries of row i into the SparseAccumulator spa, entries in the same column are summed up.
+	 * @param nRows Number of rows.
+	 * @param nCols Number of columns.
+	 * @param rowEntries Function (index, SparseAccumulator&) -> void.
+	 * @return The assembled matrix with sorted rows.
+	 */
+	template<typename L>
+	Matrix assembleRows(count nRows, count nCols, L rowEntries) const;
+
+	/**
+	 * Scans the Laplacian matrix for nodes with a low degree (i.e. nodes with less than 5 neighbors). A maximal
+	 * independent set of the low degree nodes is computed in parallel rounds, in each round the nodes whose priority
+	 * is minimal among their undecided neighbors are selected. For each selected node, @code{true} is stored in
+	 * @a fNode. The @a stage parameter specifies if we are in the first or subsequent stages during elimination.
 	 * @param matrix Laplacian matrix.
 	 * @param fNode[out] For each node, @code{true} if the node is of low degree and @code{false} otherwise.
 	 * @param stage The stage of the elimination phase.
@@ -112,7 +135,9 @@ private:
 	void computeAffinityMatrix(const Matrix& matrix, const std::vector<Vector>& tVs, Matrix& affinityMatrix) const;
 
 	/**
-	 * Models one stage in the aggregation phase. New aggregates are labeled accordingly in @a status.
+	 * Models one stage in the aggregation phase. New aggregates are labeled accordingly in @a status. The undecided
+	 * nodes of a bin choose their seeds in parallel; a choice is only carried out if the chosen node does not join
+	 * an aggregate itself in the same round, the other nodes choose again in the next round.
 	 * @param matrix Laplacian matrix.
 	 * @param nc Number of coarse nodes.
 	 * @param strongAdjMatrix Strong adjacency matrix.
@@ -294,10 +319,23 @@ bool MultiLevelSetup<Matrix>::coarseningElimination(Matrix& matrix, LevelHierarc
 		eliminationOperators(matrix, fSet, coarseIndex, P, q);
 		coarseningStages.push_back(EliminationStage<Matrix>(P, q, fSet, cSet));
 
-		Matrix Acc = matrix.extract(cSet, cSet); // Schur complement
-		Matrix Acf = matrix.extract(cSet, fSet); // Schur complement
+		std::vector<bool> inFSet(matrix.numberOfRows(), false);
+		for (index k = 0; k < nf; ++k) {
+			inFSet[fSet[k]] = true;
+		}
 
-		matrix = Acc + Acf * P;
+		// Schur complement Acc + Acf * P
+		matrix = assembleRows(nc, nc, [&](index i, SparseAccumulator& spa) {
+			matrix.forNonZeroElementsInRow(cSet[i], [&](index j, double value) {
+				if (inFSet[j]) {
+					P.forNonZeroElementsInRow(coarseIndex[j], [&](index l, double p) {
+						spa.scatter(value * p, l);
+					});
+				} else {
+					spa.scatter(value, coarseIndex[j]);
+				}
+			});
+		});
 		stageNum++;
 	}
 
@@ -311,45 +349,103 @@ bool MultiLevelSetup<Matrix>::coarseningElimination(Matrix& matrix, LevelHierarc
 
 template<class Matrix>
 count MultiLevelSetup<Matrix>::lowDegreeSweep(const Matrix& matrix, std::vector<bool>& fNode, index stage) const {
-	fNode.resize(matrix.numberOfRows(), true); // first mark all nodes as f nodes
-	count numFNodes = 0;
+	const count n = matrix.numberOfRows();
+	const char undecided = 0, fState = 1, cState = 2;
 	int degreeOffset = stage != 0;
 
-	for (index i = 0; i < matrix.numberOfRows(); ++i) {
-		if ((int) matrix.nnzInRow(i) - degreeOffset <= (int)SETUP_ELIMINATION_MAX_DEGREE && fNode[i]) { // node i has degree <= 4 and can be eliminated
-			numFNodes++;
-			matrix.forNonZeroElementsInRow(i, [&](index j, edgeweight w){ // to maintain independence, mark all neighbors as not eliminated
-				if (j != i)	{ // all neighbors of this f node are c nodes
-					fNode[j] = false;
+	// nodes with high degree are c nodes
+	std::vector<char> state(n);
+#pragma omp parallel for
+	for (index i = 0; i < n; ++i) {
+		state[i] = (int) matrix.nnzInRow(i) - degreeOffset <= (int) SETUP_ELIMINATION_MAX_DEGREE ? undecided : cState;
+	}
+
+	count numFNodes = 0;
+	std::vector<char> selected(n, 0);
+	bool done = false;
+	while (!done) {
+		// select the undecided nodes that precede all their undecided neighbors
+#pragma omp parallel for schedule(guided)
+		for (index i = 0; i < n; ++i) {
+			bool first = state[i] == undecided;
+			if (first) {
+				const uint64_t pi = priority(i);
+				matrix.forNonZeroElementsInRow(i, [&](index j, double) {
+					if (j != i && state[j] == undecided) {
+						const uint64_t pj = priority(j);
+						if (pj < pi || (pj == pi && j < i)) {
+							first = false;
+						}
+					}
+				});
+			}
+			selected[i] = first;
+		}
+
+		// selected nodes become f nodes, to maintain independence all their neighbors become c nodes
+		done = true;
+#pragma omp parallel for schedule(guided) reduction(+:numFNodes) reduction(&&:done)
+		for (index i = 0; i < n; ++i) {
+			if (state[i] != undecided) continue;
+			if (selected[i]) {
+				state[i] = fState;
+				numFNodes++;
+			} else {
+				bool neighborSelected = false;
+				matrix.forNonZeroElementsInRow(i, [&](index j, double) {
+					neighborSelected = neighborSelected || (j != i && selected[j]);
+				});
+				if (neighborSelected) {
+					state[i] = cState;
+				} else {
+					done = false;
 				}
-			});
-		} else { // node has high degree, thus it is a c node
-			fNode[i] = false;
+			}
 		}
 	}
 
+	fNode.resize(n);
+	for (index i = 0; i < n; ++i) {
+		fNode[i] = state[i] == fState;
+	}
+
 	return numFNodes;
 }
 
 template<class Matrix>
 void MultiLevelSetup<Matrix>::eliminationOperators(const Matrix& matrix, const std::vector<index>& fSet, const std::vector<index>& coarseIndex, Matrix& P, Vector& q) const {
-	std::vector<Triplet> triples;
 	q = Vector(fSet.size());
-	for (index k = 0; k < fSet.size(); ++k) { // Afc
+	std::vector<index> rowIdx(fSet.size() + 1, 0);
+#pragma omp parallel for
+	for (index k = 0; k < fSet.size(); ++k) {
 		matrix.forNonZeroElementsInRow(fSet[k], [&](index j, edgeweight w){
 			if (fSet[k] == j) {
 				q[k] = 1.0 / w;
 			} else {
-				triples.push_back({k, coarseIndex[j], w});
+				++rowIdx[k+1];
 			}
 		});
 	}
 
-	for (index i = 0; i < triples.size(); ++i) { // * -Aff^-1
-		triples[i].value *= -q[triples[i].row];
+	for (index k = 0; k < fSet.size(); ++k) {
+		rowIdx[k+1] += rowIdx[k];
 	}
 
-	P = Matrix(fSet.size(), coarseIndex.size() - fSet.size(), triples);
+	std::vector<index> columnIdx(rowIdx[fSet.size()]);
+	std::vector<double> nonZeros(rowIdx[fSet.size()]);
+#pragma omp parallel for
+	for (index k = 0; k < fSet.size(); ++k) { // Afc * -Aff^-1
+		index cIdx = rowIdx[k];
+		matrix.forNonZeroElementsInRow(fSet[k], [&](index j, edgeweight w){
+			if (fSet[k] != j) {
+				columnIdx[cIdx] = coarseIndex[j];
+				nonZeros[cIdx] = -w * q[k];
+				++cIdx;
+			}
+		});
+	}
+
+	P = Matrix(fSet.size(), coarseIndex.size() - fSet.size(), rowIdx, columnIdx, nonZeros, 0.0, matrix.sorted());
 }
 
 
@@ -408,41 +504,54 @@ void MultiLevelSetup<Matrix>::coarseningAggregation(Matrix& matrix, LevelHierarc
 		}
 	}
 
-	for (index i = 0; i < matrix.numberOfRows(); ++i) {
-		if (S[bestAggregate][i] == UNDECIDED) { // undediced nodes become their own seeds
-			S[bestAggregate][i] = i;
+	const count n = matrix.numberOfRows();
+	std::vector<index>& seeds = S[bestAggregate];
+#pragma omp parallel for
+	for (index i = 0; i < n; ++i) {
+		if (seeds[i] == UNDECIDED) { // undediced nodes become their own seeds
+			seeds[i] = i;
 		}
 	}
 
-	std::vector<index> indexFine(matrix.numberOfRows(), 0);
+	std::vector<index> indexFine(n, 0);
 	index newIndex = 0;
-	for (index i = 0; i < matrix.numberOfRows(); ++i) {
-		if (S[bestAggregate][i] == i) {
+	for (index i = 0; i < n; ++i) {
+		if (seeds[i] == i) {
 			indexFine[i] = newIndex++;
 		}
 	}
 
-	for (index i = 0; i < matrix.numberOfRows(); ++i) {
-		status[i] = indexFine[S[bestAggregate][i]];
+#pragma omp parallel for
+	for (index i = 0; i < n; ++i) {
+		status[i] = indexFine[seeds[i]];
 	}
 
 	assert(newIndex == nc[bestAggregate]);
 
-	// create interpolation matrix
-	std::vector<Triplet> pTriples(matrix.numberOfRows());
-	std::vector<Triplet> rTriples(matrix.numberOfRows());
-	std::vector<index> PColIndex(matrix.numberOfRows());
+	// create interpolation matrix P with a single one in each row and the restriction matrix R = P^T
+	std::vector<index> PColIndex(status.begin(), status.end());
 	std::vector<std::vector<index>> PRowIndex(nc[bestAggregate]);
-
-	for (index i = 0; i < matrix.numberOfRows(); ++i) {
-		pTriples[i] = {i, status[i], 1};
-		rTriples[i] = {status[i], i, 1};
-		PColIndex[i] = status[i];
+	for (index i = 0; i < n; ++i) {
 		PRowIndex[status[i]].push_back(i);
 	}
 
-	Matrix P(matrix.numberOfRows(), nc[bestAggregate], pTriples);
-	Matrix R(nc[bestAggregate], matrix.numberOfRows(), rTriples);
+	std::vector<index> pRowIdx(n + 1);
+	std::vector<index> rRowIdx(nc[bestAggregate] + 1, 0);
+	std::vector<index> rColumnIdx(n);
+#pragma omp parallel for
+	for (index i = 0; i <= n; ++i) {
+		pRowIdx[i] = i;
+	}
+	for (index i = 0; i < nc[bestAggregate]; ++i) {
+		rRowIdx[i+1] = rRowIdx[i] + PRowIndex[i].size();
+	}
+#pragma omp parallel for
+	for (index i = 0; i < nc[bestAggregate]; ++i) {
+		std::copy(PRowIndex[i].begin(), PRowIndex[i].end(), rColumnIdx.begin() + rRowIdx[i]);
+	}
+
+	Matrix P(n, nc[bestAggregate], pRowIdx, PColIndex, std::vector<double>(n, 1.0), 0.0, true);
+	Matrix R(nc[bestAggregate], n, rRowIdx, rColumnIdx, std::vector<double>(n, 1.0), 0.0, true);
 
 	// create coarsened laplacian
 	galerkinOperator(P, matrix, PColIndex, PRowIndex, matrix);
@@ -500,14 +609,20 @@ void MultiLevelSetup<Matrix>::addHighDegreeSeedNodes(const Matrix& matrix, std::
 
 template<class Matrix>
 void MultiLevelSetup<Matrix>::aggregateLooseNodes(const Matrix& strongAdjMatrix, std::vector<index>& status, count& nc) const {
-	std::vector<index> looseNodes;
+	std::vector<char> loose(strongAdjMatrix.numberOfRows(), false);
+#pragma omp parallel for
 	for (index i = 0; i < strongAdjMatrix.numberOfRows(); ++i) {
 		double max = std::numeric_limits<double>::min();
 		strongAdjMatrix.forNonZeroElementsInRow(i, [&](index j, double value) {
 			if (value > max) max = value;
 		});
 
-		if (std::abs(max) < 1e-9 || max == std::numeric_limits<double>::min()) {
+		loose[i] = std::abs(max) < 1e-9 || max == std::numeric_limits<double>::min();
+	}
+
+	std::vector<index> looseNodes;
+	for (index i = 0; i < strongAdjMatrix.numberOfRows(); ++i) {
+		if (loose[i]) {
 			looseNodes.push_back(i);
 		}
 	}
@@ -549,20 +664,22 @@ void MultiLevelSetup<Matrix>::computeStrongAdjacencyMatrix(const Matrix& matrix,
 	}
 
 	count nnz = rowIdx[matrix.numberOfRows()];
-	std::vector<Triplet> triplets(nnz);
+	std::vector<index> columnIdx(nnz);
+	std::vector<double> nonZeros(nnz);
 
 #pragma omp parallel for
 	for (index i = 0; i < matrix.numberOfRows(); ++i) {
 		index cIdx = rowIdx[i];
 		matrix.forNonZeroElementsInRow(i, [&](index j, double value) {
 			if (i != j && std::abs(value) >= 0.1 * std::min(maxNeighbor[i], maxNeighbor[j])) {
-				triplets[cIdx] = {i,j,-value};
+				columnIdx[cIdx] = j;
+				nonZeros[cIdx] = -value;
 				++cIdx;
 			}
 		});
 	}
 
-	strongAdjMatrix = Matrix(matrix.numberOfRows(), matrix.numberOfColumns(), triplets);
+	strongAdjMatrix = Matrix(matrix.numberOfRows(), matrix.numberOfColumns(), rowIdx, columnIdx, nonZeros, 0.0, matrix.sorted());
 }
 
 
@@ -571,7 +688,8 @@ void MultiLevelSetup<Matrix>::computeAffinityMatrix(const Matrix& matrix, const
 	assert(tVs.size() > 0);
 
 	std::vector<index> rowIdx(matrix.numberOfRows()+1);
-	std::vector<Triplet> triplets(matrix.nnz());
+	std::vector<index> columnIdx(matrix.nnz());
+	std::vector<double> nonZeros(matrix.nnz());
 
 #pragma omp parallel for
 	for (index i = 0; i < matrix.numberOfRows(); ++i) {
@@ -600,13 +718,13 @@ void MultiLevelSetup<Matrix>::computeAffinityMatrix(const Matrix& matrix, const
 				ij += tVs[k][i] * tVs[k][j];
 			}
 
-			double value = (ij * ij) * nir / normSquared[j];
-			triplets[cIdx] = {i,j,value};
+			columnIdx[cIdx] = j;
+			nonZeros[cIdx] = (ij * ij) * nir / normSquared[j];
 			++cIdx;
 		});
 	}
 
-	affinityMatrix = Matrix(matrix.numberOfRows(), matrix.numberOfColumns(), triplets);
+	affinityMatrix = Matrix(matrix.numberOfRows(), matrix.numberOfColumns(), rowIdx, columnIdx, nonZeros, 0.0, matrix.sorted());
 }
 
 template<class Matrix>
@@ -620,20 +738,80 @@ void MultiLevelSetup<Matrix>::aggregationStage(const Matrix& matrix, count& nc,
 		diag[i] = matrix(i,i);
 	}
 
+	auto join = [&](index i, index s) {
+		status[i] = s; // i's seed is s
+		for (index j = 0; j < tVs.size(); ++j) { // update test vectors
+			tVs[j][i] = tVs[j][s];
+		}
+	};
+
+	// the node with the lowest priority in a chain of choices always wins, so every round makes progress
+	auto precedes = [&](index i, index j) {
+		return priority(i) < priority(j) || (priority(i) == priority(j) && i < j);
+	};
+
+	std::vector<index> choice(matrix.numberOfRows(), UNDECIDED); // seed chosen in the current round
+	std::vector<char> blocked(matrix.numberOfRows(), false);
 	for (index k = bins.size(); k-- > 0;) { // iterate over undecided nodes with strong neighbors in decreasing order of strongest neighbor
+		std::vector<index> pending;
 		for (index i : bins[k]) {
 			if (status[i] == UNDECIDED) { // node is still undecided
+				pending.push_back(i);
+			}
+		}
+
+		while (!pending.empty()) {
+#pragma omp parallel for schedule(guided)
+			for (index p = 0; p < pending.size(); ++p) {
 				index s = 0;
-				if (findBestSeedEnergyCorrected(strongAdjMatrix, affinityMatrix, diag, tVs, status, i, s)) {
-					status[s] = s; // s becomes seed
-					status[i] = s; // i's seed is s
-					nc--;
+				if (findBestSeedEnergyCorrected(strongAdjMatrix, affinityMatrix, diag, tVs, status, pending[p], s)) {
+					choice[pending[p]] = s;
+				}
+			}
 
-					for (index j = 0; j < tVs.size(); ++j) { // update test vectors
-						tVs[j][i] = tVs[j][s];
-					}
+			// i wins against its choice s if s is a seed, does not choose another node or has a lower priority than i,
+			// a node that is chosen by a winning node becomes a seed and does not join
+			std::vector<char> accepted(pending.size());
+#pragma omp parallel for
+			for (index p = 0; p < pending.size(); ++p) {
+				const index i = pending[p];
+				const index s = choice[i];
+				accepted[p] = s != UNDECIDED && (status[s] == s || choice[s] == UNDECIDED || precedes(i, s));
+				if (accepted[p] && choice[s] != UNDECIDED) {
+#pragma omp atomic write
+					blocked[s] = true;
 				}
 			}
+			count joined = 0;
+#pragma omp parallel for reduction(+:joined)
+			for (index p = 0; p < pending.size(); ++p) {
+				accepted[p] = accepted[p] && !blocked[pending[p]];
+				joined += accepted[p];
+			}
+
+			for (index p = 0; p < pending.size(); ++p) {
+				if (accepted[p]) {
+					status[choice[pending[p]]] = choice[pending[p]]; // s becomes seed
+				}
+			}
+#pragma omp parallel for
+			for (index p = 0; p < pending.size(); ++p) {
+				if (accepted[p]) {
+					join(pending[p], choice[pending[p]]);
+				}
+			}
+			nc -= joined;
+
+			// rejected nodes that are still undecided choose again
+			std::vector<index> rejected;
+			for (index i : pending) {
+				if (choice[i] != UNDECIDED && status[i] == UNDECIDED) {
+					rejected.push_back(i);
+				}
+				choice[i] = UNDECIDED;
+				blocked[i] = false;
+			}
+			pending.swap(rejected);
 		}
 
 		if (nc <= matrix.numberOfRows() * SETUP_COARSENING_WORK_GUARD / SETUP_CYCLE_INDEX) {
@@ -644,7 +822,7 @@ void MultiLevelSetup<Matrix>::aggregationStage(const Matrix& matrix, count& nc,
 
 template<class Matrix>
 void MultiLevelSetup<Matrix>::computeStrongNeighbors(const Matrix& affinityMatrix, const std::vector<index>& status, std::vector<std::vector<index>>& bins) const {
-	std::vector<bool> undecided(affinityMatrix.numberOfRows(), false);
+	std::vector<char> undecided(affinityMatrix.numberOfRows(), false);
 	std::vector<double> maxNeighbor(affinityMatrix.numberOfRows(), std::numeric_limits<double>::min());
 	double overallMax = 0.0;
 	double overallMin = std::numeric_limits<double>::max();
@@ -658,6 +836,7 @@ void MultiLevelSetup<Matrix>::computeStrongNeighbors(const Matrix& affinityMatri
 		}
 	});
 
+#pragma omp parallel for reduction(max:overallMax) reduction(min:overallMin)
 	for (index i = 0; i < affinityMatrix.numberOfRows(); ++i) {
 		if (maxNeighbor[i] > overallMax) {
 			overallMax = maxNeighbor[i];
@@ -759,9 +938,7 @@ bool MultiLevelSetup<Matrix>::isRelaxationFast(const Matrix& A, index lvlIndex,
 
 template<class Matrix>
 void MultiLevelSetup<Matrix>::galerkinOperator(const Matrix& P, const Matrix& A, const std::vector<index>& PColIndex, const std::vector<std::vector<index>>& PRowIndex, Matrix& B) const {
-	std::vector<Triplet> triplets;
-	SparseAccumulator spa(P.numberOfColumns());
-	for (index i = 0; i < P.numberOfColumns(); ++i) {
+	B = assembleRows(P.numberOfColumns(), P.numberOfColumns(), [&](index i, SparseAccumulator& spa) {
 		for (index k : PRowIndex[i]) {
 			double Pki = P(k,i);
 			A.forNonZeroElementsInRow(k, [&](index l, double value) {
@@ -769,15 +946,53 @@ void MultiLevelSetup<Matrix>::galerkinOperator(const Matrix& P, const Matrix& A,
 				spa.scatter(Pki * value * P(l, j), j);
 			});
 		}
+	});
+}
 
-		spa.gather([&](index i, index j, double value) {
-			triplets.push_back({i,j,value});
-		});
+template<class Matrix>
+template<typename L>
+Matrix MultiLevelSetup<Matrix>::assembleRows(count nRows, count nCols, L rowEntries) const {
+	std::vector<index> rowIdx(nRows + 1, 0);
+	std::vector<index> columnIdx;
+	std::vector<double> nonZeros;
+
+#pragma omp parallel
+	{
+		SparseAccumulator spa(nCols);
+		std::vector<index> localColumns;
+		std::vector<double> localValues;
+
+		// both loops assign the same block of rows to each thread
+#pragma omp for schedule(static)
+		for (index i = 0; i < nRows; ++i) {
+			rowEntries(i, spa);
+			rowIdx[i+1] = spa.gather([&](index, index j, double value) {
+				localColumns.push_back(j);
+				localValues.push_back(value);
+			});
+			spa.increaseRow();
+		}
 
-		spa.increaseRow();
+#pragma omp single
+		{
+			for (index i = 0; i < nRows; ++i) {
+				rowIdx[i+1] += rowIdx[i];
+			}
+			columnIdx.resize(rowIdx[nRows]);
+			nonZeros.resize(rowIdx[nRows]);
+		}
+
+		index k = 0;
+#pragma omp for schedule(static)
+		for (index i = 0; i < nRows; ++i) {
+			for (index pos = rowIdx[i]; pos < rowIdx[i+1]; ++pos, ++k) {
+				columnIdx[pos] = localColumns[k];
+				nonZeros[pos] = localValues[k];
+			}
+		}
 	}
 
-	B = CSRMatrix(P.numberOfColumns(), P.numberOfColumns(), triplets);
+	return Matrix(nRows, nCols, rowIdx, columnIdx, nonZeros, 0.0, true);
 }
 
 } /* namespace NetworKit */
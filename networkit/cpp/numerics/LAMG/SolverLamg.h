@@ -12,6 +12,8 @@
 #include "../Smoother.h"
 #include "../../algebraic/DenseMatrix.h"
 
+#include <algorithm>
+
 namespace NetworKit {
 
 /**
@@ -58,6 +60,19 @@ private:
 	void clearHistory(index level);
 	void minRes(index level, Vector& x, const Vector& r);
 
+	// data structures for iterate recombination and elimination levels of the block solver
+	std::vector<std::vector<DenseMatrix>> blockHistory;
+	std::vector<std::vector<DenseMatrix>> blockRHistory;
+	std::vector<std::vector<DenseMatrix>> blockBStages;
+
+	void solveCycle(DenseMatrix& X, const DenseMatrix& B, int finest, std::vector<LAMGSolverStatus>& status);
+	void cycle(DenseMatrix& X, const DenseMatrix& B, int finest, int coarsest, std::vector<count>& numVisits, std::vector<DenseMatrix>& Xs, std::vector<DenseMatrix>& Bs, const LAMGSolverStatus& status);
+	void saveIterate(index level, const DenseMatrix& X, const DenseMatrix& R);
+	void minRes(index level, DenseMatrix& X, const DenseMatrix& R);
+
+	static std::vector<double> columnLengths(const DenseMatrix& block);
+	static DenseMatrix selectColumns(const DenseMatrix& block, const std::vector<index>& columns);
+
 public:
 	/**
 	 * Constructs a new solver instance for the specified @a hierarchy. The @a smoother will be used for relaxing and
@@ -86,6 +101,16 @@ public:
 	 * @param status Reference to an LAMGSolverStatus.
 	 */
 	void solve(Vector& x, const Vector& b, LAMGSolverStatus& status);
+
+	/**
+	 * Solves the systems A*X = B for all columns of @a B at once. The solver runs the cycles on the whole block of
+	 * vectors, so the matrices of the hierarchy are traversed once per cycle for all columns. Columns that have
+	 * converged are removed from the block. Parameters and additional output of column j are stored in @a status[j].
+	 * @param X[out] Reference to the initial guesses to the solutions and the approximations after the solver finished.
+	 * @param B The right-hand sides, one per column.
+	 * @param status Reference to one LAMGSolverStatus for each column.
+	 */
+	void solve(DenseMatrix& X, const DenseMatrix& B, std::vector<LAMGSolverStatus>& status);
 };
 
 template<class Matrix>
@@ -350,6 +375,357 @@ void SolverLamg<Matrix>::minRes(index level, Vector& x, const Vector& r) {
 
 }
 
+template<class Matrix>
+void SolverLamg<Matrix>::solve(DenseMatrix& X, const DenseMatrix& B, std::vector<LAMGSolverStatus>& status) {
+	assert(status.size() == B.numberOfColumns());
+	blockBStages = std::vector<std::vector<DenseMatrix>>(hierarchy.size(), std::vector<DenseMatrix>());
+	if (hierarchy.size() >= 2) {
+		DenseMatrix Bc = B;
+		DenseMatrix Xc = X;
+		int finest = 0;
+
+		if (hierarchy.getType(1) == ELIMINATION) {
+			hierarchy.at(1).restrict(B, Bc, blockBStages[1]);
+			if (hierarchy.at(1).getLaplacian().numberOfRows() == 1) {
+				X = DenseMatrix(X.numberOfRows(), X.numberOfColumns(), 0.0);
+				return;
+			} else {
+				hierarchy.at(1).coarseType(X, Xc);
+				finest = 1;
+			}
+		}
+		solveCycle(Xc, Bc, finest, status);
+
+		if (finest == 1) { // interpolate from finest == ELIMINATION level back to actual finest level
+			hierarchy.at(1).interpolate(Xc, X, blockBStages[1]);
+		} else {
+			X = Xc;
+		}
+	} else {
+		solveCycle(X, B, 0, status);
+	}
+
+	std::vector<double> residual = columnLengths(B - hierarchy.at(0).getLaplacian() * X);
+	for (index c = 0; c < status.size(); ++c) {
+		status[c].residual = residual[c];
+	}
+}
+
+template<class Matrix>
+void SolverLamg<Matrix>::solveCycle(DenseMatrix& X, const DenseMatrix& B, int finest, std::vector<LAMGSolverStatus>& status) {
+	Aux::Timer timer;
+	timer.start();
+
+	// data structures for iterate recombination
+	blockHistory = std::vector<std::vector<DenseMatrix>>(hierarchy.size(), std::vector<DenseMatrix>(MAX_COMBINED_ITERATES));
+	blockRHistory = std::vector<std::vector<DenseMatrix>>(hierarchy.size(), std::vector<DenseMatrix>(MAX_COMBINED_ITERATES));
+	latestIterate = std::vector<index>(hierarchy.size(), 0);
+	numActiveIterates = std::vector<count>(hierarchy.size(), 0);
+	int coarsest = hierarchy.size() - 1;
+	std::vector<count> numVisits(coarsest);
+	std::vector<DenseMatrix> Xs(hierarchy.size());
+	std::vector<DenseMatrix> Bs(hierarchy.size());
+
+	const Matrix& A = hierarchy.at(finest).getLaplacian();
+	const count k = B.numberOfColumns();
+	std::vector<double> residual = columnLengths(B - A * X);
+	std::vector<double> finalResidual(k);
+	std::vector<double> bestResidual(k, std::numeric_limits<double>::max());
+	std::vector<count> noResReduction(k, 0);
+	for (index c = 0; c < k; ++c) {
+		finalResidual[c] = residual[c] * status[c].desiredResidualReduction;
+		status[c].numIters = 0;
+		status[c].residualHistory.emplace_back(residual[c]);
+	}
+
+	auto proceed = [&](index c) {
+		return residual[c] > finalResidual[c] && noResReduction[c] < 5 && status[c].numIters < status[c].maxIters && timer.elapsedMilliseconds() <= status[c].maxConvergenceTime;
+	};
+
+	std::vector<index> active;
+	for (index c = 0; c < k; ++c) {
+		if (proceed(c)) active.push_back(c);
+	}
+
+	DenseMatrix XActive = selectColumns(X, active);
+	DenseMatrix BActive = selectColumns(B, active);
+	while (!active.empty()) {
+		cycle(XActive, BActive, finest, coarsest, numVisits, Xs, Bs, status[active[0]]);
+		std::vector<double> activeResidual = columnLengths(BActive - A * XActive);
+
+		std::vector<index> remaining; // positions in the active block of the columns that continue
+		for (index j = 0; j < active.size(); ++j) {
+			const index c = active[j];
+			residual[c] = activeResidual[j];
+			status[c].residualHistory.emplace_back(residual[c]);
+			if (residual[c] < bestResidual[c]) {
+				noResReduction[c] = 0;
+				bestResidual[c] = residual[c];
+			} else {
+				++noResReduction[c];
+			}
+			status[c].numIters++;
+			if (proceed(c)) remaining.push_back(j);
+		}
+
+		if (remaining.size() < active.size()) { // write back the active columns and continue with the remaining ones
+#pragma omp parallel for
+			for (index i = 0; i < X.numberOfRows(); ++i) {
+				const double* xActive = XActive.rowData(i);
+				double* x = X.rowData(i);
+				for (index j = 0; j < active.size(); ++j) {
+					x[active[j]] = xActive[j];
+				}
+			}
+
+			std::vector<index> stillActive;
+			for (index j : remaining) {
+				stillActive.push_back(active[j]);
+			}
+			active.swap(stillActive);
+			XActive = selectColumns(XActive, remaining);
+			BActive = selectColumns(BActive, remaining);
+			for (index i = 0; i < numActiveIterates[finest]; ++i) { // keep the iterates of the finest level
+				blockHistory[finest][i] = selectColumns(blockHistory[finest][i], remaining);
+				blockRHistory[finest][i] = selectColumns(blockRHistory[finest][i], remaining);
+			}
+		}
+	}
+
+	timer.stop();
+
+	for (index c = 0; c < k; ++c) {
+		status[c].residual = residual[c];
+		status[c].converged = residual[c] <= finalResidual[c];
+	}
+}
+
+template<class Matrix>
+void SolverLamg<Matrix>::cycle(DenseMatrix& X, const DenseMatrix& B, int finest, int coarsest, std::vector<count>& numVisits, std::vector<DenseMatrix>& Xs, std::vector<DenseMatrix>& Bs, const LAMGSolverStatus& status) {
+	std::fill(numVisits.begin(), numVisits.end(), 0);
+	Xs[finest] = X;
+	Bs[finest] = B;
+	const count k = B.numberOfColumns();
+
+	int currLvl = finest;
+	int nextLvl = finest;
+	double maxVisits = 0.0;
+
+	saveIterate(currLvl, Xs[currLvl], Bs[currLvl] - hierarchy.at(currLvl).getLaplacian() * Xs[currLvl]);
+	while (true) {
+		if (currLvl == coarsest) {
+			nextLvl = currLvl - 1;
+			if (currLvl == finest) { // finest level
+				Xs[currLvl] = smoother.relax(hierarchy.at(currLvl).getLaplacian(), Bs[currLvl], Xs[currLvl], status.numPreSmoothIters);
+			} else {
+				const count n = Bs[currLvl].numberOfRows();
+				DenseMatrix bCoarse(n+1, k, 0.0);
+				for (index i = 0; i < n; ++i) {
+					std::copy(Bs[currLvl].rowData(i), Bs[currLvl].rowData(i) + k, bCoarse.rowData(i));
+				}
+
+				DenseMatrix xCoarse = DenseMatrix::LUSolve(hierarchy.getCoarseMatrix(), bCoarse);
+				for (index i = 0; i < n; ++i) {
+					std::copy(xCoarse.rowData(i), xCoarse.rowData(i) + k, Xs[currLvl].rowData(i));
+				}
+			}
+		} else {
+			if (currLvl == finest) {
+				maxVisits = 1.0;
+			} else {
+				maxVisits = hierarchy.cycleIndex(currLvl) * numVisits[currLvl-1];
+			}
+
+			if (numVisits[currLvl] < maxVisits) {
+				nextLvl = currLvl + 1;
+			} else {
+				nextLvl = currLvl - 1;
+			}
+		}
+
+		if (nextLvl < finest) break;
+
+		if (nextLvl > currLvl) {  // preProcess
+			numVisits[currLvl]++;
+
+			if (hierarchy.getType(nextLvl) != ELIMINATION) {
+				Xs[currLvl] = smoother.relax(hierarchy.at(currLvl).getLaplacian(), Bs[currLvl], Xs[currLvl], status.numPreSmoothIters);
+			}
+
+			if (hierarchy.getType(nextLvl) == ELIMINATION) {
+				hierarchy.at(nextLvl).restrict(Bs[currLvl], Bs[nextLvl], blockBStages[nextLvl]);
+			} else {
+				hierarchy.at(nextLvl).restrict(Bs[currLvl] - hierarchy.at(currLvl).getLaplacian() * Xs[currLvl], Bs[nextLvl]);
+			}
+
+			hierarchy.at(nextLvl).coarseType(Xs[currLvl], Xs[nextLvl]);
+
+			clearHistory(nextLvl);
+		} else { // postProcess
+			if (currLvl == coarsest || hierarchy.getType(currLvl+1) != ELIMINATION) {
+				minRes(currLvl, Xs[currLvl], Bs[currLvl] - hierarchy.at(currLvl).getLaplacian() * Xs[currLvl]);
+			}
+
+			if (nextLvl > finest) {
+				saveIterate(nextLvl, Xs[nextLvl], Bs[nextLvl] - hierarchy.at(nextLvl).getLaplacian() * Xs[nextLvl]);
+			}
+
+			if (hierarchy.getType(currLvl) == ELIMINATION) {
+				hierarchy.at(currLvl).interpolate(Xs[currLvl], Xs[nextLvl], blockBStages[currLvl]);
+			} else {
+				DenseMatrix xf;
+				hierarchy.at(currLvl).interpolate(Xs[currLvl], xf);
+				Xs[nextLvl] += xf;
+			}
+
+			if (hierarchy.getType(currLvl) != ELIMINATION) {
+				Xs[nextLvl] = smoother.relax(hierarchy.at(nextLvl).getLaplacian(), Bs[nextLvl], Xs[nextLvl], status.numPostSmoothIters);
+			}
+
+		}
+
+		currLvl = nextLvl;
+	} // while
+
+	// post-cycle finest
+	if ((int64_t) hierarchy.size() > finest + 1 && hierarchy.getType(finest+1) != ELIMINATION) { // do an iterate recombination on calculated solutions
+		minRes(finest, Xs[finest], Bs[finest] - hierarchy.at(finest).getLaplacian() * Xs[finest]);
+	}
+
+	X = Xs[finest];
+	std::vector<double> mean(k, 0.0);
+	for (index i = 0; i < X.numberOfRows(); ++i) {
+		const double* x = X.rowData(i);
+		for (index c = 0; c < k; ++c) {
+			mean[c] += x[c];
+		}
+	}
+	for (index c = 0; c < k; ++c) {
+		mean[c] /= X.numberOfRows();
+	}
+#pragma omp parallel for
+	for (index i = 0; i < X.numberOfRows(); ++i) {
+		double* x = X.rowData(i);
+		for (index c = 0; c < k; ++c) {
+			x[c] -= mean[c];
+		}
+	}
+}
+
+template<class Matrix>
+void SolverLamg<Matrix>::saveIterate(index level, const DenseMatrix& X, const DenseMatrix& R) {
+	// update latest pointer
+	index i = latestIterate[level];
+	latestIterate[level] = (i+1) % MAX_COMBINED_ITERATES;
+
+	// update numIterates
+	if (numActiveIterates[level] < MAX_COMBINED_ITERATES) {
+		numActiveIterates[level]++;
+	}
+
+	// update history array
+	blockHistory[level][i] = X;
+	blockRHistory[level][i] = R;
+}
+
+template<class Matrix>
+void SolverLamg<Matrix>::minRes(index level, DenseMatrix& X, const DenseMatrix& R) {
+	if (numActiveIterates[level] > 0) {
+		const count n = numActiveIterates[level];
+		const count k = X.numberOfColumns();
+		const std::vector<DenseMatrix>& H = blockHistory[level];
+		const std::vector<DenseMatrix>& RH = blockRHistory[level];
+		auto significant = [](double value) {
+			return std::fabs(value) > 1e-25 ? value : 0.0;
+		};
+
+		// normal equations AE^T * AE * alpha = AE^T * r of every column, AE = (r - rHistory[0], ..., r - rHistory[n-1])
+		std::vector<double> gram(k * n * n, 0.0);
+		std::vector<double> rhs(k * n, 0.0);
+#pragma omp parallel
+		{
+			std::vector<double> localGram(k * n * n, 0.0);
+			std::vector<double> localRhs(k * n, 0.0);
+			std::vector<double> ae(n);
+#pragma omp for
+			for (index i = 0; i < X.numberOfRows(); ++i) {
+				const double* r = R.rowData(i);
+				for (index c = 0; c < k; ++c) {
+					for (index l = 0; l < n; ++l) {
+						ae[l] = significant(r[c] - RH[l].rowData(i)[c]);
+					}
+					for (index l = 0; l < n; ++l) {
+						localRhs[c * n + l] += ae[l] * r[c];
+						for (index m = 0; m < n; ++m) {
+							localGram[(c * n + l) * n + m] += ae[l] * ae[m];
+						}
+					}
+				}
+			}
+#pragma omp critical
+			{
+				for (index j = 0; j < gram.size(); ++j) gram[j] += localGram[j];
+				for (index j = 0; j < rhs.size(); ++j) rhs[j] += localRhs[j];
+			}
+		}
+
+		std::vector<double> alpha(k * n);
+		for (index c = 0; c < k; ++c) {
+			std::vector<Triplet> triplets;
+			Vector b(n);
+			for (index l = 0; l < n; ++l) {
+				b[l] = rhs[c * n + l];
+				for (index m = 0; m < n; ++m) {
+					double value = gram[(c * n + l) * n + m];
+					if (value != 0.0) {
+						triplets.push_back({l, m, value});
+					}
+				}
+			}
+			Vector alphaC = smoother.relax(CSRMatrix(n, triplets), b, Vector(n, 0.0), 10);
+			for (index l = 0; l < n; ++l) {
+				alpha[c * n + l] = alphaC[l];
+			}
+		}
+
+		// x += E * alpha, E = (history[0] - x, ..., history[n-1] - x)
+#pragma omp parallel for
+		for (index i = 0; i < X.numberOfRows(); ++i) {
+			double* x = X.rowData(i);
+			for (index c = 0; c < k; ++c) {
+				double update = 0.0;
+				for (index l = 0; l < n; ++l) {
+					update += significant(H[l].rowData(i)[c] - x[c]) * alpha[c * n + l];
+				}
+				x[c] += update;
+			}
+		}
+	}
+}
+
+template<class Matrix>
+std::vector<double> SolverLamg<Matrix>::columnLengths(const DenseMatrix& block) {
+	std::vector<double> lengths = DenseMatrix::columnInnerProducts(block, block);
+	for (double& length : lengths) {
+		length = std::sqrt(length);
+	}
+	return lengths;
+}
+
+template<class Matrix>
+DenseMatrix SolverLamg<Matrix>::selectColumns(const DenseMatrix& block, const std::vector<index>& columns) {
+	DenseMatrix result(block.numberOfRows(), columns.size(), 0.0);
+#pragma omp parallel for
+	for (index i = 0; i < block.numberOfRows(); ++i) {
+		const double* row = block.rowData(i);
+		double* resultRow = result.rowData(i);
+		for (index j = 0; j < columns.size(); ++j) {
+			resultRow[j] = row[columns[j]];
+		}
+	}
+	return result;
+}
+
 } /* namespace NetworKit */
 
 #endif /* SOLVERLAMG_H_ */
@@ -51,6 +51,24 @@ public:
 		return out;
 	}
 
+	/**
+	 * Returns the preconditioned right-hand-sides \f$P(B) = D(A)^{-1}B\f$.
+	 */
+	DenseMatrix rhs(const DenseMatrix& B) const {
+		assert(B.numberOfRows() == inv_diag.getDimension());
+		const count k = B.numberOfColumns();
+		DenseMatrix out(B.numberOfRows(), k, 0.0);
+#pragma omp parallel for
+		for (index i = 0; i < B.numberOfRows(); ++i) {
+			const double* b = B.rowData(i);
+			double* o = out.rowData(i);
+			for (index c = 0; c < k; ++c) {
+				o[c] = inv_diag[i] * b[c];
+			}
+		}
+		return out;
+	}
+
 private:
 	Vector inv_diag;
 };
@@ -31,6 +31,13 @@ public:
 	Vector rhs(const Vector& b) const {
 		return b;
 	}
+
+	/**
+	 * Returns the preconditioned right-hand-sides \f$P(B) = B\f$.
+	 */
+	DenseMatrix rhs(const DenseMatrix& B) const {
+		return B;
+	}
 };
 
 } /* namespace NetworKit */
@@ -10,6 +10,7 @@
 
 #include "../algebraic/CSRMatrix.h"
 #include "../algebraic/Vector.h"
+#include "../algebraic/DenseMatrix.h"
 
 #include <limits>
 #include "../algebraic/DynamicMatrix.h"
@@ -28,6 +29,21 @@ public:
 
 	virtual Vector relax(const Matrix& A, const Vector& b, const Vector& initialGuess, const count maxIterations = std::numeric_limits<count>::max()) const = 0;
 	virtual Vector relax(const Matrix& A, const Vector& b, const count maxIterations = std::numeric_limits<count>::max()) const = 0;
+
+	/**
+	 * Relaxes the systems A * X = B for all columns of @a B, starting with @a initialGuess. The default implementation
+	 * relaxes every column on its own.
+	 */
+	virtual DenseMatrix relax(const Matrix& A, const DenseMatrix& B, const DenseMatrix& initialGuess, const count maxIterations = std::numeric_limits<count>::max()) const {
+		DenseMatrix X = initialGuess;
+		for (index c = 0; c < B.numberOfColumns(); ++c) {
+			Vector x = relax(A, B.column(c), initialGuess.column(c), maxIterations);
+			for (index i = 0; i < x.getDimension(); ++i) {
+				X.setValue(i, c, x[i]);
+			}
+		}
+		return X;
+	}
 };
 
 } /* namespace NetworKit */
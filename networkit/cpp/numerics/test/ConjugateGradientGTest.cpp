@@ -0,0 +1,50 @@
+/*
+ * ConjugateGradientGTest.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include "ConjugateGradientGTest.h"
+
+#include "../../io/METISGraphReader.h"
+
+namespace NetworKit {
+
+TEST_F(ConjugateGradientGTest, testBlockSolve) {
+	METISGraphReader reader;
+	Graph G = reader.read("input/jazz.graph");
+	const count n = G.numberOfNodes();
+
+	// the Laplacian plus the identity is positive definite
+	std::vector<Triplet> triplets;
+	CSRMatrix L = CSRMatrix::laplacianMatrix(G);
+	L.forNonZeroElementsInRowOrder([&](index i, index j, double value) {
+		triplets.push_back({i, j, i == j ? value + 1.0 : value});
+	});
+	CSRMatrix A(n, triplets);
+
+	// more right-hand sides than fit into one block, the last one is zero
+	const count k = 20;
+	std::vector<Vector> rhs(k, Vector(n, 0.0));
+	for (index c = 0; c + 1 < k; ++c) {
+		for (index i = 0; i < n; ++i) {
+			rhs[c][i] = Aux::Random::real(-1.0, 1.0);
+		}
+	}
+	std::vector<Vector> results(k, Vector(n, 0.0));
+
+	ConjugateGradient<CSRMatrix, DiagonalPreconditioner> cg(1e-8);
+	cg.setup(A);
+	cg.parallelSolve(rhs, results);
+
+	for (index c = 0; c + 1 < k; ++c) {
+		EXPECT_LE((A * results[c] - rhs[c]).length() / rhs[c].length(), 1e-8);
+
+		Vector x(n, 0.0);
+		cg.solve(rhs[c], x);
+		EXPECT_LE((x - results[c]).length(), 1e-6 * x.length());
+	}
+	EXPECT_EQ(0.0, results[k-1].length());
+}
+
+} /* namespace NetworKit */
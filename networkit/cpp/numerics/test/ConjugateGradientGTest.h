@@ -0,0 +1,32 @@
+/*
+ * ConjugateGradientGTest.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef NOGTEST
+
+#ifndef CONJUGATEGRADIENTGTEST_H_
+#define CONJUGATEGRADIENTGTEST_H_
+
+#include "gtest/gtest.h"
+
+#include "../../algebraic/CSRMatrix.h"
+#include "../../algebraic/DenseMatrix.h"
+#include "../../algebraic/Vector.h"
+#include "../ConjugateGradient.h"
+#include "../Preconditioner/DiagonalPreconditioner.h"
+
+namespace NetworKit {
+
+class ConjugateGradientGTest : public testing::Test {
+public:
+	ConjugateGradientGTest() {}
+	~ConjugateGradientGTest() {}
+};
+
+} /* namespace NetworKit */
+
+#endif /* CONJUGATEGRADIENTGTEST_H_ */
+
+#endif
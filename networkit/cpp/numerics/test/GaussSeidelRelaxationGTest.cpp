@@ -49,4 +49,31 @@ TEST(GaussSeidelRelaxationGTest, tryIteration) {
 	EXPECT_TRUE(result[3] > 0);
 }
 
+TEST(GaussSeidelRelaxationGTest, tryBlockSolve) {
+	std::vector<Triplet> triplets = {{0,0,10}, {0,1,-1}, {0,2,2}, {1,0,-1}, {1,1,11}, {1,2,-1}, {1,3,3}, {2,0,2}, {2,1,-1}, {2,2,10}, {2,3,-1}, {3,1,3}, {3,2,-1}, {3,3,8}};
+	CSRMatrix A(4, triplets);
+
+	// the second column is twice the first one
+	DenseMatrix B(4, 2, std::vector<double>{6, 12, 25, 50, -11, -22, 15, 30});
+	DenseMatrix X(4, 2, 0.0);
+
+	GaussSeidelRelaxation<CSRMatrix> solver;
+	DenseMatrix result = solver.relax(A, B, X);
+
+	std::vector<double> expected = {1, 2, -1, 1};
+	for (index i = 0; i < 4; ++i) {
+		EXPECT_NEAR(expected[i], result(i, 0), 1e-9);
+		EXPECT_NEAR(2 * expected[i], result(i, 1), 1e-9);
+	}
+
+	// a single sweep gives the same result as for each column on its own
+	DenseMatrix sweep = solver.relax(A, B, X, 1);
+	for (index c = 0; c < 2; ++c) {
+		Vector x = solver.relax(A, B.column(c), Vector(4, 0.0), 1);
+		for (index i = 0; i < 4; ++i) {
+			EXPECT_DOUBLE_EQ(x[i], sweep(i, c));
+		}
+	}
+}
+
 } /* namespace NetworKit */
@@ -8,8 +8,11 @@
 #include "LAMGGTest.h"
 #include "../LAMG/MultiLevelSetup.h"
 #include "../LAMG/SolverLamg.h"
+#include "../LAMG/Lamg.h"
 #include "../../io/LineFileReader.h"
 #include "../../auxiliary/Timer.h"
+#include "../../auxiliary/Random.h"
+#include "../../auxiliary/Parallelism.h"
 #include "../../algebraic/CSRMatrix.h"
 
 #include "../GaussSeidelRelaxation.h"
@@ -68,7 +71,134 @@ TEST_F(LAMGGTest, testSmallGraphs) {
 	delete smoother;
 }
 
+TEST_F(LAMGGTest, testLargerGraph) {
+	// large enough for elimination, aggregation and the parallel smoother
+	Aux::Random::setSeed(42, false);
+	Graph G = BarabasiAlbertGenerator(3, 8000).generate();
+	CSRMatrix L = CSRMatrix::laplacianMatrix(G);
+
+	LevelHierarchy<CSRMatrix> hierarchy;
+	GaussSeidelRelaxation<CSRMatrix> smoother;
+	MultiLevelSetup<CSRMatrix> setup(smoother);
+	setup.setup(L, hierarchy);
+	EXPECT_LT(2u, hierarchy.size());
+	for (index i = 1; i < hierarchy.size(); ++i) {
+		EXPECT_LT(hierarchy.at(i).getNumberOfNodes(), hierarchy.at(i-1).getNumberOfNodes());
+		// coarse Laplacians keep zero row sums
+		const CSRMatrix& A = hierarchy.at(i).getLaplacian();
+		for (index u = 0; u < A.numberOfRows(); ++u) {
+			double rowSum = 0.0;
+			A.forNonZeroElementsInRow(u, [&](index, double value) {
+				rowSum += value;
+			});
+			EXPECT_NEAR(0.0, rowSum, 1e-8);
+		}
+	}
+
+	Vector b = randZeroSum(G, 12345);
+	Vector x(G.numberOfNodes(), 0.0);
+	SolverLamg<CSRMatrix> solver(hierarchy, smoother);
+	LAMGSolverStatus status;
+	status.desiredResidualReduction = 1e-6;
+	solver.solve(x, b, status);
+
+	EXPECT_TRUE(status.converged);
+	EXPECT_LE((L * x - b).length() / b.length(), 1e-5);
+}
+
+
+TEST_F(LAMGGTest, testGalerkinOperator) {
+	Aux::Random::setSeed(42, false);
+	Graph G = BarabasiAlbertGenerator(3, 8000).generate();
+	CSRMatrix L = CSRMatrix::laplacianMatrix(G);
+	GaussSeidelRelaxation<CSRMatrix> smoother;
+	MultiLevelSetup<CSRMatrix> setup(smoother);
+
+	// the coarse operators are assembled in parallel
+	const int threads = Aux::getMaxNumberOfThreads();
+	LevelHierarchy<CSRMatrix> hierarchy;
+	Aux::setNumberOfThreads(std::max(threads, 4));
+	setup.setup(L, hierarchy);
+	Aux::setNumberOfThreads(threads);
+
+	bool sawAggregation = false;
+	for (index i = 1; i < hierarchy.size(); ++i) {
+		const CSRMatrix& A = hierarchy.at(i).getLaplacian();
+		if (hierarchy.getType(i) != AGGREGATION) continue;
+		sawAggregation = true;
+
+		// the coarse Laplacian must equal R * A_fine * P, checked with sequential matrix-vector products
+		const CSRMatrix& fine = hierarchy.at(i-1).getLaplacian();
+		Vector xc(A.numberOfRows());
+		for (index u = 0; u < xc.getDimension(); ++u) {
+			xc[u] = Aux::Random::real(-1.0, 1.0);
+		}
+		Vector xf, bc;
+		hierarchy.at(i).interpolate(xc, xf);
+		hierarchy.at(i).restrict(fine * xf, bc);
+		Vector diff = A * xc - bc;
+		EXPECT_LE(diff.length(), 1e-8 * (1.0 + bc.length()));
+	}
+	EXPECT_TRUE(sawAggregation);
+}
+
 
+TEST_F(LAMGGTest, testBlockSolve) {
+	Aux::Random::setSeed(42, false);
+	Graph G = BarabasiAlbertGenerator(3, 8000).generate();
+	CSRMatrix L = CSRMatrix::laplacianMatrix(G);
+	const count n = G.numberOfNodes();
+	const count k = 5;
+
+	LevelHierarchy<CSRMatrix> hierarchy;
+	GaussSeidelRelaxation<CSRMatrix> smoother;
+	MultiLevelSetup<CSRMatrix> setup(smoother);
+	setup.setup(L, hierarchy);
+
+	DenseMatrix B(n, k, 0.0);
+	for (index c = 0; c < k; ++c) {
+		Vector b = randZeroSum(G, 12345 + c);
+		for (index i = 0; i < n; ++i) {
+			B.setValue(i, c, b[i]);
+		}
+	}
+
+	DenseMatrix X(n, k, 0.0);
+	SolverLamg<CSRMatrix> solver(hierarchy, smoother);
+	std::vector<LAMGSolverStatus> status(k);
+	for (index c = 0; c < k; ++c) {
+		status[c].desiredResidualReduction = 1e-6;
+	}
+	solver.solve(X, B, status);
+
+	for (index c = 0; c < k; ++c) {
+		EXPECT_TRUE(status[c].converged);
+		Vector b = B.column(c);
+		EXPECT_LE((L * X.column(c) - b).length() / b.length(), 1e-5);
+	}
+}
+
+TEST_F(LAMGGTest, testParallelSolve) {
+	METISGraphReader reader;
+	Graph G = reader.read("input/PGPgiantcompo.graph");
+	const count n = G.numberOfNodes();
+	CSRMatrix L = CSRMatrix::laplacianMatrix(G);
+
+	// more right-hand sides than fit into one block
+	std::vector<Vector> rhs;
+	for (index c = 0; c < 20; ++c) {
+		rhs.push_back(randZeroSum(G, 100 + c));
+	}
+	std::vector<Vector> results(rhs.size(), Vector(n, 0.0));
+
+	Lamg<CSRMatrix> lamg(1e-6);
+	lamg.setupConnected(L);
+	lamg.parallelSolve(rhs, results);
+
+	for (index c = 0; c < rhs.size(); ++c) {
+		EXPECT_LE((L * results[c] - rhs[c]).length() / rhs[c].length(), 1e-5);
+	}
+}
 
 Vector LAMGGTest::randVector(count dimension, double lower, double upper) const {
 	Vector randVector(dimension);
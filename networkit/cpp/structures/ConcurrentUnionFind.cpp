@@ -0,0 +1,35 @@
+/*
+ * ConcurrentUnionFind.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include "ConcurrentUnionFind.h"
+
+namespace NetworKit {
+
+void ConcurrentUnionFind::allToSingletons() {
+	#pragma omp parallel for
+	for (index i = 0; i < parent.size(); ++i) {
+		parent[i].store(i, std::memory_order_relaxed);
+	}
+}
+
+void ConcurrentUnionFind::compress() {
+	#pragma omp parallel for
+	for (index i = 0; i < parent.size(); ++i) {
+		parent[i].store(find(i), std::memory_order_relaxed);
+	}
+}
+
+Partition ConcurrentUnionFind::toPartition() {
+	Partition p(parent.size());
+	p.setUpperBound(parent.size());
+	#pragma omp parallel for
+	for (index e = 0; e < parent.size(); ++e) {
+		p[e] = find(e);
+	}
+	return p;
+}
+
+} /* namespace NetworKit */
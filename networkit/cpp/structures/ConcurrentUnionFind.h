@@ -0,0 +1,101 @@
+/*
+ * ConcurrentUnionFind.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef CONCURRENTUNIONFIND_H_
+#define CONCURRENTUNIONFIND_H_
+
+#include <atomic>
+#include <vector>
+#include "../Globals.h"
+#include "../structures/Partition.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup structures
+ * Union find data structure whose find and merge operations may be called
+ * concurrently by several threads without locks.
+ * find uses path splitting, merge hooks the root with the larger id below the root
+ * with the smaller id by compare-and-swap. Thus the representative of a set is always
+ * its smallest element.
+ */
+class ConcurrentUnionFind {
+private:
+	std::vector<std::atomic<index>> parent;
+
+public:
+
+	/**
+	 * Create a new set representation with not more the @max_element elements.
+	 * Initially every element is in its own set.
+	 * @param max_element maximum number of elements
+	 */
+	ConcurrentUnionFind(index max_element) : parent(max_element) {
+		allToSingletons();
+	}
+
+	/**
+	 * Assigns every element to a singleton set.
+	 * Set id is equal to element id.
+	 */
+	void allToSingletons();
+
+	/**
+	 * Find the representative (the smallest element) of the set containing @u.
+	 * @param u element
+	 * @return representative of set containing @u
+	 */
+	index find(index u) {
+		while (true) {
+			index p = parent[u].load(std::memory_order_relaxed);
+			index gp = parent[p].load(std::memory_order_relaxed);
+			if (p == gp) {
+				return p;
+			}
+			// path splitting: let u skip its parent, failure only means someone else shortened the path
+			parent[u].compare_exchange_weak(p, gp, std::memory_order_relaxed);
+			u = p;
+		}
+	}
+
+	/**
+	 * Merge the two sets containing @u and @v.
+	 * @param u element u
+	 * @param v element v
+	 */
+	void merge(index u, index v) {
+		while (true) {
+			u = find(u);
+			v = find(v);
+			if (u == v) {
+				return;
+			}
+			if (u < v) {
+				std::swap(u, v);
+			}
+			// u is the larger root, hook it below v unless it got a parent in the meantime
+			index expected = u;
+			if (parent[u].compare_exchange_strong(expected, v, std::memory_order_relaxed)) {
+				return;
+			}
+		}
+	}
+
+	/**
+	 * Sets the parent of every element to its representative. Must not run
+	 * concurrently with merge.
+	 */
+	void compress();
+
+	/**
+	 * Convert the union find data structure to a Partition
+	 * @return Partition equivalent to the union find data structure
+	 */
+	Partition toPartition();
+};
+
+} /* namespace NetworKit */
+#endif /* CONCURRENTUNIONFIND_H_ */
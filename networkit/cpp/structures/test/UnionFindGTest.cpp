@@ -10,6 +10,7 @@
 #include "UnionFindGTest.h"
 
 #include "../UnionFind.h"
+#include "../ConcurrentUnionFind.h"
 
 #ifndef NOGTEST
 
@@ -72,6 +73,31 @@ TEST_F(UnionFindGTest, testMergeCircular) {
 	}
 }
 
+TEST_F(UnionFindGTest, testConcurrentMerge) {
+	const count n = 10000;
+	ConcurrentUnionFind p(n);
+
+	// merge all elements with the same residue modulo 7, concurrently and in a shuffled order
+	#pragma omp parallel for
+	for (index i = 0; i < n; ++i) {
+		index j = (i * 7919) % n;
+		if (j >= 7) {
+			p.merge(j, j - 7);
+		}
+	}
+
+	for (index i = 0; i < n; ++i) {
+		EXPECT_EQ(i % 7, p.find(i));
+	}
+
+	p.compress();
+	Partition part = p.toPartition();
+	EXPECT_EQ(7u, part.numberOfSubsets());
+	for (index i = 0; i < n; ++i) {
+		EXPECT_TRUE(part.inSameSubset(i, i % 7));
+	}
+}
+
 } /* namespace NetworKit */
 
 #endif /*NOGTEST */
@@ -6,6 +6,8 @@
  */
 
 #include "FruchtermanReingold.h"
+#include "Octree.h"
+#include "../algebraic/Vector.h"
 #include "../auxiliary/Log.h"
 
 namespace NetworKit {
@@ -14,8 +16,8 @@ const float FruchtermanReingold::INITIAL_STEP_LENGTH = 1.0;
 const float FruchtermanReingold::OPT_PAIR_SQR_DIST_SCALE = 0.3;
 
 
-FruchtermanReingold::FruchtermanReingold(Point<float> bottom_left, Point<float> top_right, bool useGivenCoordinates, count maxIterations, float precision):
-		Layouter(bottom_left, top_right, useGivenCoordinates), maxIter(maxIterations), prec(precision), step(INITIAL_STEP_LENGTH)
+FruchtermanReingold::FruchtermanReingold(Point<float> bottom_left, Point<float> top_right, bool useGivenCoordinates, count maxIterations, float precision, bool approximateRepulsion, double theta):
+		Layouter(bottom_left, top_right, useGivenCoordinates), maxIter(maxIterations), prec(precision), step(INITIAL_STEP_LENGTH), approximateRepulsion(approximateRepulsion), theta(theta)
 {
 
 }
@@ -124,11 +126,37 @@ void FruchtermanReingold::draw(Graph& g) {
 		});
 
 		// repulsive forces
-		g.parallelForNodePairs([&](node u, node v) {
-			Point<float> force = repulsiveForce(previousLayout[u], previousLayout[v]);
-			forces[u] += force;
-			forces[v] -= force;
-		});
+		if (approximateRepulsion && n > 1) {
+			// Barnes-Hut: far away cells act as a single point of their total weight
+			std::vector<Vector> coordinates(2, Vector(n));
+			index i = 0;
+			g.forNodes([&](node u) {
+				coordinates[0][i] = previousLayout[u][0];
+				coordinates[1][i] = previousLayout[u][1];
+				++i;
+			});
+			Octree<double> octree(coordinates);
+
+			g.parallelForNodes([&](node u) {
+				Point<double> p(previousLayout[u][0], previousLayout[u][1]);
+				double fx = 0.0, fy = 0.0;
+				auto repulsion = [&](const count weight, const Point<double>& centerOfMass, const double sqDist) {
+					if (sqDist > 0) {
+						double strength = weight * optPairSqrDist / sqDist;
+						fx += strength * (p[0] - centerOfMass[0]);
+						fy += strength * (p[1] - centerOfMass[1]);
+					}
+				};
+				octree.approximateDistance(p, theta, repulsion);
+				forces[u] += Point<float>(fx, fy);
+			});
+		} else {
+			g.parallelForNodePairs([&](node u, node v) {
+				Point<float> force = repulsiveForce(previousLayout[u], previousLayout[v]);
+				forces[u] += force;
+				forces[v] -= force;
+			});
+		}
 
 		// attractive forces
 		g.parallelForEdges([&](node u, node v) {
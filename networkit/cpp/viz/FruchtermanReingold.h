@@ -40,6 +40,8 @@ private:
 	count maxIter;
 	float prec;
 	float step;
+	bool approximateRepulsion;
+	double theta;
 
 public:
 
@@ -53,8 +55,11 @@ public:
 	 * Constructor.
 	 * @param[in] bottomLeft Coordinate of point in bottom/left corner
 	 * @param[in] topRight Coordinate of point in top/right corner
+	 * @param[in] approximateRepulsion Approximate repulsive forces with a Barnes-Hut quadtree
+	 * rebuilt in every iteration (O(n log n) instead of O(n^2) per iteration)
+	 * @param[in] theta Opening angle of the Barnes-Hut approximation, larger values are faster but less accurate
 	 */
-	FruchtermanReingold(Point<float> bottomLeft, Point<float> topRight, bool useGivenCoordinates = false, count maxIterations = MAX_ITER, float precision = EPS);
+	FruchtermanReingold(Point<float> bottomLeft, Point<float> topRight, bool useGivenCoordinates = false, count maxIterations = MAX_ITER, float precision = EPS, bool approximateRepulsion = false, double theta = 0.6);
 
 	/**
 	 * Assigns coordinates to vertices in graph @a g
@@ -9,7 +9,7 @@
 #include "../auxiliary/Log.h"
 #include "../auxiliary/PrioQueue.h"
 
-#include "../components/ConnectedComponents.h"
+#include "../components/UnionFindConnectedComponents.h"
 
 #include "../numerics/LAMG/Lamg.h"
 #include "../numerics/ConjugateGradient.h"
@@ -55,7 +55,7 @@ MaxentStress::ResultStats MaxentStress::runAlgo() {
 
 void MaxentStress::run() {
     // Check if the graph is connected. We currently can't handle unconnected graphs.
-    ConnectedComponents cc(this->G);
+    UnionFindConnectedComponents cc(this->G);
     cc.run();
     if (cc.numberOfComponents() != 1) {
         throw std::invalid_argument( "ERROR: The supplied graph is not connected. Currently MaxentStress only handles connected graphs.");
@@ -9,7 +9,6 @@
 #include "FruchtermanReingold.h"
 #include "MaxentStress.h"
 #include "../community/PLP.h"
-#include "../io/METISGraphWriter.h"
 #include "../community/EdgeCut.h"
 #include "../coarsening/ParallelPartitionCoarsening.h"
 
@@ -17,8 +16,8 @@ namespace NetworKit {
 
 const count MultilevelLayouter::N_THRSH = 15;
 
-MultilevelLayouter::MultilevelLayouter(Point<float> bottomLeft, Point<float> topRight, bool useGivenLayout):
-		Layouter(bottomLeft, topRight, useGivenLayout)
+MultilevelLayouter::MultilevelLayouter(Point<float> bottomLeft, Point<float> topRight, bool useGivenLayout, bool approximateRepulsion, double theta):
+		Layouter(bottomLeft, topRight, useGivenLayout), approximateRepulsion(approximateRepulsion), theta(theta)
 {
 
 }
@@ -34,18 +33,17 @@ void MultilevelLayouter::draw(Graph& G) {
 void MultilevelLayouter::drawInternal(Graph& G, count level) {
 	count n = G.numberOfNodes();
 
-	if (n <= N_THRSH) {
-		// unrecursive part: call drawing routine
-		METISGraphWriter gWriter;
-		gWriter.write(G, true, "output/test-multi-coarsest.graph");
+	auto drawCoarsest = [&]() {
 		DEBUG("initial layout by FR, G's size: ", G.numberOfNodes());
-		FruchtermanReingold initLayouter(bottomLeft, topRight, false);
+		FruchtermanReingold initLayouter(bottomLeft, topRight, false, MAX_ITER, EPS, approximateRepulsion, theta);
 		initLayouter.draw(G);
-		PostscriptWriter writer;
-		writer.write(G, "output/test-multi-coarsest-FR.eps");
-		FruchtermanReingold layouter(bottomLeft, topRight, true);
+		FruchtermanReingold layouter(bottomLeft, topRight, true, MAX_ITER, EPS, approximateRepulsion, theta);
 		layouter.draw(G);
-		writer.write(G, "output/test-multi-coarsest-ME.eps");
+	};
+
+	if (n <= N_THRSH) {
+		// unrecursive part: call drawing routine
+		drawCoarsest();
 	}
 	else {
 		// compute clustering
@@ -61,6 +59,12 @@ void MultilevelLayouter::drawInternal(Graph& G, count level) {
 		Graph Gcon = contracter.getCoarseGraph();
 		std::vector<node> mapping = contracter.getFineToCoarseNodeMapping();
 
+		if (Gcon.numberOfNodes() == n) {
+			// the clustering did not shrink the graph (e.g. no edges), stop recursing
+			drawCoarsest();
+			return;
+		}
+
 		// make recursive call
 		drawInternal(Gcon, level + 1);
 
@@ -73,7 +77,7 @@ void MultilevelLayouter::drawInternal(Graph& G, count level) {
 		DEBUG("local refinement of graph of size ", n);
 
 		// run drawing code on current graph
-		FruchtermanReingold layouter(bottomLeft, topRight, true); //, 50 * (level + 1), 0.1); // TODO: externalize
+		FruchtermanReingold layouter(bottomLeft, topRight, true, MAX_ITER, EPS, approximateRepulsion, theta); //, 50 * (level + 1), 0.1); // TODO: externalize
 		layouter.draw(G);
 	}
 }
@@ -22,8 +22,17 @@ MultilevelLayouter: public NetworKit::Layouter {
 protected:
 	static const count N_THRSH;
 
+	bool approximateRepulsion;
+	double theta;
+
 public:
-	MultilevelLayouter(Point<float> bottomLeft, Point<float> topRight, bool useGivenLayout = false);
+	/**
+	 * Coarsens the graph recursively by label propagation and refines the prolonged
+	 * layout with FruchtermanReingold on every level.
+	 * @param approximateRepulsion Use the Barnes-Hut approximation of FruchtermanReingold on every level
+	 * @param theta Opening angle of the Barnes-Hut approximation
+	 */
+	MultilevelLayouter(Point<float> bottomLeft, Point<float> topRight, bool useGivenLayout = false, bool approximateRepulsion = true, double theta = 0.6);
 
 	virtual void draw(Graph& G);
 	virtual void drawInternal(Graph& G, count level);
@@ -146,9 +146,11 @@ struct OctreeNode {
 	 * Computes octree node's (possibly weighted) center of mass.
 	 */
 	void computeCenterOfMass() {
-		if (!isLeaf()) {
+		// leaves hold the sum of their points as well if nearly identical points were merged in addPoint
+		if (weight > 1) {
 			centerOfMass.scale(1.0/(double) weight);
-
+		}
+		if (!isLeaf()) {
 			// remove empty childs
 			children.erase(std::remove_if(children.begin(), children.end(), [&](OctreeNode<T>& child){return child.isEmpty();}), children.end());
 
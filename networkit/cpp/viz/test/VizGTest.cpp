@@ -111,6 +111,33 @@ TEST_F(VizGTest, testFRLayouter) {
  	EXPECT_LE(avg, 0.25);
 }
 
+TEST_F(VizGTest, testFRLayouterBarnesHut) {
+	count n = 300;
+	count numClusters = 3;
+	double pin = 0.1;
+	double pout = 0.002;
+
+	ClusteredRandomGraphGenerator graphGen(n, numClusters, pin, pout);
+	Graph G = graphGen.generate();
+	G.initCoordinates();
+
+	Point<float> bl(0.0, 0.0);
+	Point<float> tr(1.0, 1.0);
+
+	FruchtermanReingold fdLayouter(bl, tr, false, MAX_ITER, EPS, true, 0.6);
+	fdLayouter.draw(G);
+
+	G.forNodes([&](node u) {
+		Point<float> p = G.getCoordinate(u);
+		EXPECT_TRUE(p[0] >= 0.0 && p[0] <= 1.0 && p[1] >= 0.0 && p[1] <= 1.0);
+	});
+
+	float dist = edgeDistanceSum(G);
+	float avg = dist / (float) G.numberOfEdges();
+	INFO("avg edge length: ", avg);
+	EXPECT_LE(avg, 0.25);
+}
+
  TEST_F(VizGTest, tryMultilevelLayouter) {
   	// create graph
   	count n = 300;
@@ -1,2 +1,2 @@
-from _NetworKit import AdamicAdarDistance, Diameter, Eccentricity, EffectiveDiameter, EffectiveDiameterApproximation, HopPlotApproximation, JaccardDistance, AlgebraicDistance, NeighborhoodFunction, NeighborhoodFunctionApproximation, CommuteTimeDistance, NeighborhoodFunctionHeuristic, APSP, BFS, Dijkstra, DynBFS, DynDijkstra, DynAPSP
+from _NetworKit import AdamicAdarDistance, Diameter, Eccentricity, EffectiveDiameter, EffectiveDiameterApproximation, HopPlotApproximation, JaccardDistance, AlgebraicDistance, NeighborhoodFunction, NeighborhoodFunctionApproximation, HyperBall, CommuteTimeDistance, NeighborhoodFunctionHeuristic, APSP, TiledAPSP, BFS, Dijkstra, DynBFS, DynDijkstra, DynAPSP
 from _NetworKit import _DiameterAlgo as DiameterAlgo
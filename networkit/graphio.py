@@ -1,6 +1,6 @@
 # extension imports
 from _NetworKit import (METISGraphReader, METISGraphWriter, DotGraphWriter, EdgeListWriter, \
-						 GMLGraphWriter, LineFileReader, SNAPGraphWriter, DGSWriter, GraphToolBinaryWriter, GraphToolBinaryReader, \
+						 GMLGraphWriter, LineFileReader, SNAPGraphWriter, DGSWriter, GraphToolBinaryWriter, GraphToolBinaryReader, NetworkitBinaryWriter, NetworkitBinaryReader, DistanceMatrixReader, \
 						  DGSStreamParser, GraphUpdater, SNAPEdgeListPartitionReader, SNAPGraphReader, EdgeListReader, CoverReader, CoverWriter, EdgeListCoverReader, KONECTGraphReader, GMLGraphReader)
 from _NetworKit import Graph as __Graph
 # local imports
@@ -35,7 +35,7 @@ try:
 	class Format(__AutoNumber):
 		""" Simple enumeration class to list supported file types. Currently supported
 		file types: SNAP, EdgeListSpaceZero, EdgeListSpaceOne, EdgeListTabZero, EdgeListTabOne,
-		METIS, GraphML, GEXF, GML, EdgeListCommaOne, GraphViz, DOT, EdgeList, LFR, KONEC, GraphToolBinary"""
+		METIS, GraphML, GEXF, GML, EdgeListCommaOne, GraphViz, DOT, EdgeList, LFR, KONEC, GraphToolBinary, NetworkitBinary"""
 		SNAP = ()
 		EdgeListSpaceZero = ()
 		EdgeListSpaceOne = ()
@@ -52,6 +52,7 @@ try:
 		LFR = ()
 		KONECT = ()
 		GraphToolBinary = ()
+		NetworkitBinary = ()
 		MAT = ()
 
 except ImportError:
@@ -73,6 +74,7 @@ except ImportError:
 		LFR = "edgelist-t1"
 		KONECT = "konect"
 		GraphToolBinary = "gtbin"
+		NetworkitBinary = "nkbg"
 		MAT = "mat"
 
 
@@ -97,6 +99,7 @@ def getReader(fileformat, **kwargs):
 			Format.KONECT:			KONECTGraphReader(' '),
 			Format.GML:			GMLGraphReader(),
 			Format.GraphToolBinary:		GraphToolBinaryReader(),
+			Format.NetworkitBinary:		NetworkitBinaryReader(),
 			Format.MAT:			MatReader()
 			}
 
@@ -118,7 +121,7 @@ def readGraph(path, fileformat, **kwargs):
 	    Parameters:
 		- fileformat: An element of the Format enumeration. Currently supported file types:
 		SNAP, EdgeListSpaceZero, EdgeListSpaceOne, EdgeListTabZero, EdgeListTabOne, METIS,
-		GraphML, GEXF, GML, EdgeListCommaOne, GraphViz, DOT, EdgeList, LFR, KONECT, GraphToolBinary
+		GraphML, GEXF, GML, EdgeListCommaOne, GraphViz, DOT, EdgeList, LFR, KONECT, GraphToolBinary, NetworkitBinary
 		- **kwargs: in case of a custom edge list, pass the genereic Fromat.EdgeList accompanied by
 			the defining paramaters as follows:
 			"separator=CHAR, firstNode=NODE, commentPrefix=STRING, continuous=BOOL, directed=BOOL"
@@ -230,7 +233,8 @@ def getWriter(fileformat, **kwargs):
 			Format.DOT:			DotGraphWriter(),
 			Format.GML:			GMLGraphWriter(),
 			Format.LFR:			EdgeListWriter('\t',1),
-			Format.GraphToolBinary:		GraphToolBinaryWriter()
+			Format.GraphToolBinary:		GraphToolBinaryWriter(),
+			Format.NetworkitBinary:		NetworkitBinaryWriter()
 			}
 	try:
 		# special case for custom Edge Lists